@@ -15,6 +15,7 @@
 #ifndef GEOMETRY__INTERSECTION__COLLISION_HPP_
 #define GEOMETRY__INTERSECTION__COLLISION_HPP_
 
+#include <cmath>
 #include <geometry/bounding_box.hpp>
 #include <geometry/polygon/polygon.hpp>
 #include <geometry_msgs/msg/pose.hpp>
@@ -25,6 +26,44 @@ namespace math
 {
 namespace geometry
 {
+/**
+ * @brief bounding box prepared for the separating axis test
+ * @note The footprint is the parallelogram center ± half_length ± half_width, which is the polygon
+ *       made by toPolygon2D, i.e. the top face of the bounding box projected on the xy plane.
+ */
+struct OrientedBoundingBox
+{
+  double center_x = 0.0, center_y = 0.0;
+
+  double half_length_x = 0.0, half_length_y = 0.0;  // half of the x axis of the bounding box
+
+  double half_width_x = 0.0, half_width_y = 0.0;  // half of the y axis of the bounding box
+
+  double center_z = 0.0, half_height = 0.0;
+
+  OrientedBoundingBox() = default;
+
+  explicit OrientedBoundingBox(
+    const geometry_msgs::msg::Pose &, const traffic_simulator_msgs::msg::BoundingBox &);
+
+  /// @note half size of the axis aligned bounding box of the footprint
+  auto halfExtentX() const noexcept -> double
+  {
+    return std::abs(half_length_x) + std::abs(half_width_x);
+  }
+
+  auto halfExtentY() const noexcept -> double
+  {
+    return std::abs(half_length_y) + std::abs(half_width_y);
+  }
+};
+
+/**
+ * @brief separating axis test of the footprints, after checking that the heights overlap
+ * @note Touching footprints are colliding. This function does not allocate memory.
+ */
+bool checkCollision2D(const OrientedBoundingBox &, const OrientedBoundingBox &);
+
 bool checkCollision2D(
   geometry_msgs::msg::Pose pose0, traffic_simulator_msgs::msg::BoundingBox bbox0,
   geometry_msgs::msg::Pose pose1, traffic_simulator_msgs::msg::BoundingBox bbox1);
@@ -15,8 +15,8 @@
 #ifndef GEOMETRY__SOLVER__POLYNOMIAL_SOLVER_HPP_
 #define GEOMETRY__SOLVER__POLYNOMIAL_SOLVER_HPP_
 
+#include <boost/container/static_vector.hpp>
 #include <complex>
-#include <vector>
 
 namespace math
 {
@@ -25,26 +25,33 @@ namespace geometry
 class PolynomialSolver
 {
 public:
+  /**
+   * @brief Real solutions of a polynomial equation.
+   * A polynomial equation of degree 3 or less has at most 3 solutions, so they are stored inline
+   * and solving an equation does not allocate memory.
+   */
+  using Solutions = boost::container::static_vector<double, 3>;
+
   /**
    * @brief solve linear equation a*x + b = 0
    *
    * @param a
    * @param b
-   * @return std::vector<double> real solution of the quadratic functions (from min_value to max_value)
+   * @return Solutions real solution of the quadratic functions (from min_value to max_value)
    */
   auto solveLinearEquation(
     const double a, const double b, const double min_value = 0, const double max_value = 1) const
-    -> std::vector<double>;
+    -> Solutions;
   /**
    * @brief solve quadratic equation a*x^2 + b*x + c = 0
    *
    * @param a
    * @param b
-   * @return std::vector<double> real solution of the quadratic functions (from min_value to max_value)
+   * @return Solutions real solution of the quadratic functions (from min_value to max_value)
    */
   auto solveQuadraticEquation(
     const double a, const double b, const double c, const double min_value = 0,
-    const double max_value = 1) const -> std::vector<double>;
+    const double max_value = 1) const -> Solutions;
   /**
    * @brief solve cubic function a*t^3 + b*t^2 + c*t + d = 0
    *
@@ -52,11 +59,11 @@ public:
    * @param b
    * @param c
    * @param d
-   * @return std::vector<double> real solution of the cubic functions (from min_value to max_value)
+   * @return Solutions real solution of the cubic functions (from min_value to max_value)
    */
   auto solveCubicEquation(
     const double a, const double b, const double c, const double d, const double min_value = 0,
-    const double max_value = 1) const -> std::vector<double>;
+    const double max_value = 1) const -> Solutions;
   /**
    * @brief calculate result of linear function a*t + b
    *
@@ -102,23 +109,24 @@ public:
   constexpr static double tolerance = 1e-7;
 
 private:
+  using ComplexSolutions = boost::container::static_vector<std::complex<double>, 3>;
+
   /**
    * @brief solve cubic equation x^3 + a*x^2 + b*x + c = 0
    * @param a 
    * @param b 
    * @param c 
-   * @return std::vector<std::complex<double>> Up to 3 complex solutions
+   * @return ComplexSolutions Up to 3 complex solutions
    */
   auto solveMonicCubicEquationWithComplex(const double a, const double b, const double c) const
-    -> std::vector<std::complex<double>>;
+    -> ComplexSolutions;
   /**
    * @brief filter values by range.
    * @param values the values you want to check.
-   * @return std::vector<double> filtered values.
+   * @return Solutions filtered values.
    */
-  auto filterByRange(
-    const std::vector<double> & values, const double min_value, const double max_value) const
-    -> std::vector<double>;
+  auto filterByRange(const Solutions & values, const double min_value, const double max_value) const
+    -> Solutions;
   /**
    * @brief check the value0 and value1 is equal or not with considering tolerance.
    * @param value0 the value you want to compare
@@ -22,6 +22,7 @@
 #include <geometry_msgs/msg/pose.hpp>
 #include <geometry_msgs/msg/vector3.hpp>
 #include <optional>
+#include <set>
 #include <vector>
 
 namespace math
@@ -63,7 +64,12 @@ public:
     const geometry_msgs::msg::Point & point, double s, bool denormalize_s = false) const;
   geometry_msgs::msg::Vector3 getSquaredDistanceVector(
     const geometry_msgs::msg::Point & point, double s, bool denormalize_s = false) const;
-  std::set<double> getCollisionPointsIn2D(
+  /**
+   * @brief Get collision points with the line segment in 2D (x and y).
+   * @return PolynomialSolver::Solutions s values of the collision points sorted in ascending order,
+   * at most 3 points because the curve is cubic.
+   */
+  PolynomialSolver::Solutions getCollisionPointsIn2D(
     const geometry_msgs::msg::Point & point0, const geometry_msgs::msg::Point & point1,
     bool search_backward = false, bool denormalize_s = false) const;
   std::optional<double> getCollisionPointIn2D(
@@ -20,32 +20,61 @@
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <geometry/bounding_box.hpp>
 #include <geometry/intersection/collision.hpp>
+#include <geometry/quaternion/get_rotation_matrix.hpp>
 #include <vector>
 
 namespace math
 {
 namespace geometry
 {
+OrientedBoundingBox::OrientedBoundingBox(
+  const geometry_msgs::msg::Pose & pose, const traffic_simulator_msgs::msg::BoundingBox & bbox)
+{
+  const auto rotation = math::geometry::getRotationMatrix(pose.orientation);
+  // the footprint is the top face, as the points made by getPointsFromBbox
+  const Eigen::Vector3d center =
+    rotation *
+    Eigen::Vector3d(bbox.center.x, bbox.center.y, bbox.center.z + bbox.dimensions.z * 0.5);
+  const Eigen::Vector3d half_length = rotation.col(0) * (bbox.dimensions.x * 0.5);
+  const Eigen::Vector3d half_width = rotation.col(1) * (bbox.dimensions.y * 0.5);
+  center_x = pose.position.x + center.x();
+  center_y = pose.position.y + center.y();
+  half_length_x = half_length.x();
+  half_length_y = half_length.y();
+  half_width_x = half_width.x();
+  half_width_y = half_width.y();
+  center_z = pose.position.z + bbox.center.z;
+  half_height = std::abs(bbox.dimensions.z) * 0.5;
+}
+
+bool checkCollision2D(const OrientedBoundingBox & box0, const OrientedBoundingBox & box1)
+{
+  if (std::abs(box0.center_z - box1.center_z) > box0.half_height + box1.half_height) {
+    return false;
+  }
+  const auto distance_x = box1.center_x - box0.center_x;
+  const auto distance_y = box1.center_y - box0.center_y;
+  // the axes do not have to be normalized, since both sides of the comparison scale equally
+  const auto separates = [&](const double axis_x, const double axis_y) {
+    const auto radius = [&](const OrientedBoundingBox & box) {
+      return std::abs(box.half_length_x * axis_x + box.half_length_y * axis_y) +
+             std::abs(box.half_width_x * axis_x + box.half_width_y * axis_y);
+    };
+    return std::abs(distance_x * axis_x + distance_y * axis_y) > radius(box0) + radius(box1);
+  };
+  // the candidate separating axes are the normals of the edges of both parallelograms
+  return not(
+    separates(-box0.half_length_y, box0.half_length_x) or
+    separates(-box0.half_width_y, box0.half_width_x) or
+    separates(-box1.half_length_y, box1.half_length_x) or
+    separates(-box1.half_width_y, box1.half_width_x));
+}
+
 bool checkCollision2D(
   geometry_msgs::msg::Pose pose0, traffic_simulator_msgs::msg::BoundingBox bbox0,
   geometry_msgs::msg::Pose pose1, traffic_simulator_msgs::msg::BoundingBox bbox1)
 {
-  double z_diff_pose =
-    std::abs((pose0.position.z + bbox0.center.z) - (pose1.position.z + bbox1.center.z));
-  if (z_diff_pose > (std::abs(bbox0.dimensions.z + bbox1.dimensions.z) * 0.5)) {
-    return false;
-  }
-  namespace bg = boost::geometry;
-  typedef bg::model::d2::point_xy<double> bg_point;
-  const bg::model::polygon<bg_point> poly0 = math::geometry::toPolygon2D(pose0, bbox0);
-  const bg::model::polygon<bg_point> poly1 = math::geometry::toPolygon2D(pose1, bbox1);
-  if (bg::intersects(poly0, poly1)) {
-    return true;
-  }
-  if (bg::disjoint(poly0, poly1)) {
-    return false;
-  }
-  return true;
+  return checkCollision2D(OrientedBoundingBox(pose0, bbox0), OrientedBoundingBox(pose1, bbox1));
 }
 
 bool contains(
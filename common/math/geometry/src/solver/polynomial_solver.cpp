@@ -21,7 +21,6 @@
 #include <optional>
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
-#include <vector>
 
 namespace math
 {
@@ -46,9 +45,9 @@ auto PolynomialSolver::cubic(
 
 auto PolynomialSolver::solveLinearEquation(
   const double a, const double b, const double min_value, const double max_value) const
-  -> std::vector<double>
+  -> Solutions
 {
-  const auto solve_without_limit = [this](const double a, const double b) -> std::vector<double> {
+  const auto solve_without_limit = [this](const double a, const double b) -> Solutions {
     /// @note In this case, ax*b = 0 (a=0) can cause division by zero. So give special treatment to this case.
     if (isApproximatelyEqualTo(a, 0)) {
       if (isApproximatelyEqualTo(b, 0)) {
@@ -72,10 +71,10 @@ auto PolynomialSolver::solveLinearEquation(
 
 auto PolynomialSolver::solveQuadraticEquation(
   const double a, const double b, const double c, const double min_value,
-  const double max_value) const -> std::vector<double>
+  const double max_value) const -> Solutions
 {
   const auto solve_without_limit =
-    [this](const double a, const double b, const double c) -> std::vector<double> {
+    [this](const double a, const double b, const double c) -> Solutions {
     if (const double discriminant = b * b - 4 * a * c; isApproximatelyEqualTo(discriminant, 0)) {
       return {-b / (2 * a)};
     } else if (discriminant < 0) {
@@ -93,13 +92,12 @@ auto PolynomialSolver::solveQuadraticEquation(
 
 auto PolynomialSolver::solveCubicEquation(
   const double a, const double b, const double c, const double d, const double min_value,
-  const double max_value) const -> std::vector<double>
+  const double max_value) const -> Solutions
 {
   const auto solve_without_limit =
     [this](const double a, const double b, const double c, const double d) {
-      /// @note Function that takes a std::vector of complex numbers and selects only real numbers from it and returns them
-      const auto get_real_values =
-        [](const std::vector<std::complex<double>> & complex_values) -> std::vector<double> {
+      /// @note Function that selects only real numbers from the complex numbers and returns them
+      const auto get_real_values = [](const ComplexSolutions & complex_values) -> Solutions {
         /**
          * @note Function that takes a complex number as input and returns the real part if it is a real number (imaginary part is 0) 
          * or std::nullopt if it is an imaginary or complex number.
@@ -111,7 +109,7 @@ auto PolynomialSolver::solveCubicEquation(
                    : std::nullopt;
         };
         /// @note Iterate all complex values and check the value is real value or not.
-        std::vector<double> real_values = {};
+        Solutions real_values = {};
         std::for_each(
           complex_values.begin(), complex_values.end(),
           [&real_values, is_real_value](const auto & complex_value) mutable {
@@ -132,8 +130,7 @@ auto PolynomialSolver::solveCubicEquation(
 }
 
 auto PolynomialSolver::filterByRange(
-  const std::vector<double> & values, const double min_value, const double max_value) const
-  -> std::vector<double>
+  const Solutions & values, const double min_value, const double max_value) const -> Solutions
 {
   /**
    * @note Function to check if value exists between [min_value,max_value] considering the tolerance,
@@ -150,7 +147,7 @@ auto PolynomialSolver::filterByRange(
     return std::optional<double>();
   };
   /// @note Iterate values and check the value is in range or not.
-  std::vector<double> filtered_values = {};
+  Solutions filtered_values = {};
   std::for_each(
     values.begin(), values.end(),
     [&filtered_values, is_in_range, min_value, max_value](const double value) mutable {
@@ -163,7 +160,7 @@ auto PolynomialSolver::filterByRange(
 
 /// @note this code is public domain (http://math.ivanovo.ac.ru/dalgebra/Khashin/poly/index.html)
 auto PolynomialSolver::solveMonicCubicEquationWithComplex(
-  const double a, const double b, const double c) const -> std::vector<std::complex<double>>
+  const double a, const double b, const double c) const -> ComplexSolutions
 {
   /**
    * @note Tschirnhaus transformation, transform into x^3 + 3q*x + 2r = 0
@@ -176,7 +173,7 @@ auto PolynomialSolver::solveMonicCubicEquationWithComplex(
 
   const auto solve_without_limit =
     // clang-format off
-    [this, a](const auto q, const auto r) -> std::vector<std::complex<double>> {
+    [this, a](const auto q, const auto r) -> ComplexSolutions {
     // clang-format on
     if (const double q3 = q * q * q; r * r <= (q3 + tolerance)) {
       /**
@@ -205,13 +202,13 @@ auto PolynomialSolver::solveMonicCubicEquationWithComplex(
       /// @note If the imaginary part of the complex almost zero, this equation has a multiple solution.
       const double imaginary_part = 0.5 * std::sqrt(3.0) * (A - B);
       return isApproximatelyEqualTo(imaginary_part, 0)
-               ? std::vector<std::complex<double>>({
+               ? ComplexSolutions({
                    // clang-format off
                     std::complex<double>(       (A + B) - a / 3, 0),
                     std::complex<double>(-0.5 * (A + B) - a / 3, 0)
                    // clang-format on
                  })
-               : std::vector<std::complex<double>>({
+               : ComplexSolutions({
                    // clang-format off
                     std::complex<double>(       (A + B) - a / 3,               0),
                     std::complex<double>(-0.5 * (A + B) - a / 3, -imaginary_part),
@@ -17,6 +17,7 @@
 #include <geometry/bounding_box.hpp>
 #include <geometry/quaternion/euler_to_quaternion.hpp>
 #include <geometry/spline/hermite_curve.hpp>
+#include <geometry/transform.hpp>
 #include <iostream>
 #include <limits>
 #include <optional>
@@ -96,14 +97,14 @@ std::set<double> HermiteCurve::getCollisionPointsIn2D(
   }
   std::set<double> s_values;
   for (size_t i = 0; i < (n - 1); i++) {
-    const auto p0 = polygon[i];
-    const auto p1 = polygon[i + 1];
-    s_values.merge(getCollisionPointsIn2D(p0, p1, search_backward, denormalize_s));
+    const auto s =
+      getCollisionPointsIn2D(polygon[i], polygon[i + 1], search_backward, denormalize_s);
+    s_values.insert(s.begin(), s.end());
   }
   if (close_start_end) {
-    const auto p0 = polygon[n - 1];
-    const auto p1 = polygon[0];
-    s_values.merge(getCollisionPointsIn2D(p0, p1, search_backward, denormalize_s));
+    const auto s =
+      getCollisionPointsIn2D(polygon[n - 1], polygon[0], search_backward, denormalize_s);
+    s_values.insert(s.begin(), s.end());
   }
   return s_values;
 }
@@ -112,21 +113,33 @@ std::optional<double> HermiteCurve::getCollisionPointIn2D(
   const std::vector<geometry_msgs::msg::Point> & polygon, bool search_backward,
   bool close_start_end, bool denormalize_s) const
 {
-  auto s_values = getCollisionPointsIn2D(polygon, search_backward, close_start_end, denormalize_s);
-  if (s_values.empty()) {
+  size_t n = polygon.size();
+  if (n <= 1) {
     return std::nullopt;
   }
-  if (search_backward) {
-    return *s_values.rbegin();
+  /// @note Only the first (or last) collision point is needed, so the points are not collected.
+  std::optional<double> s_value;
+  const auto update = [&](const auto & p0, const auto & p1) {
+    for (const auto s : getCollisionPointsIn2D(p0, p1, search_backward, denormalize_s)) {
+      if (!s_value || (search_backward ? s_value.value() < s : s < s_value.value())) {
+        s_value = s;
+      }
+    }
+  };
+  for (size_t i = 0; i < (n - 1); i++) {
+    update(polygon[i], polygon[i + 1]);
+  }
+  if (close_start_end) {
+    update(polygon[n - 1], polygon[0]);
   }
-  return *s_values.begin();
+  return s_value;
 }
 
-std::set<double> HermiteCurve::getCollisionPointsIn2D(
+PolynomialSolver::Solutions HermiteCurve::getCollisionPointsIn2D(
   const geometry_msgs::msg::Point & point0, const geometry_msgs::msg::Point & point1,
   bool search_backward, bool denormalize_s) const
 {
-  std::set<double> s_values;
+  PolynomialSolver::Solutions s_values;
   double fx = point0.x;
   double ex = (point1.x - point0.x);
   double fy = point0.y;
@@ -136,7 +149,8 @@ std::set<double> HermiteCurve::getCollisionPointsIn2D(
   double c = cy_ * ex - cx_ * ey;
   double d = dy_ * ex - dx_ * ey - ex * fy + ey * fx;
 
-  const auto get_solutions = [search_backward, a, b, c, d, this]() -> std::vector<double> {
+  const auto get_solutions =
+    [search_backward, a, b, c, d, this]() -> PolynomialSolver::Solutions {
     try {
       /**
        * @note Obtain a solution to the cubic equation ax^3 + bx^2 + cx + d = 0 that falls within the range [0, 1].
@@ -176,14 +190,16 @@ std::set<double> HermiteCurve::getCollisionPointsIn2D(
        * tx, ty, will be in the range [0, 1] while the other will be out of that range because of division by zero.
        */
       if ((0 <= tx && tx <= 1) || (0 <= ty && ty <= 1)) {
-        s_values.insert(denormalize(solution));
+        s_values.push_back(denormalize(solution));
       }
     } else {
       if ((0 <= tx && tx <= 1) && (0 <= ty && ty <= 1)) {
-        s_values.insert(denormalize(solution));
+        s_values.push_back(denormalize(solution));
       }
     }
   }
+  std::sort(s_values.begin(), s_values.end());
+  s_values.erase(std::unique(s_values.begin(), s_values.end()), s_values.end());
   return s_values;
 }
 
@@ -191,14 +207,14 @@ std::optional<double> HermiteCurve::getCollisionPointIn2D(
   const geometry_msgs::msg::Point & point0, const geometry_msgs::msg::Point & point1,
   bool search_backward, bool denormalize_s) const
 {
-  auto s_values = getCollisionPointsIn2D(point0, point1, search_backward, denormalize_s);
+  const auto s_values = getCollisionPointsIn2D(point0, point1, search_backward, denormalize_s);
   if (s_values.empty()) {
     return std::nullopt;
   }
   if (search_backward) {
-    return *s_values.rbegin();
+    return s_values.back();
   }
-  return *s_values.begin();
+  return s_values.front();
 }
 
 std::optional<double> HermiteCurve::getSValue(
@@ -207,8 +223,8 @@ std::optional<double> HermiteCurve::getSValue(
   geometry_msgs::msg::Point p0, p1;
   p0.y = threshold_distance;
   p1.y = -threshold_distance;
-  const auto line = math::geometry::transformPoints(pose, {p0, p1});
-  const auto s = getCollisionPointIn2D(line[0], line[1], false);
+  const auto s = getCollisionPointIn2D(
+    math::geometry::transformPoint(pose, p0), math::geometry::transformPoint(pose, p1), false);
   if (!s) {
     return std::nullopt;
   }
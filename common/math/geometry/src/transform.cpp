@@ -66,7 +66,7 @@ const geometry_msgs::msg::Point transformPoint(
   const geometry_msgs::msg::Pose & pose, const geometry_msgs::msg::Point & point)
 {
   auto mat = math::geometry::getRotationMatrix(pose.orientation);
-  Eigen::VectorXd v(3);
+  Eigen::Vector3d v;
   v(0) = point.x;
   v(1) = point.y;
   v(2) = point.z;
@@ -87,7 +87,7 @@ const geometry_msgs::msg::Point transformPoint(
 {
   auto mat = math::geometry::getRotationMatrix(
     math::geometry::getRotation(sensor_pose.orientation, pose.orientation));
-  Eigen::VectorXd v(3);
+  Eigen::Vector3d v;
   v(0) = point.x;
   v(1) = point.y;
   v(2) = point.z;
@@ -106,9 +106,10 @@ std::vector<geometry_msgs::msg::Point> transformPoints(
   const geometry_msgs::msg::Pose & pose, const std::vector<geometry_msgs::msg::Point> & points)
 {
   std::vector<geometry_msgs::msg::Point> ret;
+  ret.reserve(points.size());
   std::transform(
     points.begin(), points.end(), std::back_inserter(ret),
-    [pose](const geometry_msgs::msg::Point & point) { return transformPoint(pose, point); });
+    [&pose](const geometry_msgs::msg::Point & point) { return transformPoint(pose, point); });
   return ret;
 }
 
@@ -117,6 +118,7 @@ std::vector<geometry_msgs::msg::Point> transformPoints(
   const std::vector<geometry_msgs::msg::Point> & points)
 {
   std::vector<geometry_msgs::msg::Point> ret;
+  ret.reserve(points.size());
   std::transform(
     points.begin(), points.end(), std::back_inserter(ret),
     [pose, sensor_pose](const geometry_msgs::msg::Point & point) {
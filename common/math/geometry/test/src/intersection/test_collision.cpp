@@ -14,7 +14,11 @@
 
 #include <gtest/gtest.h>
 
+#include <boost/geometry.hpp>
+#include <geometry/bounding_box.hpp>
 #include <geometry/intersection/collision.hpp>
+#include <geometry/quaternion/euler_to_quaternion.hpp>
+#include <random>
 #include <scenario_simulator_exception/exception.hpp>
 
 #include "../test_utils.hpp"
@@ -51,6 +55,64 @@ TEST(Collision, Touching)
   EXPECT_TRUE(math::geometry::checkCollision2D(pose0, box, pose1, box));
 }
 
+TEST(Collision, Rotated)
+{
+  geometry_msgs::msg::Pose pose0;
+  geometry_msgs::msg::Pose pose1 = makePose(
+    1.2, 0.0, 0.0,
+    math::geometry::convertEulerAngleToQuaternion(
+      geometry_msgs::build<geometry_msgs::msg::Vector3>().x(0.0).y(0.0).z(M_PI_4)));
+  traffic_simulator_msgs::msg::BoundingBox box = makeBbox(1.0, 1.0, 1.0);
+  // the corner of the rotated box reaches x = 1.2 - sqrt(2) / 2 < 0.5
+  EXPECT_TRUE(math::geometry::checkCollision2D(pose0, box, pose1, box));
+  pose1.position.x = 1.3;
+  pose1.position.y = 0.5;
+  // the axis aligned bounding boxes overlap, but the footprints do not
+  EXPECT_FALSE(math::geometry::checkCollision2D(pose0, box, pose1, box));
+}
+
+/**
+ * @note The separating axis test must give the same result as the intersection of the polygons
+ *       made by boost::geometry, which checkCollision2D used before.
+ */
+TEST(Collision, SameAsPolygonIntersection)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> position(-5.0, 5.0), size(0.1, 5.0), angle(-M_PI, M_PI),
+    slope(-0.2, 0.2);
+  const auto random_pose = [&]() {
+    const auto rpy = geometry_msgs::build<geometry_msgs::msg::Vector3>()
+                       .x(slope(engine))
+                       .y(slope(engine))
+                       .z(angle(engine));
+    return makePose(
+      position(engine), position(engine), 0.1 * position(engine),
+      math::geometry::convertEulerAngleToQuaternion(rpy));
+  };
+  const auto random_bbox = [&]() {
+    return makeBbox(size(engine), size(engine), size(engine), 0.5 * size(engine), 0.0, 0.5);
+  };
+  int collisions = 0;
+  for (int i = 0; i < 10000; ++i) {
+    const auto pose0 = random_pose(), pose1 = random_pose();
+    const auto bbox0 = random_bbox(), bbox1 = random_bbox();
+    const bool expected = [&]() {
+      if (
+        std::abs((pose0.position.z + bbox0.center.z) - (pose1.position.z + bbox1.center.z)) >
+        (bbox0.dimensions.z + bbox1.dimensions.z) * 0.5) {
+        return false;
+      }
+      return boost::geometry::intersects(
+        math::geometry::toPolygon2D(pose0, bbox0), math::geometry::toPolygon2D(pose1, bbox1));
+    }();
+    EXPECT_EQ(math::geometry::checkCollision2D(pose0, bbox0, pose1, bbox1), expected) << i;
+    collisions += expected;
+  }
+  // both cases should be covered
+  EXPECT_GT(collisions, 1000);
+  EXPECT_LT(collisions, 9000);
+}
+
 TEST(Collision, PointInside)
 {
   std::vector<geometry_msgs::msg::Point> polygon(4);
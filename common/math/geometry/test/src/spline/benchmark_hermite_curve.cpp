@@ -0,0 +1,128 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <geometry/solver/polynomial_solver.hpp>
+#include <geometry/spline/catmull_rom_spline.hpp>
+#include <geometry/spline/hermite_curve.hpp>
+#include <new>
+#include <vector>
+
+#include "../test_utils.hpp"
+
+namespace
+{
+std::atomic<std::size_t> allocations = 0;
+}  // namespace
+
+/// @note count the heap allocations, which are reported as the "allocations" counter
+void * operator new(std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (auto pointer = std::malloc(size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void * pointer) noexcept { std::free(pointer); }
+
+void operator delete(void * pointer, std::size_t) noexcept { std::free(pointer); }
+
+namespace
+{
+class AllocationCounter
+{
+  benchmark::State & state_;
+
+  const std::size_t start_;
+
+public:
+  explicit AllocationCounter(benchmark::State & state)
+  : state_(state), start_(allocations.load(std::memory_order_relaxed))
+  {
+  }
+
+  ~AllocationCounter()
+  {
+    state_.counters["allocations"] = benchmark::Counter(
+      static_cast<double>(allocations.load(std::memory_order_relaxed) - start_),
+      benchmark::Counter::kAvgIterations);
+  }
+};
+
+auto makeCurve() -> math::geometry::HermiteCurve
+{
+  return math::geometry::HermiteCurve(
+    makePose(0.0, 0.0), makePose(10.0, 10.0), makeVector(10.0, 0.0), makeVector(0.0, 10.0));
+}
+
+auto makeSpline() -> math::geometry::CatmullRomSpline
+{
+  std::vector<geometry_msgs::msg::Point> control_points;
+  for (int i = 0; i < 20; ++i) {
+    control_points.push_back(makePoint(5.0 * i, (i % 2) * 1.0));
+  }
+  return math::geometry::CatmullRomSpline(control_points);
+}
+}  // namespace
+
+static void solveCubicEquation(benchmark::State & state)
+{
+  math::geometry::PolynomialSolver solver;
+  double d = 0.0;
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(solver.solveCubicEquation(1.0, -2.0, -11.0, 12.0 + d, -10.0, 10.0));
+    d = d < 1.0 ? d + 1e-3 : 0.0;
+  }
+}
+BENCHMARK(solveCubicEquation);
+
+static void hermiteCurveCollisionPoints(benchmark::State & state)
+{
+  const auto curve = makeCurve();
+  const auto point0 = makePoint(0.0, 5.0);
+  const auto point1 = makePoint(10.0, 5.0);
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(curve.getCollisionPointsIn2D(point0, point1));
+  }
+}
+BENCHMARK(hermiteCurveCollisionPoints);
+
+static void hermiteCurveSValue(benchmark::State & state)
+{
+  const auto curve = makeCurve();
+  const auto pose = makePose(7.0, 3.0);
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(curve.getSValue(pose));
+  }
+}
+BENCHMARK(hermiteCurveSValue);
+
+static void catmullRomSplineSValue(benchmark::State & state)
+{
+  const auto spline = makeSpline();
+  const auto pose = makePose(72.5, 0.5);
+  const AllocationCounter counter(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(spline.getSValue(pose));
+  }
+}
+BENCHMARK(catmullRomSplineSValue);
@@ -20,6 +20,7 @@
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace xs
 {
@@ -121,11 +122,6 @@ struct Error
     </xs:element>
 */
 
-struct Properties
-{
-  /// @todo implement `properties` in junit.
-};
-
 /*
     <xs:element name="property">
         <xs:complexType>
@@ -137,9 +133,22 @@ struct Properties
 
 struct Property
 {
-  /// @todo implement `property` in junit.
+  xs::string name, value;
+
+  explicit Property(const xs::string & name, const xs::string & value) : name(name), value(value)
+  {
+  }
+
+  friend auto operator<<(pugi::xml_node node, const Property & property) -> pugi::xml_node
+  {
+    node.append_attribute("name") = property.name.c_str();
+    node.append_attribute("value") = property.value.c_str();
+    return node;
+  }
 };
 
+using Properties = std::vector<Property>;
+
 /*
     <xs:element name="skipped" type="xs:string"/>
 */
@@ -271,6 +280,8 @@ struct SimpleTestSuite : private std::unordered_map<xs::string, SimpleTestCase>
 {
   const xs::string name;
 
+  Properties properties;
+
   explicit SimpleTestSuite(const xs::string & name) : name(name) {}
 
   auto getTestcaseNames() const -> std::vector<std::string>
@@ -298,6 +309,13 @@ struct SimpleTestSuite : private std::unordered_map<xs::string, SimpleTestCase>
 
     current_node.append_attribute("name") = testsuite.name.c_str();
 
+    if (not testsuite.properties.empty()) {
+      auto properties_node = current_node.append_child("properties");
+      for (const auto & each : testsuite.properties) {
+        properties_node.append_child("property") << each;
+      }
+    }
+
     std::size_t tests = 0;
     std::size_t failures = 0;
     std::size_t pass = 0;
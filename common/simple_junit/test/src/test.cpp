@@ -137,6 +137,19 @@ TEST(SIMPLE_JUNIT, ATTRIBUTES)
   cleanup("result_attribute.junit.xml");
 }
 
+TEST(SIMPLE_JUNIT, PROPERTIES)
+{
+  common::junit::JUnit5 junit;
+  junit.testsuite("example_suite").testcase("example_case").pass.push_back(common::junit::Pass());
+  junit.testsuite("example_suite").properties.emplace_back("example_property", "10");
+  junit.testsuite("example_suite").properties.emplace_back("another_property", "example_value");
+  junit.write_to("result_properties.junit.xml", "  ");
+  EXPECT_TEXT_FILE_EQ(
+    "result_properties.junit.xml", ament_index_cpp::get_package_share_directory("simple_junit") +
+                                     "/expected/properties.junit.xml");
+  cleanup("result_properties.junit.xml");
+}
+
 TEST(SIMPLE_JUNIT, TESTSUITES_NAME)
 {
   common::junit::JUnit5 junit;
@@ -23,10 +23,13 @@
 #include <autoware_auto_vehicle_msgs/msg/turn_indicators_report.hpp>
 #include <autoware_auto_vehicle_msgs/msg/velocity_report.hpp>
 #include <concealer/autoware.hpp>
+#include <concealer/callback_latency.hpp>
 #include <concealer/publisher_wrapper.hpp>
 #include <concealer/subscriber_wrapper.hpp>
 #include <geometry_msgs/msg/accel_with_covariance_stamped.hpp>
 #include <nav_msgs/msg/odometry.hpp>
+#include <rclcpp/executors/single_threaded_executor.hpp>
+#include <string>
 
 namespace concealer
 {
@@ -51,10 +54,17 @@ class AutowareUniverse : public Autoware
   PublisherWrapper<autoware_auto_vehicle_msgs::msg::TurnIndicatorsReport> setTurnIndicatorsReport;
   // clang-format on
 
+  CallbackLatency localization_update_latency;
+
+  CallbackLatency vehicle_state_update_latency;
+
   const rclcpp::TimerBase::SharedPtr localization_update_timer;
 
   const rclcpp::TimerBase::SharedPtr vehicle_state_update_timer;
 
+  // blocks on the wait set of this node until a timer or subscription is ready, or until canceled
+  rclcpp::executors::SingleThreadedExecutor executor;
+
   std::thread localization_and_vehicle_state_update_thread;
 
   std::atomic<bool> is_stop_requested = false;
@@ -65,8 +75,16 @@ class AutowareUniverse : public Autoware
 
   auto stopAndJoin() -> void;
 
+  // records how much later than one period after the previous call a timer callback was called
+  static auto recordTimerLatency(
+    CallbackLatency &, const std::chrono::nanoseconds period,
+    std::chrono::steady_clock::time_point & previous_call) -> void;
+
 public:
-  CONCEALER_PUBLIC explicit AutowareUniverse();
+  /**
+   * @param topic_namespace prefix of all topics, which is empty unless multiple egos are simulated
+   */
+  CONCEALER_PUBLIC explicit AutowareUniverse(const std::string & topic_namespace = "");
 
   ~AutowareUniverse();
 
@@ -91,6 +109,16 @@ public:
     autoware_auto_vehicle_msgs::msg::GearCommand> override;
 
   auto getRouteLanelets() const -> std::vector<std::int64_t>;
+
+  auto getLocalizationUpdateLatency() const noexcept -> const CallbackLatency &
+  {
+    return localization_update_latency;
+  }
+
+  auto getVehicleStateUpdateLatency() const noexcept -> const CallbackLatency &
+  {
+    return vehicle_state_update_latency;
+  }
 };
 
 }  // namespace concealer
@@ -0,0 +1,78 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CONCEALER__CALLBACK_LATENCY_HPP_
+#define CONCEALER__CALLBACK_LATENCY_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+
+namespace concealer
+{
+/*
+ * Accumulates the time between the moment a callback became ready and the moment it started, e.g.
+ * the time a task waited in the TaskQueue or the time a timer callback was late.
+ * Recording is lock-free, so it can be called from executor and dispatcher threads while another
+ * thread reads the statistics.
+ */
+class CallbackLatency
+{
+  std::atomic<std::uint64_t> count = 0;
+
+  std::atomic<std::int64_t> total = 0;  // [ns]
+
+  std::atomic<std::int64_t> maximum = 0;  // [ns]
+
+public:
+  auto record(const std::chrono::nanoseconds latency) noexcept -> void
+  {
+    const auto nanoseconds = std::max<std::int64_t>(latency.count(), 0);
+    count.fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(nanoseconds, std::memory_order_relaxed);
+    for (auto current = maximum.load(std::memory_order_relaxed);
+         current < nanoseconds and
+         not maximum.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed);) {
+    }
+  }
+
+  auto size() const noexcept -> std::uint64_t { return count.load(std::memory_order_relaxed); }
+
+  auto mean() const noexcept -> std::chrono::nanoseconds
+  {
+    const auto n = size();
+    return std::chrono::nanoseconds(n == 0 ? 0 : total.load(std::memory_order_relaxed) / n);
+  }
+
+  auto max() const noexcept -> std::chrono::nanoseconds
+  {
+    return std::chrono::nanoseconds(maximum.load(std::memory_order_relaxed));
+  }
+
+  friend auto operator<<(std::ostream & os, const CallbackLatency & latency) -> std::ostream &
+  {
+    const auto milliseconds = [](auto duration) {
+      return std::chrono::duration<double, std::milli>(duration).count();
+    };
+    return os << std::fixed << std::setprecision(3) << "mean " << milliseconds(latency.mean())
+              << " ms, max " << milliseconds(latency.max()) << " ms over " << latency.size()
+              << " callbacks";
+  }
+};
+}  // namespace concealer
+
+#endif  // CONCEALER__CALLBACK_LATENCY_HPP_
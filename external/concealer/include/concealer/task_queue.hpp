@@ -16,11 +16,15 @@
 #define CONCEALER__TASK_QUEUE_HPP_
 
 #include <atomic>
+#include <chrono>
+#include <concealer/callback_latency.hpp>
+#include <condition_variable>
 #include <exception>
 #include <functional>
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <utility>
 
 namespace concealer
 {
@@ -28,10 +32,15 @@ class TaskQueue
 {
   using Thunk = std::function<void()>;
 
-  std::queue<Thunk> thunks;
+  // each thunk is queued with the time it was delayed, to measure how long it waited
+  std::queue<std::pair<std::chrono::steady_clock::time_point, Thunk>> thunks;
 
   std::mutex thunks_mutex;
 
+  std::condition_variable thunks_condition;
+
+  CallbackLatency latency;
+
   std::thread dispatcher;
 
   std::atomic<bool> is_stop_requested = false;
@@ -51,12 +60,18 @@ public:
   decltype(auto) delay(F && f)
   {
     rethrow();
-    std::unique_lock lk(thunks_mutex);
-    thunks.emplace(std::forward<F>(f));
+    {
+      std::unique_lock lk(thunks_mutex);
+      thunks.emplace(std::chrono::steady_clock::now(), std::forward<F>(f));
+    }
+    thunks_condition.notify_one();
   }
 
   bool exhausted() const noexcept;
 
+  // time between delaying a task and starting it
+  auto getLatency() const noexcept -> const CallbackLatency & { return latency; }
+
   void rethrow() const;
 };
 }  // namespace concealer
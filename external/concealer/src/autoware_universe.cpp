@@ -16,30 +16,46 @@
 
 namespace concealer
 {
-AutowareUniverse::AutowareUniverse()
-: getAckermannControlCommand("/control/command/control_cmd", rclcpp::QoS(1), *this),
-  getGearCommandImpl("/control/command/gear_cmd", rclcpp::QoS(1), *this),
-  getTurnIndicatorsCommand("/control/command/turn_indicators_cmd", rclcpp::QoS(1), *this),
+AutowareUniverse::AutowareUniverse(const std::string & topic_namespace)
+: getAckermannControlCommand(
+    topic_namespace + "/control/command/control_cmd", rclcpp::QoS(1), *this),
+  getGearCommandImpl(topic_namespace + "/control/command/gear_cmd", rclcpp::QoS(1), *this),
+  getTurnIndicatorsCommand(
+    topic_namespace + "/control/command/turn_indicators_cmd", rclcpp::QoS(1), *this),
   getPathWithLaneId(
-    "/planning/scenario_planning/lane_driving/behavior_planning/path_with_lane_id", rclcpp::QoS(1),
-    *this),
-  setAcceleration("/localization/acceleration", *this),
-  setOdometry("/localization/kinematic_state", *this),
-  setSteeringReport("/vehicle/status/steering_status", *this),
-  setGearReport("/vehicle/status/gear_status", *this),
-  setControlModeReport("/vehicle/status/control_mode", *this),
-  setVelocityReport("/vehicle/status/velocity_status", *this),
-  setTurnIndicatorsReport("/vehicle/status/turn_indicators_status", *this),
+    topic_namespace +
+      "/planning/scenario_planning/lane_driving/behavior_planning/path_with_lane_id",
+    rclcpp::QoS(1), *this),
+  setAcceleration(topic_namespace + "/localization/acceleration", *this),
+  setOdometry(topic_namespace + "/localization/kinematic_state", *this),
+  setSteeringReport(topic_namespace + "/vehicle/status/steering_status", *this),
+  setGearReport(topic_namespace + "/vehicle/status/gear_status", *this),
+  setControlModeReport(topic_namespace + "/vehicle/status/control_mode", *this),
+  setVelocityReport(topic_namespace + "/vehicle/status/velocity_status", *this),
+  setTurnIndicatorsReport(topic_namespace + "/vehicle/status/turn_indicators_status", *this),
   // Autoware.Universe requires localization topics to send data at 50Hz
   localization_update_timer(rclcpp::create_timer(
-    this, get_clock(), std::chrono::milliseconds(20), [this]() { updateLocalization(); })),
+    this, get_clock(), std::chrono::milliseconds(20),
+    [this, previous_call = std::chrono::steady_clock::time_point()]() mutable {
+      recordTimerLatency(localization_update_latency, std::chrono::milliseconds(20), previous_call);
+      updateLocalization();
+    })),
   // Autoware.Universe requires vehicle state topics to send data at 30Hz
   vehicle_state_update_timer(rclcpp::create_timer(
-    this, get_clock(), std::chrono::milliseconds(33), [this]() { updateVehicleState(); })),
+    this, get_clock(), std::chrono::milliseconds(33),
+    [this, previous_call = std::chrono::steady_clock::time_point()]() mutable {
+      recordTimerLatency(
+        vehicle_state_update_latency, std::chrono::milliseconds(33), previous_call);
+      updateVehicleState();
+    })),
   localization_and_vehicle_state_update_thread(std::thread([this]() {
     try {
+      executor.add_node(get_node_base_interface());
       while (rclcpp::ok() and not is_stop_requested.load()) {
-        rclcpp::spin_some(get_node_base_interface());
+        // NOTE: Blocks until a timer or subscription of this node is ready. Executor::cancel and
+        // rclcpp::shutdown trigger the interrupt guard condition of the executor, which wakes it up
+        // even if they are called before the thread started waiting.
+        executor.spin_once();
       }
     } catch (...) {
       thrown = std::current_exception();
@@ -61,7 +77,23 @@ auto AutowareUniverse::rethrow() -> void
 auto AutowareUniverse::stopAndJoin() -> void
 {
   is_stop_requested.store(true);
+  executor.cancel();
   localization_and_vehicle_state_update_thread.join();
+  RCLCPP_INFO_STREAM(
+    get_logger(), "Localization update latency: " << localization_update_latency);
+  RCLCPP_INFO_STREAM(
+    get_logger(), "Vehicle state update latency: " << vehicle_state_update_latency);
+}
+
+auto AutowareUniverse::recordTimerLatency(
+  CallbackLatency & latency, const std::chrono::nanoseconds period,
+  std::chrono::steady_clock::time_point & previous_call) -> void
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (previous_call != std::chrono::steady_clock::time_point()) {
+    latency.record(now - previous_call - period);
+  }
+  previous_call = now;
 }
 
 auto AutowareUniverse::getAcceleration() const -> double
@@ -25,6 +25,7 @@ FieldOperatorApplicationFor<AutowareUniverse>::~FieldOperatorApplicationFor()
   shutdownAutoware();
   // All tasks should be complete before the services used in them will be deinitialized.
   task_queue.stopAndJoin();
+  RCLCPP_INFO_STREAM(get_logger(), "Task queue latency: " << task_queue.getLatency());
 }
 
 template <auto N, typename Tuples>
@@ -16,23 +16,26 @@
 #include <concealer/task_queue.hpp>
 #include <rclcpp/rclcpp.hpp>
 
-/// @todo: pzyskowski : use conditional variables to wait for new messages instead of sleep_for
 namespace concealer
 {
 TaskQueue::TaskQueue()
 : dispatcher([this] {
     try {
       while (rclcpp::ok() and not is_stop_requested.load(std::memory_order_acquire)) {
-        if (auto lock = std::unique_lock(thunks_mutex); not thunks.empty()) {
+        auto lock = std::unique_lock(thunks_mutex);
+        // NOTE: rclcpp::shutdown does not notify the condition variable, so the dispatcher wakes up
+        // periodically to check rclcpp::ok while the queue is empty.
+        thunks_condition.wait_for(lock, std::chrono::milliseconds(100), [this] {
+          return not thunks.empty() or is_stop_requested.load(std::memory_order_acquire);
+        });
+        if (not thunks.empty() and not is_stop_requested.load(std::memory_order_acquire)) {
           // NOTE: To ensure that the task to be queued is completed as expected is the
           // responsibility of the side to create a task.
-          auto thunk = std::move(thunks.front());
+          auto [delayed_time, thunk] = std::move(thunks.front());
           thunks.pop();
           lock.unlock();
+          latency.record(std::chrono::steady_clock::now() - delayed_time);
           thunk();
-        } else {
-          lock.unlock();
-          std::this_thread::sleep_for(std::chrono::milliseconds(100));
         }
       }
     } catch (...) {
@@ -46,7 +49,11 @@ TaskQueue::TaskQueue()
 void TaskQueue::stopAndJoin()
 {
   if (dispatcher.joinable()) {
-    is_stop_requested.store(true, std::memory_order_release);
+    {
+      std::unique_lock lock(thunks_mutex);
+      is_stop_requested.store(true, std::memory_order_release);
+    }
+    thunks_condition.notify_all();
     dispatcher.join();
   }
 }
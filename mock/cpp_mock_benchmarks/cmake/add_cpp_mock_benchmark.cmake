@@ -0,0 +1,47 @@
+# Copyright 2021 TIER IV, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+find_package(ament_cmake_test REQUIRED)
+#
+# Add a benchmark scenario as a launch test
+#
+# :param scenario: name of the executable of the scenario
+# :param name: name of the test, also used for the result files
+# :param arguments: additional launch arguments, e.g. parameters of the scenario
+# :param standalone_mode: "true" to run without simple_sensor_simulator
+# :param minimum_steps_per_second: the test fails below this throughput. It is a floor well below
+#   the throughput of a CI machine, so that a regression by a multiple fails, but noise does not.
+function(add_cpp_mock_benchmark scenario name arguments standalone_mode minimum_steps_per_second)
+  set(result_directory "${CMAKE_BINARY_DIR}/test_results/${PROJECT_NAME}")
+  set(cmd
+    "ros2"
+    "launch"
+    "cpp_mock_benchmarks"
+    "benchmark.launch.py"
+    "scenario:=${scenario}"
+    "standalone_mode:=${standalone_mode}"
+    "junit_path:=${result_directory}/${PROJECT_NAME}_${name}.xunit.xml"
+    "benchmark_result_path:=${result_directory}/${PROJECT_NAME}_${name}.json"
+    "minimum_steps_per_second:=${minimum_steps_per_second}"
+    ${arguments}
+  )
+
+  ament_add_test(
+    "${PROJECT_NAME}_${name}"
+    COMMAND ${cmd}
+    OUTPUT_FILE "${result_directory}/${PROJECT_NAME}_${name}.output.txt"
+    RESULT_FILE "${result_directory}/${PROJECT_NAME}_${name}.xunit.xml"
+    TIMEOUT "600"
+  )
+endfunction()
@@ -0,0 +1,112 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CPP_MOCK_BENCHMARKS__BENCHMARK_SCENARIO_NODE_HPP_
+#define CPP_MOCK_BENCHMARKS__BENCHMARK_SCENARIO_NODE_HPP_
+
+#include <chrono>
+#include <cpp_mock_scenarios/cpp_scenario_node.hpp>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/data_type/lanelet_pose.hpp>
+#include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <traffic_simulator_msgs/msg/pedestrian_parameters.hpp>
+#include <traffic_simulator_msgs/msg/vehicle_parameters.hpp>
+#include <vector>
+
+namespace cpp_mock_benchmarks
+{
+/*
+   The spacing of the entities spawned by the benchmarks. Vehicles are spawned one behind another
+   along the lanes, and pedestrians side by side across the crosswalks, so that no two entities
+   overlap. The number of entities a map holds is limited by these, see spreadPositions.
+*/
+constexpr double vehicle_interval = 10.0;  // [m]
+
+constexpr double pedestrian_interval = 1.0;  // [m]
+
+const std::vector<double> pedestrian_offsets = {-2.0, -1.0, 0.0, 1.0, 2.0};  // [m]
+
+/**
+ * @brief spread the given number of positions over the lanelets at the given interval
+ * @param offsets lateral offsets, each of which makes a row of positions along the lanelets
+ * @return positions evenly picked from all positions available
+ * @throw common::SimulationError if the lanelets do not have room for the number of positions
+ */
+auto spreadPositions(
+  const std::shared_ptr<hdmap_utils::HdMapUtils> &, const lanelet::Ids & lanelet_ids,
+  const std::size_t number_of_positions, const double interval,
+  const std::vector<double> & offsets = {0.0}) -> std::vector<traffic_simulator::LaneletPose>;
+
+/**
+ * @brief base of the load scenarios, measuring the wall clock time of each frame
+ * @note The scenario runs for benchmark_duration seconds of simulation time. Then steps/s, the
+ *       percentiles of the frame time and the peak resident set size are written as properties of
+ *       the JUnit test suite, and as JSON to benchmark_result_path if it is not empty. The
+ *       scenario fails if the throughput is below minimum_steps_per_second.
+ */
+class BenchmarkScenarioNode : public cpp_mock_scenarios::CppScenarioNode
+{
+public:
+  explicit BenchmarkScenarioNode(
+    const std::string & node_name, const std::string & lanelet2_map_file,
+    const rclcpp::NodeOptions & option);
+
+protected:
+  /**
+   * @brief spawn vehicles following their lanes, spread evenly over the road lanelets of the map
+   * @param prefix prefix of the names of the vehicles, followed by the index
+   */
+  auto spawnVehicles(
+    const std::string & prefix, const std::size_t number_of_vehicles,
+    const traffic_simulator_msgs::msg::VehicleParameters & parameters, const double speed) -> void;
+
+  /**
+   * @brief spawn pedestrians walking across the crosswalks, spread evenly over the crosswalks
+   * @param prefix prefix of the names of the pedestrians, followed by the index
+   */
+  auto spawnPedestrians(
+    const std::string & prefix, const std::size_t number_of_pedestrians,
+    const traffic_simulator_msgs::msg::PedestrianParameters & parameters, const double speed)
+    -> void;
+
+private:
+  virtual void onBenchmarkInitialize() = 0;
+
+  virtual void onBenchmarkUpdate() {}
+
+  void onInitialize() override;
+
+  void onUpdate() override;
+
+  auto report() -> void;
+
+  const std::string scenario_name_;
+
+  const double duration_;
+
+  const double minimum_steps_per_second_;
+
+  const std::string result_path_;
+
+  std::vector<std::chrono::steady_clock::duration> frame_times_;
+
+  std::optional<std::chrono::steady_clock::time_point> last_update_time_;
+};
+}  // namespace cpp_mock_benchmarks
+
+#endif  // CPP_MOCK_BENCHMARKS__BENCHMARK_SCENARIO_NODE_HPP_
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""Launch description for the benchmark scenarios."""
+
+# Copyright (c) 2020 TIER IV, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from launch import LaunchDescription
+from launch.actions import EmitEvent, OpaqueFunction, RegisterEventHandler
+from launch.actions.declare_launch_argument import DeclareLaunchArgument
+from launch.conditions import UnlessCondition
+from launch.event_handlers import OnProcessExit
+from launch.events import Shutdown
+from launch.substitutions.launch_configuration import LaunchConfiguration
+
+from launch_ros.actions import Node
+
+
+def launch_setup(context, *args, **kwargs):
+    # fmt: off
+    benchmark_duration       = LaunchConfiguration("benchmark_duration",       default=30.0)
+    benchmark_result_path    = LaunchConfiguration("benchmark_result_path",    default="")
+    global_frame_rate        = LaunchConfiguration("global_frame_rate",        default=20.0)
+    global_timeout           = LaunchConfiguration("global_timeout",           default=600)
+    junit_path               = LaunchConfiguration("junit_path",               default="/tmp/benchmark.xunit.xml")
+    minimum_steps_per_second = LaunchConfiguration("minimum_steps_per_second", default=0.0)
+    number_of_npcs           = LaunchConfiguration("number_of_npcs",           default=100)
+    port                     = LaunchConfiguration("port",                     default=5555)
+    scenario                 = LaunchConfiguration("scenario",                 default="npc_traffic")
+    standalone_mode          = LaunchConfiguration("standalone_mode",          default=True)
+    # fmt: on
+
+    def make_parameters():
+        return [
+            {"benchmark_duration": benchmark_duration},
+            {"benchmark_result_path": benchmark_result_path},
+            {"free_run": True},
+            {"global_frame_rate": global_frame_rate},
+            {"global_real_time_factor": 1.0},
+            {"global_timeout": global_timeout},
+            {"junit_path": junit_path},
+            {"launch_autoware": False},
+            {"minimum_steps_per_second": minimum_steps_per_second},
+            {"number_of_npcs": number_of_npcs},
+            {"port": port},
+            {"standalone_mode": standalone_mode},
+        ]
+
+    benchmark_node = Node(
+        package="cpp_mock_benchmarks",
+        executable=scenario,
+        name="scenario_node",
+        output="screen",
+        parameters=make_parameters(),
+    )
+
+    return [
+        # fmt: off
+        DeclareLaunchArgument("benchmark_duration",       default_value=benchmark_duration      ),
+        DeclareLaunchArgument("benchmark_result_path",    default_value=benchmark_result_path   ),
+        DeclareLaunchArgument("global_frame_rate",        default_value=global_frame_rate       ),
+        DeclareLaunchArgument("global_timeout",           default_value=global_timeout          ),
+        DeclareLaunchArgument("junit_path",               default_value=junit_path              ),
+        DeclareLaunchArgument("minimum_steps_per_second", default_value=minimum_steps_per_second),
+        DeclareLaunchArgument("number_of_npcs",           default_value=number_of_npcs          ),
+        DeclareLaunchArgument("port",                     default_value=port                    ),
+        DeclareLaunchArgument("scenario",                 default_value=scenario                ),
+        DeclareLaunchArgument("standalone_mode",          default_value=standalone_mode         ),
+        # fmt: on
+        benchmark_node,
+        Node(
+            package="simple_sensor_simulator",
+            executable="simple_sensor_simulator_node",
+            namespace="simulation",
+            output="screen",
+            parameters=[{"port": port}, {"global_frame_rate": global_frame_rate}],
+            condition=UnlessCondition(standalone_mode),
+        ),
+        RegisterEventHandler(
+            event_handler=OnProcessExit(
+                target_action=benchmark_node, on_exit=[EmitEvent(event=Shutdown())]
+            )
+        ),
+    ]
+
+
+def generate_launch_description():
+    return LaunchDescription([OpaqueFunction(function=launch_setup)])
@@ -0,0 +1,210 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cpp_mock_benchmarks/benchmark_scenario_node.hpp>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <scenario_simulator_exception/exception.hpp>
+#include <sstream>
+#include <string>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/utils/pose.hpp>
+#include <vector>
+
+namespace cpp_mock_benchmarks
+{
+BenchmarkScenarioNode::BenchmarkScenarioNode(
+  const std::string & node_name, const std::string & lanelet2_map_file,
+  const rclcpp::NodeOptions & option)
+: cpp_mock_scenarios::CppScenarioNode(
+    node_name, ament_index_cpp::get_package_share_directory("kashiwanoha_map") + "/map",
+    lanelet2_map_file, node_name, false, option),
+  scenario_name_(node_name),
+  duration_(declare_parameter<double>("benchmark_duration", 30.0)),
+  minimum_steps_per_second_(declare_parameter<double>("minimum_steps_per_second", 0.0)),
+  result_path_(declare_parameter<std::string>("benchmark_result_path", ""))
+{
+}
+
+auto spreadPositions(
+  const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils, const lanelet::Ids & lanelet_ids,
+  const std::size_t number_of_positions, const double interval,
+  const std::vector<double> & offsets) -> std::vector<traffic_simulator::LaneletPose>
+{
+  auto sorted_lanelet_ids = lanelet_ids;
+  std::sort(sorted_lanelet_ids.begin(), sorted_lanelet_ids.end());
+
+  std::vector<traffic_simulator::LaneletPose> candidates;
+  for (const auto & lanelet_id : sorted_lanelet_ids) {
+    const auto length = traffic_simulator::pose::laneletLength(lanelet_id, hdmap_utils);
+    for (auto s = interval * 0.5; s < length - interval * 0.5; s += interval) {
+      for (const auto offset : offsets) {
+        candidates.push_back(
+          traffic_simulator::helper::constructLaneletPose(lanelet_id, s, offset));
+      }
+    }
+  }
+
+  if (candidates.size() < number_of_positions) {
+    std::stringstream what;
+    what << "The map has only " << candidates.size() << " positions at intervals of " << interval
+         << " m, but " << number_of_positions << " positions are required";
+    throw common::SimulationError(what.str());
+  }
+
+  std::vector<traffic_simulator::LaneletPose> positions;
+  for (std::size_t i = 0; i < number_of_positions; ++i) {
+    positions.push_back(candidates[i * candidates.size() / number_of_positions]);
+  }
+  return positions;
+}
+
+auto BenchmarkScenarioNode::spawnVehicles(
+  const std::string & prefix, const std::size_t number_of_vehicles,
+  const traffic_simulator_msgs::msg::VehicleParameters & parameters, const double speed) -> void
+{
+  const auto & hdmap_utils = api_.getHdmapUtils();
+  const auto road_lanelet_ids = hdmap_utils->filterLaneletIds(hdmap_utils->getLaneletIds(), "road");
+  std::size_t index = 0;
+  for (const auto & position :
+       spreadPositions(hdmap_utils, road_lanelet_ids, number_of_vehicles, vehicle_interval)) {
+    const auto name = prefix + std::to_string(index++);
+    api_.spawn(
+      name,
+      traffic_simulator::helper::constructCanonicalizedLaneletPose(
+        position.lanelet_id, position.s, position.offset, hdmap_utils),
+      parameters);
+    api_.setLinearVelocity(name, speed);
+    api_.requestSpeedChange(name, speed, true);
+  }
+}
+
+auto BenchmarkScenarioNode::spawnPedestrians(
+  const std::string & prefix, const std::size_t number_of_pedestrians,
+  const traffic_simulator_msgs::msg::PedestrianParameters & parameters, const double speed)
+  -> void
+{
+  const auto & hdmap_utils = api_.getHdmapUtils();
+  const auto crosswalk_lanelet_ids =
+    hdmap_utils->filterLaneletIds(hdmap_utils->getLaneletIds(), "crosswalk");
+  std::size_t index = 0;
+  for (const auto & position : spreadPositions(
+         hdmap_utils, crosswalk_lanelet_ids, number_of_pedestrians, pedestrian_interval,
+         pedestrian_offsets)) {
+    const auto name = prefix + std::to_string(index++);
+    api_.spawn(
+      name,
+      traffic_simulator::helper::constructCanonicalizedLaneletPose(
+        position.lanelet_id, position.s, position.offset, hdmap_utils),
+      parameters);
+    api_.requestSpeedChange(name, speed, true);
+  }
+}
+
+void BenchmarkScenarioNode::onInitialize() { onBenchmarkInitialize(); }
+
+void BenchmarkScenarioNode::onUpdate()
+{
+  // the interval between the calls is the time of a frame, the first call has no previous frame
+  const auto now = std::chrono::steady_clock::now();
+  if (last_update_time_) {
+    frame_times_.push_back(now - *last_update_time_);
+  }
+  last_update_time_ = now;
+
+  if (duration_ <= api_.getCurrentTime()) {
+    report();
+  } else {
+    onBenchmarkUpdate();
+  }
+}
+
+auto BenchmarkScenarioNode::report() -> void
+{
+  const auto seconds = [](auto duration) {
+    return std::chrono::duration<double>(duration).count();
+  };
+
+  auto sorted_frame_times = frame_times_;
+  std::sort(sorted_frame_times.begin(), sorted_frame_times.end());
+
+  const auto percentile = [&](const std::size_t percent) {
+    return sorted_frame_times.empty()
+             ? 0.0
+             : seconds(sorted_frame_times[(sorted_frame_times.size() - 1) * percent / 100]);
+  };
+
+  double wall_time = 0;
+  for (const auto & frame_time : frame_times_) {
+    wall_time += seconds(frame_time);
+  }
+
+  const auto steps_per_second = 0 < wall_time ? frame_times_.size() / wall_time : 0.0;
+
+  const auto peak_rss = [&]() -> long {
+    struct rusage usage;
+    return ::getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss * 1024 : 0;  // [byte]
+  }();
+
+  const auto properties = std::vector<std::pair<std::string, double>>{
+    {"steps", static_cast<double>(frame_times_.size())},
+    {"steps_per_second", steps_per_second},
+    {"frame_time_p50", percentile(50)},
+    {"frame_time_p99", percentile(99)},
+    {"frame_time_max", percentile(100)},
+    {"peak_rss", static_cast<double>(peak_rss)},
+  };
+
+  // NOTE: std::to_string keeps only 6 decimals, which truncates sub-millisecond frame times.
+  const auto format = [](const double value) {
+    std::stringstream ss;
+    ss << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+    return ss.str();
+  };
+
+  auto & testsuite = junit_.testsuite("cpp_mock_scenario");
+  for (const auto & [name, value] : properties) {
+    testsuite.properties.emplace_back(name, format(value));
+  }
+  testsuite.testcase(scenario_name_).time = format(wall_time);
+
+  if (not result_path_.empty()) {
+    std::ofstream ofs(result_path_);
+    ofs << "{\"name\":" << std::quoted(scenario_name_) << ",\"wall_time\":" << format(wall_time);
+    for (const auto & [name, value] : properties) {
+      ofs << "," << std::quoted(name) << ":" << format(value);
+    }
+    ofs << "}\n";
+  }
+
+  std::cout << scenario_name_ << ": " << steps_per_second << " steps/s, frame time p50 "
+            << percentile(50) << " s, p99 " << percentile(99) << " s, peak RSS " << peak_rss
+            << " bytes" << std::endl;
+
+  if (steps_per_second < minimum_steps_per_second_) {
+    stop(
+      cpp_mock_scenarios::Result::FAILURE,
+      "The throughput " + format(steps_per_second) + " steps/s is below the minimum " +
+        format(minimum_steps_per_second_) + " steps/s");
+  } else {
+    stop(cpp_mock_scenarios::Result::SUCCESS);
+  }
+}
+}  // namespace cpp_mock_benchmarks
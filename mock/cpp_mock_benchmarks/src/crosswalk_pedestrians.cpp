@@ -0,0 +1,58 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_mock_benchmarks/benchmark_scenario_node.hpp>
+#include <cpp_mock_scenarios/catalogs.hpp>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+
+namespace cpp_mock_benchmarks
+{
+/**
+ * @brief number_of_pedestrians pedestrians crowding the crosswalks among number_of_npcs vehicles
+ */
+class CrosswalkPedestrians : public BenchmarkScenarioNode
+{
+public:
+  explicit CrosswalkPedestrians(const rclcpp::NodeOptions & option)
+  : BenchmarkScenarioNode(
+      "crosswalk_pedestrians", "private_road_and_walkway_ele_fix/lanelet2_map.osm", option),
+    number_of_pedestrians_(declare_parameter<int>("number_of_pedestrians", 100)),
+    number_of_npcs_(declare_parameter<int>("number_of_npcs", 50))
+  {
+    start();
+  }
+
+private:
+  void onBenchmarkInitialize() override
+  {
+    spawnPedestrians("pedestrian", number_of_pedestrians_, getPedestrianParameters(), 1.0);
+    spawnVehicles("npc", number_of_npcs_, getVehicleParameters(), 10.0);
+  }
+
+  const int number_of_pedestrians_;
+
+  const int number_of_npcs_;
+};
+}  // namespace cpp_mock_benchmarks
+
+int main(int argc, char * argv[])
+{
+  rclcpp::init(argc, argv);
+  rclcpp::NodeOptions options;
+  auto component = std::make_shared<cpp_mock_benchmarks::CrosswalkPedestrians>(options);
+  rclcpp::spin(component);
+  rclcpp::shutdown();
+  return 0;
+}
@@ -0,0 +1,72 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_mock_benchmarks/benchmark_scenario_node.hpp>
+#include <cpp_mock_scenarios/catalogs.hpp>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+
+namespace cpp_mock_benchmarks
+{
+/**
+ * @brief an ego with number_of_lidars lidars among number_of_npcs vehicles, the load of the
+ *        raycasting of simple_sensor_simulator
+ */
+class MultiLidarEgo : public BenchmarkScenarioNode
+{
+public:
+  explicit MultiLidarEgo(const rclcpp::NodeOptions & option)
+  : BenchmarkScenarioNode(
+      "multi_lidar_ego", "private_road_and_walkway_ele_fix/lanelet2_map.osm", option),
+    number_of_lidars_(declare_parameter<int>("number_of_lidars", 4)),
+    number_of_npcs_(declare_parameter<int>("number_of_npcs", 100))
+  {
+    start();
+  }
+
+private:
+  void onBenchmarkInitialize() override
+  {
+    spawnVehicles("npc", number_of_npcs_, getVehicleParameters(), 10.0);
+    api_.spawn(
+      "ego",
+      traffic_simulator::helper::constructCanonicalizedLaneletPose(
+        34570, 0.0, 0.0, api_.getHdmapUtils()),
+      getVehicleParameters());
+    api_.setLinearVelocity("ego", 10.0);
+    api_.requestSpeedChange("ego", 10.0, true);
+    for (int i = 0; i < number_of_lidars_; ++i) {
+      api_.attachLidarSensor(
+        "ego", 0.0,
+        i % 2 == 0 ? traffic_simulator::helper::LidarType::VLP16
+                   : traffic_simulator::helper::LidarType::VLP32);
+    }
+  }
+
+  const int number_of_lidars_;
+
+  const int number_of_npcs_;
+};
+}  // namespace cpp_mock_benchmarks
+
+int main(int argc, char * argv[])
+{
+  rclcpp::init(argc, argv);
+  rclcpp::NodeOptions options;
+  auto component = std::make_shared<cpp_mock_benchmarks::MultiLidarEgo>(options);
+  rclcpp::spin(component);
+  rclcpp::shutdown();
+  return 0;
+}
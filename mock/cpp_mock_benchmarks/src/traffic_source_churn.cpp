@@ -0,0 +1,76 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_mock_benchmarks/benchmark_scenario_node.hpp>
+#include <cpp_mock_scenarios/catalogs.hpp>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <traffic_simulator/api/api.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/utils/pose.hpp>
+
+namespace cpp_mock_benchmarks
+{
+/**
+ * @brief traffic sources at all entrances of the road network spawning at spawn_rate [1/s], while
+ *        the traffic sinks despawn the entities leaving, the load of spawning and despawning
+ */
+class TrafficSourceChurn : public BenchmarkScenarioNode
+{
+public:
+  explicit TrafficSourceChurn(const rclcpp::NodeOptions & option)
+  : BenchmarkScenarioNode(
+      "traffic_source_churn", "private_road_and_walkway_ele_fix/lanelet2_map.osm", option),
+    spawn_rate_(declare_parameter<double>("spawn_rate", 2.0))
+  {
+    start();
+  }
+
+private:
+  using VehicleBehavior = traffic_simulator::entity::VehicleEntity::BuiltinBehavior;
+
+  void onBenchmarkInitialize() override
+  {
+    const auto & hdmap_utils = api_.getHdmapUtils();
+    for (const auto & lanelet_id :
+         hdmap_utils->filterLaneletIds(hdmap_utils->getLaneletIds(), "road")) {
+      if (hdmap_utils->getPreviousLaneletIds(lanelet_id).empty()) {
+        api_.addTrafficSource(
+          3.0, spawn_rate_, 10.0,
+          traffic_simulator::pose::toMapPose(
+            traffic_simulator::helper::constructCanonicalizedLaneletPose(
+              lanelet_id, 5.0, 0.0, hdmap_utils)),
+          // clang-format off
+          {
+            {getVehicleParameters(), VehicleBehavior::defaultBehavior(), "", 1.0},
+          }  // clang-format on
+          ,
+          false, true, false, static_cast<int>(lanelet_id));
+      }
+    }
+  }
+
+  const double spawn_rate_;
+};
+}  // namespace cpp_mock_benchmarks
+
+int main(int argc, char * argv[])
+{
+  rclcpp::init(argc, argv);
+  rclcpp::NodeOptions options;
+  auto component = std::make_shared<cpp_mock_benchmarks::TrafficSourceChurn>(options);
+  rclcpp::spin(component);
+  rclcpp::shutdown();
+  return 0;
+}
@@ -0,0 +1,90 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cpp_mock_benchmarks/benchmark_scenario_node.hpp>
+#include <geographic_msgs/msg/geo_point.hpp>
+#include <memory>
+#include <scenario_simulator_exception/exception.hpp>
+#include <set>
+#include <string>
+#include <tuple>
+
+namespace
+{
+auto loadBenchmarkMap() -> std::shared_ptr<hdmap_utils::HdMapUtils>
+{
+  return hdmap_utils::HdMapUtils::shared(
+    ament_index_cpp::get_package_share_directory("kashiwanoha_map") +
+      "/map/private_road_and_walkway_ele_fix/lanelet2_map.osm",
+    geographic_msgs::msg::GeoPoint());
+}
+
+auto filterLaneletIds(
+  const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils, const std::string & subtype)
+  -> lanelet::Ids
+{
+  return hdmap_utils->filterLaneletIds(hdmap_utils->getLaneletIds(), subtype.c_str());
+}
+}  // namespace
+
+/**
+ * @note Test function behavior. Every benchmark registered in CMakeLists.txt, with the defaults of
+ * benchmark.launch.py, must have room on the map for all of its entities, otherwise it fails
+ * before it measures anything.
+ */
+TEST(spreadPositions, registeredBenchmarks)
+{
+  const auto hdmap_utils = loadBenchmarkMap();
+  const auto road_lanelet_ids = filterLaneletIds(hdmap_utils, "road");
+  const auto crosswalk_lanelet_ids = filterLaneletIds(hdmap_utils, "crosswalk");
+
+  // NOTE: npc_10, npc_50, npc_100, crosswalk_pedestrians and multi_lidar_ego
+  for (const auto number_of_vehicles : {10, 50, 100}) {
+    EXPECT_NO_THROW(cpp_mock_benchmarks::spreadPositions(
+      hdmap_utils, road_lanelet_ids, number_of_vehicles, cpp_mock_benchmarks::vehicle_interval))
+      << number_of_vehicles << " vehicles";
+  }
+
+  // NOTE: crosswalk_pedestrians
+  EXPECT_NO_THROW(cpp_mock_benchmarks::spreadPositions(
+    hdmap_utils, crosswalk_lanelet_ids, 100, cpp_mock_benchmarks::pedestrian_interval,
+    cpp_mock_benchmarks::pedestrian_offsets));
+}
+
+/**
+ * @note Test function behavior. The positions must be distinct, so that no two entities are
+ * spawned on top of each other, and a request beyond the room of the map must be reported.
+ */
+TEST(spreadPositions, distinct)
+{
+  const auto hdmap_utils = loadBenchmarkMap();
+  const auto crosswalk_lanelet_ids = filterLaneletIds(hdmap_utils, "crosswalk");
+
+  const auto positions = cpp_mock_benchmarks::spreadPositions(
+    hdmap_utils, crosswalk_lanelet_ids, 100, cpp_mock_benchmarks::pedestrian_interval,
+    cpp_mock_benchmarks::pedestrian_offsets);
+  std::set<std::tuple<lanelet::Id, double, double>> unique_positions;
+  for (const auto & position : positions) {
+    unique_positions.emplace(position.lanelet_id, position.s, position.offset);
+  }
+  EXPECT_EQ(unique_positions.size(), positions.size());
+
+  EXPECT_THROW(
+    cpp_mock_benchmarks::spreadPositions(
+      hdmap_utils, crosswalk_lanelet_ids, 100, cpp_mock_benchmarks::pedestrian_interval),
+    common::SimulationError);
+}
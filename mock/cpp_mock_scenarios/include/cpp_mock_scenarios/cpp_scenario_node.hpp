@@ -79,6 +79,7 @@ private:
       // configuration.lanelet2_map_file = "lanelet2_map_with_private_road_and_walkway_ele_fix.osm";
       configuration.scenario_path = scenario_filename;
       configuration.verbose = verbose;
+      configuration.standalone_mode = declare_parameter<bool>("standalone_mode", false);
     }
     checkConfiguration(configuration);
     return configuration;
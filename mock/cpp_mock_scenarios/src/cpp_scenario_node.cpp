@@ -64,8 +64,14 @@ void CppScenarioNode::start()
 {
   onInitialize();
   api_.startNpcLogic();
-  const auto rate =
-    std::chrono::duration<double>(1.0 / get_parameter("global_frame_rate").as_double());
+  /*
+     In free run mode, the frames are updated as fast as possible instead of at the frame rate in
+     wall clock time. The simulation time still advances by the step time each frame.
+  */
+  const auto rate = declare_parameter<bool>("free_run", false)
+                      ? std::chrono::duration<double>(0)
+                      : std::chrono::duration<double>(
+                          1.0 / get_parameter("global_frame_rate").as_double());
   update_timer_ = this->create_wall_timer(rate, std::bind(&CppScenarioNode::update, this));
 }
 
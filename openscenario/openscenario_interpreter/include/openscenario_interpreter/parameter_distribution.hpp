@@ -0,0 +1,31 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__PARAMETER_DISTRIBUTION_HPP_
+#define OPENSCENARIO_INTERPRETER__PARAMETER_DISTRIBUTION_HPP_
+
+#include <openscenario_interpreter/syntax/string.hpp>
+#include <unordered_map>
+
+namespace openscenario_interpreter
+{
+/*
+ * The values of the parameters that derive one concrete scenario from a ParameterValueDistribution.
+ * The values are kept as text, because they overwrite the values of the ParameterDeclarations of
+ * the base scenario as they are.
+ */
+using ParameterList = std::unordered_map<String, String>;
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__PARAMETER_DISTRIBUTION_HPP_
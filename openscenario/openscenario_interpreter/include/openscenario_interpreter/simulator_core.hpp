@@ -531,6 +531,12 @@ public:
       return core->checkCollision(std::forward<decltype(xs)>(xs)...);
     }
 
+    template <typename... Ts>
+    static auto evaluateCollidingPairs(Ts &&... xs) -> decltype(auto)
+    {
+      return core->getCollidingPairs(std::forward<decltype(xs)>(xs)...);
+    }
+
     template <typename... Ts>
     static auto evaluateBoundingBoxEuclideanDistance(
       const std::string & from_entity_name,
@@ -31,7 +31,7 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 class CatalogLocation : public std::unordered_map<std::string, pugi::xml_node>
 {
-  std::vector<std::shared_ptr<pugi::xml_document>> catalog_files;
+  std::vector<std::shared_ptr<const pugi::xml_document>> catalog_files;
 
 public:
   const Directory directory;
@@ -15,6 +15,8 @@
 #ifndef OPENSCENARIO_INTERPRETER__DETERMINISTIC_HPP_
 #define OPENSCENARIO_INTERPRETER__DETERMINISTIC_HPP_
 
+#include <cstddef>
+#include <openscenario_interpreter/parameter_distribution.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/deterministic_parameter_distribution.hpp>
 #include <pugixml.hpp>
@@ -37,6 +39,15 @@ struct Deterministic
   const std::list<DeterministicParameterDistribution> deterministic_parameter_distributions;
 
   explicit Deterministic(const pugi::xml_node &, Scope & scope);
+
+  /*
+   * The scenarios are derived from the cartesian product of the distributions. Only the
+   * distributions are stored, and the parameter list of the index-th combination is decoded when
+   * it is requested, so the number of combinations does not affect the memory usage.
+   */
+  auto getNumberOfDeriveScenarios() const -> std::size_t;
+
+  auto derive(std::size_t index) const -> ParameterList;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
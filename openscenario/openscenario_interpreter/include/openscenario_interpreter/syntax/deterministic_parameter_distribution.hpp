@@ -15,6 +15,8 @@
 #ifndef OPENSCENARIO_INTERPRETER__DETERMINISTIC_PARAMETER_DISTRIBUTION_HPP_
 #define OPENSCENARIO_INTERPRETER__DETERMINISTIC_PARAMETER_DISTRIBUTION_HPP_
 
+#include <cstddef>
+#include <openscenario_interpreter/parameter_distribution.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/deterministic_multi_parameter_distribution.hpp>
 #include <openscenario_interpreter/syntax/deterministic_single_parameter_distribution.hpp>
@@ -39,6 +41,10 @@ inline namespace syntax
 struct DeterministicParameterDistribution : public Group
 {
   explicit DeterministicParameterDistribution(const pugi::xml_node &, Scope & scope);
+
+  auto getNumberOfDeriveScenarios() const -> std::size_t;
+
+  auto derive(std::size_t index) const -> ParameterList;
 };
 
 DEFINE_LAZY_VISITOR(
@@ -46,6 +52,12 @@ DEFINE_LAZY_VISITOR(
   CASE(DeterministicMultiParameterDistribution),   //
   CASE(DeterministicSingleParameterDistribution),  //
 );
+
+DEFINE_LAZY_VISITOR(
+  const DeterministicParameterDistribution,
+  CASE(DeterministicMultiParameterDistribution),   //
+  CASE(DeterministicSingleParameterDistribution),  //
+);
 }  // namespace syntax
 }  // namespace openscenario_interpreter
 #endif  // OPENSCENARIO_INTERPRETER__DETERMINISTIC_PARAMETER_DISTRIBUTION_HPP_
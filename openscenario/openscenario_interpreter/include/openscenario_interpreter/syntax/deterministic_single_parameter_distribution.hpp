@@ -15,6 +15,8 @@
 #ifndef OPENSCENARIO_INTERPRETER__DETERMINISTIC_SINGLE_PARAMETER_DISTRIBUTION_HPP_
 #define OPENSCENARIO_INTERPRETER__DETERMINISTIC_SINGLE_PARAMETER_DISTRIBUTION_HPP_
 
+#include <cstddef>
+#include <openscenario_interpreter/parameter_distribution.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/deterministic_single_parameter_distribution_type.hpp>
 #include <pugixml.hpp>
@@ -39,6 +41,8 @@ struct DeterministicSingleParameterDistribution
   const String parameter_name;
 
   explicit DeterministicSingleParameterDistribution(const pugi::xml_node &, Scope &);
+
+  auto derive(std::size_t index) const -> ParameterList;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
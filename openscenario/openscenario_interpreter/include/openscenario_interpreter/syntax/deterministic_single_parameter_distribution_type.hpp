@@ -15,6 +15,7 @@
 #ifndef OPENSCENARIO_INTERPRETER__DETERMINISTIC_SINGLE_PARAMETER_DISTRIBUTION_TYPE_HPP_
 #define OPENSCENARIO_INTERPRETER__DETERMINISTIC_SINGLE_PARAMETER_DISTRIBUTION_TYPE_HPP_
 
+#include <cstddef>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/distribution_range.hpp>
 #include <openscenario_interpreter/syntax/distribution_set.hpp>
@@ -39,6 +40,10 @@ inline namespace syntax
 struct DeterministicSingleParameterDistributionType : public Group
 {
   explicit DeterministicSingleParameterDistributionType(const pugi::xml_node &, Scope & scope);
+
+  auto getNumberOfDeriveScenarios() const -> std::size_t;
+
+  auto derive(std::size_t index) const -> String;
 };
 
 DEFINE_LAZY_VISITOR(
@@ -47,6 +52,13 @@ DEFINE_LAZY_VISITOR(
   CASE(DistributionRange),        //
   CASE(UserDefinedDistribution),  //
 );
+
+DEFINE_LAZY_VISITOR(
+  const DeterministicSingleParameterDistributionType,
+  CASE(DistributionSet),          //
+  CASE(DistributionRange),        //
+  CASE(UserDefinedDistribution),  //
+);
 }  // namespace syntax
 }  // namespace openscenario_interpreter
 #endif  // OPENSCENARIO_INTERPRETER__DETERMINISTIC_SINGLE_PARAMETER_DISTRIBUTION_TYPE_HPP_
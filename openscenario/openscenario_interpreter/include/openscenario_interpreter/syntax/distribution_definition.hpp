@@ -15,6 +15,8 @@
 #ifndef OPENSCENARIO_INTERPRETER__DISTRIBUTION_DEFINITION_HPP_
 #define OPENSCENARIO_INTERPRETER__DISTRIBUTION_DEFINITION_HPP_
 
+#include <cstddef>
+#include <openscenario_interpreter/parameter_distribution.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/deterministic.hpp>
 #include <openscenario_interpreter/syntax/stochastic.hpp>
@@ -37,6 +39,10 @@ inline namespace syntax
 struct DistributionDefinition : public Group
 {
   explicit DistributionDefinition(const pugi::xml_node &, Scope & scope);
+
+  auto getNumberOfDeriveScenarios() const -> std::size_t;
+
+  auto derive(std::size_t index) -> ParameterList;
 };
 
 DEFINE_LAZY_VISITOR(
@@ -45,6 +51,12 @@ DEFINE_LAZY_VISITOR(
   CASE(Stochastic),        //
 );
 
+DEFINE_LAZY_VISITOR(
+  const DistributionDefinition,  //
+  CASE(Deterministic),           //
+  CASE(Stochastic),              //
+);
+
 }  // namespace syntax
 }  // namespace openscenario_interpreter
 #endif  // OPENSCENARIO_INTERPRETER__DISTRIBUTION_DEFINITION_HPP_
@@ -15,8 +15,11 @@
 #ifndef OPENSCENARIO_INTERPRETER__SYNTAX__DISTRIBUTION_RANGE_HPP_
 #define OPENSCENARIO_INTERPRETER__SYNTAX__DISTRIBUTION_RANGE_HPP_
 
+#include <cstddef>
 #include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/double.hpp>
 #include <openscenario_interpreter/syntax/range.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
 #include <pugixml.hpp>
 
 namespace openscenario_interpreter
@@ -29,14 +32,21 @@ inline namespace syntax
  *    <xsd:all>
  *      <xsd:element name="Range" type="Range"/>
  *    </xsd:all>
+ *    <xsd:attribute name="stepWidth" type="Double" use="required"/>
  *  </xsd:complexType>
  *
  * -------------------------------------------------------------------------- */
 struct DistributionRange : private Scope, public ComplexType
 {
+  const Double step_width;
+
   const Range range;
 
   explicit DistributionRange(const pugi::xml_node &, Scope &);
+
+  auto getNumberOfDeriveScenarios() const -> std::size_t;
+
+  auto derive(std::size_t index) const -> String;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -15,6 +15,7 @@
 #ifndef OPENSCENARIO_INTERPRETER__DISTRIBUTION_SET_HPP_
 #define OPENSCENARIO_INTERPRETER__DISTRIBUTION_SET_HPP_
 
+#include <cstddef>
 #include <openscenario_interpreter/syntax/distribution_set_element.hpp>
 
 namespace openscenario_interpreter
@@ -35,6 +36,10 @@ struct DistributionSet : private Scope, public ComplexType
   const std::list<DistributionSetElement> elements;
 
   explicit DistributionSet(const pugi::xml_node &, Scope & scope);
+
+  auto getNumberOfDeriveScenarios() const -> std::size_t;
+
+  auto derive(std::size_t index) const -> String;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -15,6 +15,8 @@
 #ifndef OPENSCENARIO_INTERPRETER__STOCHASTIC_HPP_
 #define OPENSCENARIO_INTERPRETER__STOCHASTIC_HPP_
 
+#include <cstddef>
+#include <openscenario_interpreter/parameter_distribution.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/double.hpp>
 #include <openscenario_interpreter/syntax/stochastic_distribution.hpp>
@@ -47,6 +49,15 @@ struct Stochastic : public ComplexType
   const StochasticDistribution stochastic_distribution;
 
   explicit Stochastic(const pugi::xml_node &, Scope & scope);
+
+  auto getNumberOfDeriveScenarios() const -> std::size_t;
+
+  /*
+   * The value is sampled from the random engine of the distribution, which is seeded by
+   * randomSeed. So the derived values are reproducible when the scenarios are derived in order of
+   * the index, and the index itself does not select the sample.
+   */
+  auto derive(std::size_t index) -> ParameterList;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
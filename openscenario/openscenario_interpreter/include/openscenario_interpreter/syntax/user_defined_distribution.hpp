@@ -15,7 +15,9 @@
 #ifndef OPENSCENARIO_INTERPRETER__SYNTAX__USER_DEFINED_DISTRIBUTION_HPP_
 #define OPENSCENARIO_INTERPRETER__SYNTAX__USER_DEFINED_DISTRIBUTION_HPP_
 
+#include <cstddef>
 #include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
 #include <pugixml.hpp>
 
 namespace openscenario_interpreter
@@ -39,7 +41,15 @@ struct UserDefinedDistribution : private Scope, public ComplexType
 
   explicit UserDefinedDistribution(const pugi::xml_node &, const Scope &);
 
-  // TODO: implement evaluate()?`
+  /*
+   * The content of UserDefinedDistribution is interpreted by the user's own tool, so the
+   * following functions only report that no such interpretation is available.
+   */
+  auto getNumberOfDeriveScenarios() const -> std::size_t;
+
+  auto derive(std::size_t) const -> String;
+
+  auto evaluate() -> Object;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -15,6 +15,8 @@
 #ifndef OPENSCENARIO_INTERPRETER__VALUE_SET_DISTRIBUTION_HPP_
 #define OPENSCENARIO_INTERPRETER__VALUE_SET_DISTRIBUTION_HPP_
 
+#include <cstddef>
+#include <openscenario_interpreter/parameter_distribution.hpp>
 #include <openscenario_interpreter/syntax/file.hpp>
 #include <openscenario_interpreter/syntax/parameter_value_set.hpp>
 
@@ -37,7 +39,9 @@ struct ValueSetDistribution : public Scope
 
   explicit ValueSetDistribution(const pugi::xml_node &, Scope & scope);
 
-  // TODO: implement evaluate()
+  auto getNumberOfDeriveScenarios() const -> std::size_t;
+
+  auto derive(std::size_t index) const -> ParameterList;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -0,0 +1,45 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__UTILITY__XML_DOCUMENT_CACHE_HPP_
+#define OPENSCENARIO_INTERPRETER__UTILITY__XML_DOCUMENT_CACHE_HPP_
+
+#include <boost/filesystem/path.hpp>
+#include <functional>
+#include <memory>
+#include <pugixml.hpp>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+/*
+   Returns the parsed document of the given file. Documents are cached for the lifetime of the
+   process, keyed by the path of the file, together with the size and the hash of its content, so
+   a scenario or a catalog that is loaded again by the next on_configure is not parsed (or
+   converted) again unless the file has changed. The content itself is not kept. At most 1024
+   documents are cached, and the least recently used one is dropped first. The returned document
+   is shared and must not be modified.
+
+   `convert` turns the given file into the OpenSCENARIO file to be parsed (e.g. converts a YAML
+   scenario into XML). It is called only on a cache miss.
+*/
+auto loadXMLDocument(
+  const boost::filesystem::path &,
+  const std::function<boost::filesystem::path(const boost::filesystem::path &)> & convert =
+    [](const auto & path) { return path; }) -> std::shared_ptr<const pugi::xml_document>;
+}  // namespace utility
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__UTILITY__XML_DOCUMENT_CACHE_HPP_
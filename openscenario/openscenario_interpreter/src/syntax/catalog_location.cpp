@@ -18,6 +18,7 @@
 #include <openscenario_interpreter/syntax/catalog_location.hpp>
 #include <openscenario_interpreter/syntax/directory.hpp>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
+#include <openscenario_interpreter/utility/xml_document_cache.hpp>
 
 namespace openscenario_interpreter
 {
@@ -49,16 +50,15 @@ CatalogLocation::CatalogLocation(const pugi::xml_node & node, Scope & scope)
     THROW_SYNTAX_ERROR(directory.path.string() + " is not directory");
   }
 
-  for (auto path : Directory::ls(directory)) {
+  for (const auto & path : Directory::ls(directory)) {
     if (path.extension() == ".yaml") {
-      path = convertScenario(
-        path, boost::filesystem::path("/tmp/converted_scenario") / directory.path.filename());
-    } else if (path.extension() != ".xosc") {
-      continue;
+      catalog_files.push_back(loadXMLDocument(path, [&](const auto & yaml_path) {
+        return convertScenario(
+          yaml_path, boost::filesystem::path("/tmp/converted_scenario") / directory.path.filename());
+      }));
+    } else if (path.extension() == ".xosc") {
+      catalog_files.push_back(loadXMLDocument(path));
     }
-    auto new_document = std::make_shared<pugi::xml_document>();
-    new_document->load_file(path.string().c_str());
-    catalog_files.emplace_back(std::move(new_document));
   }
 
   for (auto && xml : catalog_files) {
@@ -12,12 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/simulator_core.hpp>
 #include <openscenario_interpreter/syntax/collision_condition.hpp>
 #include <openscenario_interpreter/syntax/entities.hpp>
 #include <openscenario_interpreter/syntax/entity.hpp>
 #include <openscenario_interpreter/syntax/entity_ref.hpp>
+#include <openscenario_interpreter/syntax/object_type.hpp>
+#include <openscenario_interpreter/syntax/scenario_object.hpp>
 
 namespace openscenario_interpreter
 {
@@ -30,7 +34,7 @@ CollisionCondition::CollisionCondition(
   another_given_entity(
     choice(node,
       std::make_pair("EntityRef", [&](auto && node) { return make<Entity>(node, scope); }),
-      std::make_pair("ByType",    [&](auto && node) { throw UNSUPPORTED_ELEMENT_SPECIFIED(node.name()); return unspecified; }))),
+      std::make_pair("ByType",    [&](auto && node) { return make<ObjectType>(readAttribute<ObjectType>("type", node, scope)); }))),
   triggering_entities(triggering_entities)
 // clang-format on
 {
@@ -40,11 +44,13 @@ auto CollisionCondition::description() const -> std::string
 {
   std::stringstream description;
 
-  description << triggering_entities.description() << " colliding with another given entity "
-              << another_given_entity << "?";
-
-  // TODO (yamacir-kit): If another_given_entity.is<ByType>(), description
-  // will be "Is any of [A, B, C] colliding with another T typed entities?"
+  if (another_given_entity.is<ObjectType>()) {
+    description << triggering_entities.description() << " colliding with another "
+                << another_given_entity.as<ObjectType>() << " typed entity?";
+  } else {
+    description << triggering_entities.description() << " colliding with another given entity "
+                << another_given_entity << "?";
+  }
 
   return description.str();
 }
@@ -60,8 +66,29 @@ auto CollisionCondition::evaluate() const -> Object
       });
       return not evaluation.size() or evaluation.min();
     }));
+  } else if (another_given_entity.is<ObjectType>()) {
+    const auto & colliding_pairs = evaluateCollidingPairs();
+    const auto is_typed = [&](const auto & name) {
+      if (const auto iter = global().entities->find(name); iter != global().entities->end()) {
+        return iter->second.template is<ScenarioObject>() and
+               iter->second.template as<ScenarioObject>().objectType() ==
+                 another_given_entity.as<ObjectType>();
+      } else {
+        return false;
+      }
+    };
+    return asBoolean(triggering_entities.apply([&](auto && triggering_entity) {
+      auto evaluation = triggering_entity.apply([&](const auto & object) {
+        const auto name = object.name();
+        return std::any_of(
+          colliding_pairs.begin(), colliding_pairs.end(), [&](const auto & colliding_pair) {
+            return (colliding_pair.first == name and is_typed(colliding_pair.second)) or
+                   (colliding_pair.second == name and is_typed(colliding_pair.first));
+          });
+      });
+      return not evaluation.size() or evaluation.min();
+    }));
   } else {
-    // TODO ByType
     return false_v;
   }
 }
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <limits>
+#include <openscenario_interpreter/error.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/deterministic.hpp>
 
@@ -24,5 +26,37 @@ Deterministic::Deterministic(const pugi::xml_node & node, Scope & scope)
     readGroups<DeterministicParameterDistribution, 0>(node, scope))
 {
 }
+
+auto Deterministic::getNumberOfDeriveScenarios() const -> std::size_t
+{
+  std::size_t number_of_derive_scenarios = 1;
+  for (const auto & distribution : deterministic_parameter_distributions) {
+    if (const auto size = distribution.getNumberOfDeriveScenarios();
+        size != 0 and std::numeric_limits<std::size_t>::max() / size < number_of_derive_scenarios) {
+      throw SemanticError(
+        "The number of scenarios derived from Deterministic exceeds ",
+        std::numeric_limits<std::size_t>::max());
+    } else {
+      number_of_derive_scenarios *= size;
+    }
+  }
+  return number_of_derive_scenarios;
+}
+
+auto Deterministic::derive(std::size_t index) const -> ParameterList
+{
+  ParameterList parameter_list;
+  /*
+     The index is decoded as a mixed radix number whose last digit is the index into the last
+     distribution, so the last distribution varies fastest.
+  */
+  for (auto iter = deterministic_parameter_distributions.rbegin();
+       iter != deterministic_parameter_distributions.rend(); ++iter) {
+    const auto size = iter->getNumberOfDeriveScenarios();
+    parameter_list.merge(iter->derive(index % size));
+    index /= size;
+  }
+  return parameter_list;
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
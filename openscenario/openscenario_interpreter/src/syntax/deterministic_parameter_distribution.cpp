@@ -29,5 +29,17 @@ DeterministicParameterDistribution::DeterministicParameterDistribution(
 // clang-format on
 {
 }
+
+auto DeterministicParameterDistribution::getNumberOfDeriveScenarios() const -> std::size_t
+{
+  return apply<std::size_t>(
+    [](const auto & distribution) { return distribution.getNumberOfDeriveScenarios(); }, *this);
+}
+
+auto DeterministicParameterDistribution::derive(std::size_t index) const -> ParameterList
+{
+  return apply<ParameterList>(
+    [&](const auto & distribution) { return distribution.derive(index); }, *this);
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
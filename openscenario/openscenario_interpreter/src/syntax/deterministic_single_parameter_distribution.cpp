@@ -25,5 +25,10 @@ DeterministicSingleParameterDistribution::DeterministicSingleParameterDistributi
   parameter_name(readAttribute<String>("parameterName", node, scope))
 {
 }
+
+auto DeterministicSingleParameterDistribution::derive(std::size_t index) const -> ParameterList
+{
+  return {{parameter_name, DeterministicSingleParameterDistributionType::derive(index)}};
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
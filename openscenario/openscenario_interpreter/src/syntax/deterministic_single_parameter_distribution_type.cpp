@@ -30,5 +30,18 @@ DeterministicSingleParameterDistributionType::DeterministicSingleParameterDistri
 // clang-format on
 {
 }
+
+auto DeterministicSingleParameterDistributionType::getNumberOfDeriveScenarios() const
+  -> std::size_t
+{
+  return apply<std::size_t>(
+    [](const auto & distribution) { return distribution.getNumberOfDeriveScenarios(); }, *this);
+}
+
+auto DeterministicSingleParameterDistributionType::derive(std::size_t index) const -> String
+{
+  return apply<String>(
+    [&](const auto & distribution) { return distribution.derive(index); }, *this);
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
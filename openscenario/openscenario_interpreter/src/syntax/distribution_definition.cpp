@@ -28,5 +28,17 @@ DistributionDefinition::DistributionDefinition(const pugi::xml_node & tree, Scop
 // clang-format on
 {
 }
+
+auto DistributionDefinition::getNumberOfDeriveScenarios() const -> std::size_t
+{
+  return apply<std::size_t>(
+    [](const auto & distribution) { return distribution.getNumberOfDeriveScenarios(); }, *this);
+}
+
+auto DistributionDefinition::derive(std::size_t index) -> ParameterList
+{
+  return apply<ParameterList>(
+    [&](auto & distribution) { return distribution.derive(index); }, *this);
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
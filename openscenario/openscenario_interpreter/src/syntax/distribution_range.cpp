@@ -12,6 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <boost/lexical_cast.hpp>
+#include <cmath>
+#include <limits>
+#include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/distribution_range.hpp>
 
@@ -20,8 +24,41 @@ namespace openscenario_interpreter
 inline namespace syntax
 {
 DistributionRange::DistributionRange(const pugi::xml_node & node, Scope & scope)
-: Scope(scope), range(readElement<Range>("Range", node, local()))
+: Scope(scope),
+  step_width(readAttribute<Double>("stepWidth", node, local())),
+  range(readElement<Range>("Range", node, local()))
 {
+  if (step_width <= 0 or range.upper_limit < range.lower_limit) {
+    throw SyntaxError(
+      "DistributionRange requires a positive stepWidth and a Range whose upperLimit is not less "
+      "than its lowerLimit, but stepWidth = ",
+      step_width, ", lowerLimit = ", range.lower_limit, ", upperLimit = ", range.upper_limit);
+  }
+}
+
+auto DistributionRange::getNumberOfDeriveScenarios() const -> std::size_t
+{
+  // NOTE: The tolerance keeps the upper limit in the range when (upper - lower) is a multiple of
+  // stepWidth but the division is rounded down, e.g. (1.0 - 0.0) / 0.1 = 9.999999999999998.
+  constexpr double tolerance = 1e-9;
+  if (const auto steps =
+        std::floor((range.upper_limit - range.lower_limit) / step_width + tolerance);
+      static_cast<double>(std::numeric_limits<std::size_t>::max()) <= steps) {
+    throw SemanticError(
+      "The number of scenarios derived from DistributionRange exceeds ",
+      std::numeric_limits<std::size_t>::max(), ", because stepWidth = ", step_width,
+      " is too small for lowerLimit = ", range.lower_limit, " and upperLimit = ",
+      range.upper_limit);
+  } else {
+    return static_cast<std::size_t>(steps) + 1;
+  }
+}
+
+auto DistributionRange::derive(std::size_t index) const -> String
+{
+  // NOTE: Multiplying instead of accumulating stepWidth keeps the rounding error from growing.
+  return boost::lexical_cast<String>(
+    range.lower_limit.data + step_width.data * static_cast<double>(index));
 }
 
 }  // namespace syntax
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <iterator>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/distribution_set.hpp>
 
@@ -23,5 +24,12 @@ DistributionSet::DistributionSet(const pugi::xml_node & node, Scope & scope)
 : Scope(scope), elements(readElements<DistributionSetElement, 1>("Element", node, local()))
 {
 }
+
+auto DistributionSet::getNumberOfDeriveScenarios() const -> std::size_t { return elements.size(); }
+
+auto DistributionSet::derive(std::size_t index) const -> String
+{
+  return std::next(elements.begin(), index)->value;
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
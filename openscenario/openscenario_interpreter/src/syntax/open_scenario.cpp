@@ -16,6 +16,7 @@
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
 #include <openscenario_interpreter/syntax/open_scenario_category.hpp>
 #include <openscenario_interpreter/syntax/scenario_definition.hpp>
+#include <openscenario_interpreter/utility/xml_document_cache.hpp>
 
 namespace openscenario_interpreter
 {
@@ -25,7 +26,7 @@ OpenScenario::OpenScenario(const boost::filesystem::path & pathname)
 : Scope(this),
   pathname(pathname),
   file_header(readElement<FileHeader>("FileHeader", load(pathname).child("OpenSCENARIO"), local())),
-  category(readElement<OpenScenarioCategory>("OpenSCENARIO", script, local()))
+  category(readElement<OpenScenarioCategory>("OpenSCENARIO", *script, local()))
 {
 }
 
@@ -37,11 +38,8 @@ auto OpenScenario::evaluate() -> Object
 
 auto OpenScenario::load(const boost::filesystem::path & filepath) -> const pugi::xml_node &
 {
-  if (const auto result = script.load_file(filepath.string().c_str()); not result) {
-    throw SyntaxError(result.description(), ": ", filepath);
-  } else {
-    return script;
-  }
+  script = loadXMLDocument(filepath);
+  return *script;
 }
 
 auto operator<<(nlohmann::json & json, const OpenScenario & datum) -> nlohmann::json &
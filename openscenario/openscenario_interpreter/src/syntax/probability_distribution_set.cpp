@@ -40,7 +40,7 @@ ProbabilityDistributionSet::ProbabilityDistributionSet(
 auto ProbabilityDistributionSet::evaluate() -> Object
 {
   size_t index = distribute(random_engine);
-  return elements.at(index);
+  return make<String>(adaptor.values.at(index));
 }
 }  // namespace syntax
 }  // namespace openscenario_interpreter
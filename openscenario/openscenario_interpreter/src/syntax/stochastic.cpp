@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <boost/lexical_cast.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/stochastic.hpp>
 
@@ -32,5 +33,22 @@ Stochastic::Stochastic(const pugi::xml_node & node, Scope & scope)
     readElement<StochasticDistribution>("StochasticDistribution", node, scope))
 {
 }
+
+auto Stochastic::getNumberOfDeriveScenarios() const -> std::size_t
+{
+  return number_of_test_runs;
+}
+
+auto Stochastic::derive(std::size_t) -> ParameterList
+{
+  // NOTE: The copy shares the distribution (and its random engine) with the original.
+  auto distribution = stochastic_distribution;
+  const auto value = apply<Object>([](auto & each) { return each.evaluate(); }, distribution);
+  if (value.is<Double>()) {
+    return {{distribution.parameter_name, boost::lexical_cast<String>(value.as<Double>().data)}};
+  } else {
+    return {{distribution.parameter_name, value.as<String>()}};
+  }
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
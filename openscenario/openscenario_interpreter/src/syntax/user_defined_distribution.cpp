@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/error.hpp>
 #include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/content.hpp>
 #include <openscenario_interpreter/syntax/user_defined_distribution.hpp>
@@ -24,5 +25,20 @@ UserDefinedDistribution::UserDefinedDistribution(const pugi::xml_node & node, co
 : Scope(scope), type(readAttribute<String>("type", node, local()))
 {
 }
+
+auto UserDefinedDistribution::getNumberOfDeriveScenarios() const -> std::size_t
+{
+  throw UNSUPPORTED_SETTING_DETECTED(UserDefinedDistribution, type);
+}
+
+auto UserDefinedDistribution::derive(std::size_t) const -> String
+{
+  throw UNSUPPORTED_SETTING_DETECTED(UserDefinedDistribution, type);
+}
+
+auto UserDefinedDistribution::evaluate() -> Object
+{
+  throw UNSUPPORTED_SETTING_DETECTED(UserDefinedDistribution, type);
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <iterator>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/value_set_distribution.hpp>
 
@@ -25,5 +26,20 @@ ValueSetDistribution::ValueSetDistribution(
   parameter_value_sets(readElements<ParameterValueSet, 1>("ParameterValueSet", node, scope))
 {
 }
+
+auto ValueSetDistribution::getNumberOfDeriveScenarios() const -> std::size_t
+{
+  return parameter_value_sets.size();
+}
+
+auto ValueSetDistribution::derive(std::size_t index) const -> ParameterList
+{
+  ParameterList parameter_list;
+  for (const auto & parameter_assignment :
+       std::next(parameter_value_sets.begin(), index)->parameter_assignments) {
+    parameter_list.emplace(parameter_assignment.parameterRef, parameter_assignment.value);
+  }
+  return parameter_list;
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
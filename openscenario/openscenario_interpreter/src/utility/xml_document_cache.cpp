@@ -0,0 +1,107 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <boost/filesystem/operations.hpp>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <openscenario_interpreter/error.hpp>
+#include <openscenario_interpreter/utility/xml_document_cache.hpp>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+auto loadXMLDocument(
+  const boost::filesystem::path & path,
+  const std::function<boost::filesystem::path(const boost::filesystem::path &)> & convert)
+  -> std::shared_ptr<const pugi::xml_document>
+{
+  /*
+     The number of distinct files loaded by one process is small in practice (the scenarios of a
+     workflow and their catalogs), but a long sweep of generated scenarios must not keep all of
+     them in memory, so the least recently used document is dropped beyond the capacity.
+  */
+  constexpr std::size_t capacity = 1024;
+
+  struct Entry
+  {
+    std::string path;
+
+    std::size_t size;
+
+    std::size_t hash;
+
+    std::shared_ptr<const pugi::xml_document> document;
+  };
+
+  static std::mutex mutex;
+
+  static std::list<Entry> entries;  // the most recently used first
+
+  static std::unordered_map<std::string, std::list<Entry>::iterator> index;
+
+  const auto content = [&]() {
+    std::ifstream ifs(path.string(), std::ios::binary);
+    if (not ifs) {
+      throw SyntaxError("Failed to open ", path);
+    } else {
+      std::stringstream buffer;
+      buffer << ifs.rdbuf();
+      return buffer.str();
+    }
+  }();
+
+  const auto key = boost::filesystem::absolute(path).lexically_normal().string();
+
+  const auto hash = std::hash<std::string_view>()(content);
+
+  {
+    auto lock = std::lock_guard(mutex);
+    if (auto iter = index.find(key); iter != index.end()) {
+      if (const auto & entry = *iter->second; entry.size == content.size() and entry.hash == hash) {
+        entries.splice(entries.begin(), entries, iter->second);
+        return entry.document;
+      }
+    }
+  }
+
+  auto document = std::make_shared<pugi::xml_document>();
+
+  if (const auto converted = convert(path); converted == path) {
+    if (const auto result = document->load_buffer(content.data(), content.size()); not result) {
+      throw SyntaxError(result.description(), ": ", path);
+    }
+  } else if (const auto result = document->load_file(converted.string().c_str()); not result) {
+    throw SyntaxError(result.description(), ": ", path);
+  }
+
+  auto lock = std::lock_guard(mutex);
+  if (auto iter = index.find(key); iter != index.end()) {
+    entries.erase(iter->second);
+    index.erase(iter);
+  } else if (capacity <= entries.size()) {
+    index.erase(entries.back().path);
+    entries.pop_back();
+  }
+  entries.push_front(Entry{key, content.size(), hash, std::move(document)});
+  index.emplace(key, entries.begin());
+  return entries.front().document;
+}
+}  // namespace utility
+}  // namespace openscenario_interpreter
@@ -0,0 +1,146 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <memory>
+#include <openscenario_interpreter/error.hpp>
+#include <openscenario_interpreter/syntax/open_scenario.hpp>
+#include <openscenario_interpreter/syntax/parameter_value_distribution.hpp>
+#include <set>
+#include <string>
+
+namespace
+{
+/// @note write a ParameterValueDistribution whose Deterministic element contains the given text
+auto writeDistribution(const std::string & file_name, const std::string & deterministic)
+  -> std::shared_ptr<openscenario_interpreter::OpenScenario>
+{
+  const auto path = boost::filesystem::temp_directory_path() / file_name;
+  std::ofstream(path.string())
+    << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    << "<OpenSCENARIO>\n"
+    << "  <FileHeader author=\"\" date=\"2022-01-01T00:00:00\" description=\"\" revMajor=\"1\" "
+    << "revMinor=\"2\"/>\n"
+    << "  <ParameterValueDistribution>\n"
+    << "    <ScenarioFile filepath=\"base.xosc\"/>\n"
+    << "    <Deterministic>\n"
+    << deterministic << "    </Deterministic>\n"
+    << "  </ParameterValueDistribution>\n"
+    << "</OpenSCENARIO>\n";
+  return std::make_shared<openscenario_interpreter::OpenScenario>(path);
+}
+
+auto distributionSet(const std::string & name, const std::set<std::string> & values)
+  -> std::string
+{
+  std::string text = "      <DeterministicSingleParameterDistribution parameterName=\"" + name +
+                     "\">\n        <DistributionSet>\n";
+  for (const auto & value : values) {
+    text += "          <Element value=\"" + value + "\"/>\n";
+  }
+  return text + "        </DistributionSet>\n      </DeterministicSingleParameterDistribution>\n";
+}
+
+auto distributionRange(
+  const std::string & name, const std::string & lower, const std::string & upper,
+  const std::string & step_width) -> std::string
+{
+  return "      <DeterministicSingleParameterDistribution parameterName=\"" + name +
+         "\">\n        <DistributionRange stepWidth=\"" + step_width +
+         "\">\n          <Range lowerLimit=\"" + lower + "\" upperLimit=\"" + upper +
+         "\"/>\n        </DistributionRange>\n"
+         "      </DeterministicSingleParameterDistribution>\n";
+}
+
+auto distribution(openscenario_interpreter::OpenScenario & script)
+  -> openscenario_interpreter::ParameterValueDistribution &
+{
+  return script.category.as<openscenario_interpreter::ParameterValueDistribution>();
+}
+}  // namespace
+
+/**
+ * @note Test calculation correctness. The index of a derived scenario must be decoded as a mixed
+ * radix number whose last digit selects the value of the last distribution, so that every
+ * combination is derived exactly once and the last distribution varies fastest.
+ */
+TEST(Deterministic, mixedRadix)
+{
+  const auto script = writeDistribution(
+    "test_deterministic_mixed_radix.xosc",
+    distributionSet("a", {"a0", "a1"}) + distributionSet("b", {"b0", "b1", "b2"}) +
+      distributionSet("c", {"c0", "c1"}));
+  ASSERT_EQ(distribution(*script).getNumberOfDeriveScenarios(), 12u);
+
+  std::set<std::string> combinations;
+  for (std::size_t index = 0; index < 12; ++index) {
+    auto parameter_list = distribution(*script).derive(index);
+    ASSERT_EQ(parameter_list.size(), 3u);
+    EXPECT_EQ(parameter_list["a"], "a" + std::to_string(index / 6));
+    EXPECT_EQ(parameter_list["b"], "b" + std::to_string(index / 2 % 3));
+    EXPECT_EQ(parameter_list["c"], "c" + std::to_string(index % 2));
+    combinations.insert(parameter_list["a"] + parameter_list["b"] + parameter_list["c"]);
+  }
+  EXPECT_EQ(combinations.size(), 12u);
+}
+
+/**
+ * @note Test calculation correctness. The upper limit of a DistributionRange must be derived when
+ * the range is a multiple of stepWidth, even if the division is rounded down, and must not be
+ * derived otherwise.
+ */
+TEST(DistributionRange, numberOfDeriveScenarios)
+{
+  const auto multiple = writeDistribution(
+    "test_distribution_range_multiple.xosc", distributionRange("x", "0", "1", "0.1"));
+  ASSERT_EQ(distribution(*multiple).getNumberOfDeriveScenarios(), 11u);
+  EXPECT_DOUBLE_EQ(std::stod(distribution(*multiple).derive(0)["x"]), 0.0);
+  EXPECT_DOUBLE_EQ(std::stod(distribution(*multiple).derive(10)["x"]), 1.0);
+
+  const auto not_multiple = writeDistribution(
+    "test_distribution_range_not_multiple.xosc", distributionRange("x", "0", "1", "0.3"));
+  ASSERT_EQ(distribution(*not_multiple).getNumberOfDeriveScenarios(), 4u);
+  EXPECT_DOUBLE_EQ(std::stod(distribution(*not_multiple).derive(3)["x"]), 0.9);
+
+  const auto single = writeDistribution(
+    "test_distribution_range_single.xosc", distributionRange("x", "2", "2", "0.5"));
+  EXPECT_EQ(distribution(*single).getNumberOfDeriveScenarios(), 1u);
+}
+
+/**
+ * @note Test function behavior when the number of derived scenarios does not fit in std::size_t.
+ * It must be reported instead of wrapping around to a smaller number.
+ */
+TEST(Deterministic, overflow)
+{
+  std::string distributions;
+  for (const auto & name : {"a", "b", "c", "d"}) {
+    distributions += distributionRange(name, "0", "1000000", "1");
+  }
+  const auto script = writeDistribution("test_deterministic_overflow.xosc", distributions);
+  EXPECT_THROW(distribution(*script).getNumberOfDeriveScenarios(), common::SemanticError);
+
+  const auto tiny_step = writeDistribution(
+    "test_distribution_range_overflow.xosc", distributionRange("x", "0", "1", "1e-300"));
+  EXPECT_THROW(distribution(*tiny_step).getNumberOfDeriveScenarios(), common::SemanticError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
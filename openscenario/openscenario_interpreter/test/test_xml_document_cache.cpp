@@ -0,0 +1,124 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <openscenario_interpreter/error.hpp>
+#include <openscenario_interpreter/utility/xml_document_cache.hpp>
+#include <string>
+
+namespace
+{
+auto writeFile(const boost::filesystem::path & path, const std::string & content)
+  -> boost::filesystem::path
+{
+  std::ofstream(path.string()) << content;
+  return path;
+}
+
+auto temporaryPath(const std::string & file_name) -> boost::filesystem::path
+{
+  return boost::filesystem::temp_directory_path() / file_name;
+}
+
+auto counting(int & count)
+{
+  return [&count](const boost::filesystem::path & path) {
+    ++count;
+    return path;
+  };
+}
+}  // namespace
+
+/**
+ * @note Test function behavior. Loading an unchanged file again must return the cached document
+ * without converting the file again.
+ */
+TEST(XMLDocumentCache, hit)
+{
+  const auto path = writeFile(temporaryPath("test_xml_document_cache_hit.xml"), "<a x=\"1\"/>");
+  int conversions = 0;
+  const auto first = openscenario_interpreter::loadXMLDocument(path, counting(conversions));
+  const auto second = openscenario_interpreter::loadXMLDocument(path, counting(conversions));
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(conversions, 1);
+  EXPECT_STREQ(second->child("a").attribute("x").value(), "1");
+}
+
+/**
+ * @note Test function behavior. A file that has changed must be parsed again, also when its size
+ * has not changed, and another file with the same content must not share the entry of the first.
+ */
+TEST(XMLDocumentCache, invalidation)
+{
+  const auto path =
+    writeFile(temporaryPath("test_xml_document_cache_invalidation.xml"), "<a x=\"1\"/>");
+  const auto first = openscenario_interpreter::loadXMLDocument(path);
+
+  writeFile(path, "<a x=\"2\"/>");
+  int conversions = 0;
+  const auto changed = openscenario_interpreter::loadXMLDocument(path, counting(conversions));
+  EXPECT_NE(first, changed);
+  EXPECT_EQ(conversions, 1);
+  EXPECT_STREQ(first->child("a").attribute("x").value(), "1");
+  EXPECT_STREQ(changed->child("a").attribute("x").value(), "2");
+  EXPECT_EQ(openscenario_interpreter::loadXMLDocument(path), changed);
+
+  const auto copy =
+    writeFile(temporaryPath("test_xml_document_cache_invalidation_copy.xml"), "<a x=\"2\"/>");
+  conversions = 0;
+  EXPECT_NE(openscenario_interpreter::loadXMLDocument(copy, counting(conversions)), changed);
+  EXPECT_EQ(conversions, 1);
+}
+
+/**
+ * @note Test function behavior when the capacity is exceeded. Only the least recently used
+ * document must be dropped, so a document that is used between the loads of many other files
+ * stays cached.
+ */
+TEST(XMLDocumentCache, leastRecentlyUsed)
+{
+  const auto directory = temporaryPath("test_xml_document_cache_least_recently_used");
+  boost::filesystem::create_directories(directory);
+
+  const auto used = writeFile(directory / "used.xml", "<used/>");
+  const auto unused = writeFile(directory / "unused.xml", "<unused/>");
+  const auto used_document = openscenario_interpreter::loadXMLDocument(used);
+  const auto unused_document = openscenario_interpreter::loadXMLDocument(unused);
+
+  for (int i = 0; i < 2048; ++i) {
+    openscenario_interpreter::loadXMLDocument(
+      writeFile(directory / (std::to_string(i) + ".xml"), "<a/>"));
+    EXPECT_EQ(openscenario_interpreter::loadXMLDocument(used), used_document);
+  }
+  EXPECT_NE(openscenario_interpreter::loadXMLDocument(unused), unused_document);
+}
+
+/**
+ * @note Test function behavior when the file cannot be loaded. The error must be reported, and
+ * must not be cached.
+ */
+TEST(XMLDocumentCache, error)
+{
+  EXPECT_THROW(
+    openscenario_interpreter::loadXMLDocument(temporaryPath("test_xml_document_cache_none.xml")),
+    common::SyntaxError);
+
+  const auto path = writeFile(temporaryPath("test_xml_document_cache_error.xml"), "<a>");
+  EXPECT_THROW(openscenario_interpreter::loadXMLDocument(path), common::SyntaxError);
+  writeFile(path, "<a/>");
+  EXPECT_NO_THROW(openscenario_interpreter::loadXMLDocument(path));
+}
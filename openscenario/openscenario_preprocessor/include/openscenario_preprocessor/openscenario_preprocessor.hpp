@@ -15,14 +15,25 @@
 #ifndef OPENSCENARIO_PREPROCESSOR__OPENSCENARIO_PREPROCESSOR_HPP_
 #define OPENSCENARIO_PREPROCESSOR__OPENSCENARIO_PREPROCESSOR_HPP_
 
-#include <concealer/execute.hpp>
+#include <boost/filesystem.hpp>
+#include <condition_variable>
+#include <cstddef>
 #include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <openscenario_interpreter/parameter_distribution.hpp>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
 #include <openscenario_preprocessor_msgs/srv/check_derivative_remained.hpp>
 #include <openscenario_preprocessor_msgs/srv/derive.hpp>
 #include <openscenario_preprocessor_msgs/srv/load.hpp>
+#include <openscenario_validator/validator.hpp>
+#include <optional>
+#include <pugixml.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace openscenario_preprocessor
 {
@@ -49,15 +60,89 @@ struct ScenarioSet
   float frame_rate;
 };
 
+/**
+ * @brief the scenarios derived from one loaded file
+ * @note A scenario without ParameterValueDistribution derives itself once. The parameter lists of
+ *       a ParameterValueDistribution are enumerated by index, and each derived scenario is written
+ *       only when it is taken, so queueing a sweep of thousands of combinations costs no more than
+ *       queueing one. The derived scenarios are written to the output directory, so relative file
+ *       paths in the base scenario are resolved against the directory of the base scenario.
+ */
+class Derivation
+{
+public:
+  explicit Derivation(
+    const ScenarioSet &, const boost::filesystem::path & output_directory,
+    openscenario_validator::OpenSCENARIOValidator &);
+
+  auto remained() const noexcept -> bool { return index < size; }
+
+  /**
+   * @brief stop deriving the rest of the scenarios, e.g. after one of them failed
+   */
+  auto cancel() noexcept -> void { index = size; }
+
+  /**
+   * @brief take the index and the parameter list of the next scenario
+   * @note Not thread safe, because stochastic distributions are sampled in order.
+   */
+  auto next() -> std::pair<std::size_t, openscenario_interpreter::ParameterList>;
+
+  /**
+   * @brief write the scenario derived with the given parameter list
+   * @note Thread safe, because the base scenario is only read.
+   */
+  auto embed(std::size_t index, const openscenario_interpreter::ParameterList &) const
+    -> ScenarioSet;
+
+private:
+  const ScenarioSet scenario;
+
+  std::shared_ptr<openscenario_interpreter::OpenScenario> script;
+
+  pugi::xml_document base_scenario;
+
+  boost::filesystem::path output_directory;
+
+  std::size_t size = 1;
+
+  std::size_t index = 0;
+};
+
 class Preprocessor : public rclcpp::Node
 {
 public:
   explicit Preprocessor(const rclcpp::NodeOptions &);
 
+  ~Preprocessor() override;
+
 private:
-  void preprocessScenario(ScenarioSet &);
+  struct Task
+  {
+    std::shared_ptr<Derivation> derivation;
+
+    std::size_t index;
+
+    openscenario_interpreter::ParameterList parameter_list;
 
-  [[nodiscard]] bool validateXOSC(const boost::filesystem::path &, bool);
+    std::size_t sequence;  // the order in which the derived scenario is delivered
+
+    auto operator()(openscenario_validator::OpenSCENARIOValidator &) const -> ScenarioSet;
+  };
+
+  auto takeTask() -> std::optional<Task>;
+
+  auto work() -> void;
+
+  auto derivativeRemained() const -> bool;
+
+  const boost::filesystem::path output_directory;
+
+  /*
+     0 means the scenarios are derived one by one in the ~/derive callback. Otherwise, as many
+     worker threads derive and validate the scenarios ahead of the ~/derive calls.
+  */
+  const std::size_t number_of_derivation_threads;
 
   rclcpp::Service<openscenario_preprocessor_msgs::srv::Load>::SharedPtr load_server;
 
@@ -66,9 +151,30 @@ private:
   rclcpp::Service<openscenario_preprocessor_msgs::srv::CheckDerivativeRemained>::SharedPtr
     check_server;
 
-  std::deque<ScenarioSet> preprocessed_scenarios;
+  std::deque<std::shared_ptr<Derivation>> derivations;
+
+  /*
+     The scenarios derived ahead by the worker threads, keyed by the sequence of their tasks. The
+     workers finish in any order, but the ~/derive calls deliver the scenarios in the order the
+     tasks were taken. A task that failed leaves std::nullopt, which is skipped.
+  */
+  std::map<std::size_t, std::optional<ScenarioSet>> preprocessed_scenarios;
+
+  std::size_t number_of_taken_tasks = 0;
+
+  std::size_t number_of_delivered_tasks = 0;
+
+  std::size_t number_of_running_tasks = 0;
+
+  bool is_shutting_down = false;
 
   std::mutex preprocessed_scenarios_mutex;
+
+  std::condition_variable preprocessed_scenarios_condition;
+
+  openscenario_validator::OpenSCENARIOValidator validate;  // used only by the service callbacks
+
+  std::vector<std::thread> workers;
 };
 }  // namespace openscenario_preprocessor
 
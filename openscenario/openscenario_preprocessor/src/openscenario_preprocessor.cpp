@@ -13,30 +13,133 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <iomanip>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
 #include <openscenario_interpreter/syntax/parameter_value_distribution.hpp>
 #include <openscenario_preprocessor/openscenario_preprocessor.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string_view>
 
 namespace openscenario_preprocessor
 {
+Derivation::Derivation(
+  const ScenarioSet & scenario, const boost::filesystem::path & output_directory,
+  openscenario_validator::OpenSCENARIOValidator & validate)
+: scenario(scenario)
+{
+  using openscenario_interpreter::OpenScenario;
+  using openscenario_interpreter::ParameterValueDistribution;
+
+  validate(scenario.path);
+
+  if (auto parsed = std::make_shared<OpenScenario>(scenario.path);
+      parsed->category.is<ParameterValueDistribution>()) {
+    const auto base_scenario_path = boost::filesystem::absolute(
+      parsed->category.as<ParameterValueDistribution>().scenario_file.filepath,
+      boost::filesystem::absolute(scenario.path).parent_path());
+    if (not boost::filesystem::exists(base_scenario_path)) {
+      throw common::Error("base scenario does not exist : " + base_scenario_path.string());
+    }
+    validate(base_scenario_path);
+    if (const auto result = base_scenario.load_file(base_scenario_path.c_str()); not result) {
+      throw common::Error(
+        "failed to load base scenario ", base_scenario_path, " : ", result.description());
+    }
+    /*
+       Each derived scenario is written to the output directory, where a path relative to the
+       base scenario no longer refers to the same file. A path that refers to a parameter is left
+       as it is, because it is resolved only when the scenario is interpreted.
+    */
+    for (const auto & node : base_scenario.select_nodes("//@filepath | //Directory/@path")) {
+      if (auto attribute = node.attribute();
+          std::string_view(attribute.value()).find('$') == std::string_view::npos and
+          boost::filesystem::path(attribute.value()).is_relative()) {
+        attribute.set_value(
+          boost::filesystem::absolute(attribute.value(), base_scenario_path.parent_path())
+            .lexically_normal()
+            .c_str());
+      }
+    }
+    script = parsed;
+    size = parsed->category.as<ParameterValueDistribution>().getNumberOfDeriveScenarios();
+    this->output_directory =
+      output_directory / boost::filesystem::path(scenario.path).stem() / base_scenario_path.stem();
+    boost::filesystem::create_directories(this->output_directory);
+  }
+}
+
+auto Derivation::next() -> std::pair<std::size_t, openscenario_interpreter::ParameterList>
+{
+  using openscenario_interpreter::ParameterValueDistribution;
+
+  const auto current_index = index++;
+  if (script) {
+    return {
+      current_index, script->category.as<ParameterValueDistribution>().derive(current_index)};
+  } else {
+    return {current_index, {}};
+  }
+}
+
+auto Derivation::embed(
+  std::size_t index, const openscenario_interpreter::ParameterList & parameter_list) const
+  -> ScenarioSet
+{
+  if (not script) {
+    return scenario;
+  }
+
+  pugi::xml_document derived_scenario;
+  derived_scenario.reset(base_scenario);
+
+  const auto parameter_declarations =
+    derived_scenario.document_element().child("ParameterDeclarations");
+  for (const auto & [name, value] : parameter_list) {
+    if (auto parameter_declaration = parameter_declarations.find_child_by_attribute(
+          "ParameterDeclaration", "name", name.c_str())) {
+      parameter_declaration.attribute("value").set_value(value.c_str());
+    } else {
+      throw common::Error(
+        "parameter ", std::quoted(name), " is not declared in the base scenario of ",
+        scenario.path);
+    }
+  }
+
+  auto derived = scenario;
+  derived.path = (output_directory / (std::to_string(index) + ".xosc")).string();
+  if (not derived_scenario.save_file(derived.path.c_str())) {
+    throw common::Error("failed to write derived scenario ", derived.path);
+  }
+  return derived;
+}
+
 Preprocessor::Preprocessor(const rclcpp::NodeOptions & options)
 : rclcpp::Node("openscenario_preprocessor", options),
+  output_directory(
+    declare_parameter<std::string>("output_directory", "/tmp/openscenario_preprocessor")),
+  number_of_derivation_threads(
+    std::max(declare_parameter<int>("number_of_derivation_threads", 0), 0)),
   load_server(create_service<openscenario_preprocessor_msgs::srv::Load>(
     "~/load",
     [this](
       const openscenario_preprocessor_msgs::srv::Load::Request::SharedPtr request,
       openscenario_preprocessor_msgs::srv::Load::Response::SharedPtr response) -> void {
-      auto lock = std::lock_guard(preprocessed_scenarios_mutex);
       try {
-        auto s = ScenarioSet(*request);
-        preprocessScenario(s);
+        auto derivation =
+          std::make_shared<Derivation>(ScenarioSet(*request), output_directory, validate);
+        auto lock = std::lock_guard(preprocessed_scenarios_mutex);
+        derivations.push_back(derivation);
+        preprocessed_scenarios_condition.notify_all();
         response->has_succeeded = true;
         response->message = "success";
       } catch (std::exception & e) {
+        auto lock = std::lock_guard(preprocessed_scenarios_mutex);
         response->has_succeeded = false;
         response->message = e.what();
+        derivations.clear();
         preprocessed_scenarios.clear();
+        number_of_delivered_tasks = number_of_taken_tasks;
       }
     })),
   derive_server(create_service<openscenario_preprocessor_msgs::srv::Derive>(
@@ -44,13 +147,40 @@ Preprocessor::Preprocessor(const rclcpp::NodeOptions & options)
     [this](
       const openscenario_preprocessor_msgs::srv::Derive::Request::SharedPtr,
       openscenario_preprocessor_msgs::srv::Derive::Response::SharedPtr response) -> void {
-      auto lock = std::lock_guard(preprocessed_scenarios_mutex);
-      if (preprocessed_scenarios.empty()) {
-        response->path = "no output";
+      auto lock = std::unique_lock(preprocessed_scenarios_mutex);
+      if (workers.empty()) {
+        while (auto task = takeTask()) {
+          number_of_delivered_tasks = number_of_taken_tasks;
+          try {
+            *response = (*task)(validate).getDeriveResponse();
+            return;
+          } catch (const std::exception & e) {
+            RCLCPP_ERROR_STREAM(get_logger(), e.what());
+            task->derivation->cancel();
+          }
+        }
       } else {
-        *response = preprocessed_scenarios.front().getDeriveResponse();
-        preprocessed_scenarios.pop_front();
+        while (true) {
+          preprocessed_scenarios_condition.wait(lock, [this]() {
+            return preprocessed_scenarios.count(number_of_delivered_tasks) or
+                   not derivativeRemained();
+          });
+          if (auto iter = preprocessed_scenarios.find(number_of_delivered_tasks);
+              iter == preprocessed_scenarios.end()) {
+            break;
+          } else {
+            const auto derived = std::move(iter->second);
+            preprocessed_scenarios.erase(iter);
+            ++number_of_delivered_tasks;
+            preprocessed_scenarios_condition.notify_all();
+            if (derived) {
+              *response = derived->getDeriveResponse();
+              return;
+            }
+          }
+        }
       }
+      response->path = "no output";
     })),
   check_server(create_service<openscenario_preprocessor_msgs::srv::CheckDerivativeRemained>(
     "~/check",
@@ -59,54 +189,99 @@ Preprocessor::Preprocessor(const rclcpp::NodeOptions & options)
       openscenario_preprocessor_msgs::srv::CheckDerivativeRemained::Response::SharedPtr response)
       -> void {
       auto lock = std::lock_guard(preprocessed_scenarios_mutex);
-      response->derivative_remained = not preprocessed_scenarios.empty();
+      response->derivative_remained = derivativeRemained();
     }))
 {
+  for (std::size_t i = 0; i < number_of_derivation_threads; ++i) {
+    workers.emplace_back(&Preprocessor::work, this);
+  }
 }
 
-bool Preprocessor::validateXOSC(const boost::filesystem::path & file_name, bool verbose = false)
+Preprocessor::~Preprocessor()
 {
-  auto result =
-    concealer::dollar("ros2 run openscenario_utility validation.py " + file_name.string());
-  if (verbose) {
-    std::cout << "validate : " << result << std::endl;
+  {
+    auto lock = std::lock_guard(preprocessed_scenarios_mutex);
+    is_shutting_down = true;
+    preprocessed_scenarios_condition.notify_all();
+  }
+  for (auto & worker : workers) {
+    worker.join();
   }
-  return result.find("All xosc files given are standard compliant.") != std::string::npos;
 }
 
-void Preprocessor::preprocessScenario(ScenarioSet & scenario)
+auto Preprocessor::Task::operator()(openscenario_validator::OpenSCENARIOValidator & validate) const
+  -> ScenarioSet
 {
-  using openscenario_interpreter::OpenScenario;
-  using openscenario_interpreter::ParameterValueDistribution;
-
-  if (validateXOSC(scenario.path)) {
-    if (auto script = std::make_shared<OpenScenario>(scenario.path);
-        script->category.is<ParameterValueDistribution>()) {
-      std::cout << "ParameterValueDistribution!!" << std::endl;
-      auto base_scenario_path =
-        script->category.as<ParameterValueDistribution>().scenario_file.filepath;
-      std::cout << "base_scenario_path : " << base_scenario_path << std::endl;
-      if (boost::filesystem::exists(base_scenario_path)) {
-        if (validateXOSC(base_scenario_path, true)) {
-          // TODO : implement in feature/parameter_value_distribution branch
-          //
-          //  parameters = evaluate( parameter_value_distribution( given scenario ) )
-          //  for( auto derived_scenario : embedParameter( linked scenario, parameters)
-          //    preprocessed_scenarios.emplace_back({derived_scenario, derive_server});
-        } else {
-          throw common::Error("base scenario is not valid : " + base_scenario_path.string());
-        }
-      } else {
-        throw common::Error("base scenario does not exist : " + base_scenario_path.string());
-      }
-      std::cout << "base scenario is valid!" << std::endl;
+  auto derived = derivation->embed(index, parameter_list);
+  validate(derived.path);
+  return derived;
+}
 
+auto Preprocessor::takeTask() -> std::optional<Task>
+{
+  while (not derivations.empty()) {
+    if (auto derivation = derivations.front(); derivation->remained()) {
+      auto [index, parameter_list] = derivation->next();
+      return Task{derivation, index, parameter_list, number_of_taken_tasks++};
     } else {
-      // normal scenario
-      preprocessed_scenarios.emplace_back(scenario);
+      derivations.pop_front();
     }
-  } else {
-    throw common::Error("the scenario file is not valid. Please check your scenario");
+  }
+  return std::nullopt;
+}
+
+auto Preprocessor::derivativeRemained() const -> bool
+{
+  /*
+     A task that was taken but not delivered yet is still running or waiting in
+     preprocessed_scenarios.
+  */
+  return number_of_delivered_tasks != number_of_taken_tasks or
+         std::any_of(derivations.begin(), derivations.end(), [](const auto & derivation) {
+           return derivation->remained();
+         });
+}
+
+auto Preprocessor::work() -> void
+{
+  /*
+     Each thread has its own validator, because a parser must not be shared between threads. The
+     workers derive at most twice as many scenarios as the threads ahead of the ~/derive calls,
+     so the derived files are written as fast as they are consumed.
+  */
+  openscenario_validator::OpenSCENARIOValidator validate;
+
+  const auto lookahead = 2 * number_of_derivation_threads;
+
+  auto lock = std::unique_lock(preprocessed_scenarios_mutex);
+
+  while (true) {
+    preprocessed_scenarios_condition.wait(lock, [&]() {
+      return is_shutting_down or
+             (not derivations.empty() and
+              preprocessed_scenarios.size() + number_of_running_tasks < lookahead);
+    });
+    if (is_shutting_down) {
+      return;
+    } else if (auto task = takeTask()) {
+      ++number_of_running_tasks;
+      lock.unlock();
+      std::optional<ScenarioSet> derived;
+      try {
+        derived = (*task)(validate);
+      } catch (const std::exception & e) {
+        RCLCPP_ERROR_STREAM(get_logger(), e.what());
+      }
+      lock.lock();
+      --number_of_running_tasks;
+      if (not derived) {
+        task->derivation->cancel();
+      }
+      if (number_of_delivered_tasks <= task->sequence) {  // not discarded by a failed ~/load
+        preprocessed_scenarios.emplace(task->sequence, std::move(derived));
+      }
+    }
+    preprocessed_scenarios_condition.notify_all();
   }
 }
 }  // namespace openscenario_preprocessor
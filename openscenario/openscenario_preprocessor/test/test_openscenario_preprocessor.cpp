@@ -0,0 +1,198 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <openscenario_preprocessor/openscenario_preprocessor.hpp>
+#include <pugixml.hpp>
+#include <string>
+#include <thread>
+
+namespace
+{
+/**
+ * @note write a base scenario that declares the parameter "speed" and refers to a map and a
+ * catalog by relative paths, and a ParameterValueDistribution that derives `size` scenarios from
+ * it, into a new directory
+ */
+auto writeScenarios(const std::string & directory_name, const std::size_t size)
+  -> boost::filesystem::path
+{
+  const auto directory = boost::filesystem::temp_directory_path() / directory_name;
+  boost::filesystem::remove_all(directory);
+  boost::filesystem::create_directories(directory);
+
+  const std::string file_header =
+    "  <FileHeader author=\"\" date=\"2022-01-01T00:00:00\" description=\"\" revMajor=\"1\" "
+    "revMinor=\"2\"/>\n";
+
+  std::ofstream((directory / "base.xosc").string())
+    << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    << "<OpenSCENARIO>\n"
+    << file_header << "  <ParameterDeclarations>\n"
+    << "    <ParameterDeclaration name=\"speed\" parameterType=\"double\" value=\"0\"/>\n"
+    << "    <ParameterDeclaration name=\"map\" parameterType=\"string\" value=\"map\"/>\n"
+    << "  </ParameterDeclarations>\n"
+    << "  <CatalogLocations>\n"
+    << "    <VehicleCatalog>\n"
+    << "      <Directory path=\"catalog\"/>\n"
+    << "    </VehicleCatalog>\n"
+    << "  </CatalogLocations>\n"
+    << "  <RoadNetwork>\n"
+    << "    <LogicFile filepath=\"../map/lanelet2_map.osm\"/>\n"
+    << "    <SceneGraphFile filepath=\"$map\"/>\n"
+    << "  </RoadNetwork>\n"
+    << "  <Entities/>\n"
+    << "  <Storyboard>\n"
+    << "    <Init>\n"
+    << "      <Actions/>\n"
+    << "    </Init>\n"
+    << "  </Storyboard>\n"
+    << "</OpenSCENARIO>\n";
+
+  std::ofstream distribution((directory / "distribution.xosc").string());
+  distribution << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+               << "<OpenSCENARIO>\n"
+               << file_header << "  <ParameterValueDistribution>\n"
+               << "    <ScenarioFile filepath=\"base.xosc\"/>\n"
+               << "    <Deterministic>\n"
+               << "      <DeterministicSingleParameterDistribution parameterName=\"speed\">\n"
+               << "        <DistributionSet>\n";
+  for (std::size_t i = 0; i < size; ++i) {
+    distribution << "          <Element value=\"" << i << "\"/>\n";
+  }
+  distribution << "        </DistributionSet>\n"
+               << "      </DeterministicSingleParameterDistribution>\n"
+               << "    </Deterministic>\n"
+               << "  </ParameterValueDistribution>\n"
+               << "</OpenSCENARIO>\n";
+
+  return directory;
+}
+
+auto attribute(const std::string & path, const std::string & query, const std::string & name)
+  -> std::string
+{
+  pugi::xml_document document;
+  EXPECT_TRUE(document.load_file(path.c_str()));
+  return document.select_node(query.c_str()).node().attribute(name.c_str()).value();
+}
+
+template <typename Service>
+auto call(
+  rclcpp::Node & client, const std::string & service_name,
+  const typename Service::Request::SharedPtr & request) -> typename Service::Response::SharedPtr
+{
+  auto service_client = client.create_client<Service>("openscenario_preprocessor/" + service_name);
+  EXPECT_TRUE(service_client->wait_for_service(std::chrono::seconds(10)));
+  auto future = service_client->async_send_request(request);
+  EXPECT_EQ(future.wait_for(std::chrono::seconds(60)), std::future_status::ready);
+  return future.get();
+}
+}  // namespace
+
+/**
+ * @note Test function behavior. Each derived scenario must embed its own value in the parameter
+ * declarations of the base scenario, and relative paths must still refer to the same files after
+ * the scenario is written to the output directory. The ScenarioFile is relative to the
+ * distribution, and paths that refer to a parameter are resolved by the interpreter.
+ */
+TEST(Derivation, embed)
+{
+  const auto directory = writeScenarios("test_derivation_embed", 3);
+  openscenario_preprocessor::ScenarioSet scenario;
+  scenario.path = (directory / "distribution.xosc").string();
+  scenario.frame_rate = 30;
+
+  openscenario_validator::OpenSCENARIOValidator validate;
+  openscenario_preprocessor::Derivation derivation(scenario, directory / "output", validate);
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    ASSERT_TRUE(derivation.remained());
+    const auto [index, parameter_list] = derivation.next();
+    EXPECT_EQ(index, i);
+    const auto derived = derivation.embed(index, parameter_list);
+    validate(derived.path);
+    EXPECT_EQ(derived.frame_rate, scenario.frame_rate);
+    EXPECT_EQ(
+      attribute(derived.path, "//ParameterDeclaration[@name='speed']", "value"),
+      std::to_string(i));
+    EXPECT_EQ(
+      attribute(derived.path, "//LogicFile", "filepath"),
+      (directory.parent_path() / "map" / "lanelet2_map.osm").string());
+    EXPECT_EQ(attribute(derived.path, "//Directory", "path"), (directory / "catalog").string());
+    EXPECT_EQ(attribute(derived.path, "//SceneGraphFile", "filepath"), "$map");
+  }
+  EXPECT_FALSE(derivation.remained());
+}
+
+/**
+ * @note Test function behavior. The worker threads derive the scenarios in any order, but ~/derive
+ * must deliver them in the order of their indices, and then report that none remains.
+ */
+TEST(Preprocessor, order)
+{
+  using openscenario_preprocessor_msgs::srv::CheckDerivativeRemained;
+  using openscenario_preprocessor_msgs::srv::Derive;
+  using openscenario_preprocessor_msgs::srv::Load;
+
+  constexpr std::size_t size = 32;
+  const auto directory = writeScenarios("test_preprocessor_order", size);
+
+  rclcpp::NodeOptions options;
+  options.parameter_overrides(
+    {{"output_directory", (directory / "output").string()}, {"number_of_derivation_threads", 4}});
+  auto preprocessor = std::make_shared<openscenario_preprocessor::Preprocessor>(options);
+  auto client = std::make_shared<rclcpp::Node>("test_preprocessor_order_client");
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(preprocessor);
+  executor.add_node(client);
+  std::thread spinner([&]() { executor.spin(); });
+
+  auto load_request = std::make_shared<Load::Request>();
+  load_request->path = (directory / "distribution.xosc").string();
+  load_request->frame_rate = 30;
+  EXPECT_TRUE(call<Load>(*client, "load", load_request)->has_succeeded);
+
+  for (std::size_t i = 0; i < size; ++i) {
+    const auto response = call<Derive>(*client, "derive", std::make_shared<Derive::Request>());
+    EXPECT_EQ(boost::filesystem::path(response->path).stem().string(), std::to_string(i));
+    EXPECT_EQ(
+      attribute(response->path, "//ParameterDeclaration[@name='speed']", "value"),
+      std::to_string(i));
+  }
+  EXPECT_FALSE(call<CheckDerivativeRemained>(
+                 *client, "check", std::make_shared<CheckDerivativeRemained::Request>())
+                 ->derivative_remained);
+  EXPECT_EQ(
+    call<Derive>(*client, "derive", std::make_shared<Derive::Request>())->path, "no output");
+
+  executor.cancel();
+  spinner.join();
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  const auto result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
@@ -18,11 +18,18 @@
 #include <ament_index_cpp/get_package_share_directory.hpp>
 #include <boost/filesystem.hpp>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <system_error>
+#include <xercesc/framework/XMLGrammarPool.hpp>
+#include <xercesc/internal/XMLGrammarPoolImpl.hpp>
 #include <xercesc/parsers/XercesDOMParser.hpp>
 #include <xercesc/sax/HandlerBase.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
+#include <xercesc/validators/common/Grammar.hpp>
 
 namespace openscenario_validator
 {
@@ -60,32 +67,80 @@ class OpenSCENARIOValidator
     }
   };
 
-  std::unique_ptr<xercesc::XercesDOMParser> parser;
-
-  ErrorHandler error_handler;
-
+  /*
+     The schema is parsed and fully checked only once per process. The parsed grammar is kept in a
+     locked grammar pool, which every parser of every thread reads without parsing the schema
+     again. The pool is owned by the lifecycle handler, so it is released before
+     XMLPlatformUtils::Terminate.
+  */
   struct XMLPlatformLifecycleHandler
   {
+    std::unique_ptr<xercesc::XMLGrammarPool> grammar_pool;
+
+    std::once_flag grammar_pool_once;
+
     XMLPlatformLifecycleHandler() { xercesc::XMLPlatformUtils::Initialize(); }
 
-    ~XMLPlatformLifecycleHandler() { xercesc::XMLPlatformUtils::Terminate(); }
+    ~XMLPlatformLifecycleHandler()
+    {
+      grammar_pool.reset();
+      xercesc::XMLPlatformUtils::Terminate();
+    }
+
+    auto getGrammarPool() -> xercesc::XMLGrammarPool &
+    {
+      std::call_once(grammar_pool_once, [this]() {
+        const auto memory_manager = xercesc::XMLPlatformUtils::fgMemoryManager;
+        auto pool = std::make_unique<xercesc::XMLGrammarPoolImpl>(memory_manager);
+        ErrorHandler error_handler;
+        xercesc::XercesDOMParser parser(nullptr, memory_manager, pool.get());
+        parser.setDoNamespaces(true);
+        parser.setDoSchema(true);
+        parser.setErrorHandler(&error_handler);
+        parser.setValidationSchemaFullChecking(true);
+        parser.loadGrammar(schema().c_str(), xercesc::Grammar::SchemaGrammarType, true);
+        pool->lockPool();
+        grammar_pool = std::move(pool);
+      });
+      return *grammar_pool;
+    }
   };
 
   static inline XMLPlatformLifecycleHandler xml_platform_lifecycle_handler;
 
+  std::unique_ptr<xercesc::SAX2XMLReader> parser;
+
+  ErrorHandler error_handler;
+
+  std::unique_ptr<XMLCh, void (*)(XMLCh *)> schema_location;
+
 public:
-  OpenSCENARIOValidator() : parser(std::make_unique<xercesc::XercesDOMParser>())
+  static auto schema() -> std::string
   {
-    parser->setDoNamespaces(true);
-    parser->setDoSchema(true);
-    parser->setErrorHandler(&error_handler);
-    parser->setValidationSchemaFullChecking(true);
-    parser->setValidationScheme(xercesc::XercesDOMParser::Val_Always);
+    return ament_index_cpp::get_package_share_directory("openscenario_validator") +
+           "/schema/OpenSCENARIO-1.3.xsd";
+  }
 
-    parser->setExternalNoNamespaceSchemaLocation(
-      (ament_index_cpp::get_package_share_directory("openscenario_validator") +
-       "/schema/OpenSCENARIO-1.3.xsd")
-        .c_str());
+  /*
+     The file is validated while it is streamed through a SAX parser, so no DOM tree is built. A
+     parser must not be shared between threads, so construct one validator per thread.
+  */
+  OpenSCENARIOValidator()
+  : parser(xercesc::XMLReaderFactory::createXMLReader(
+      xercesc::XMLPlatformUtils::fgMemoryManager,
+      &xml_platform_lifecycle_handler.getGrammarPool())),
+    schema_location(xercesc::XMLString::transcode(schema().c_str()), [](XMLCh * string) {
+      xercesc::XMLString::release(&string);
+    })
+  {
+    parser->setFeature(xercesc::XMLUni::fgSAX2CoreNameSpaces, true);
+    parser->setFeature(xercesc::XMLUni::fgSAX2CoreValidation, true);
+    parser->setFeature(xercesc::XMLUni::fgXercesDynamic, false);
+    parser->setFeature(xercesc::XMLUni::fgXercesSchema, true);
+    parser->setFeature(xercesc::XMLUni::fgXercesUseCachedGrammarInParse, true);
+    parser->setErrorHandler(&error_handler);
+    parser->setProperty(
+      xercesc::XMLUni::fgXercesSchemaExternalNoNameSpaceSchemaLocation, schema_location.get());
   }
 
   auto validate(const boost::filesystem::path & xml_file) -> void
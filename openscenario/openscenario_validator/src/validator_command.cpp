@@ -12,18 +12,106 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <iomanip>
+#include <mutex>
 #include <openscenario_validator/validator.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
 
+/*
+   Usage: validate [--jobs N] [FILE...]
+
+   Without FILE, the paths are read from the standard input one per line, so a long-lived process
+   validates a stream of scenarios without paying for the startup and the schema loading per file.
+   The files are validated by N threads, each of which has its own parser.
+*/
 int main(int argc, char * argv[])
 {
-  assert(argc == 2);
-  std::string file_path = argv[1];
-  openscenario_validator::OpenSCENARIOValidator validate;
+  std::size_t jobs = 1;
+
+  std::vector<std::string> files;
+
+  for (int i = 1; i < argc; ++i) {
+    if (const auto argument = std::string(argv[i]); argument == "-j" or argument == "--jobs") {
+      const auto value = i + 1 < argc ? std::string_view(argv[++i]) : std::string_view();
+      const auto last = value.data() + value.size();
+      if (const auto [end, error] = std::from_chars(value.data(), last, jobs);
+          value.empty() or error != std::errc() or end != last or jobs == 0) {
+        std::cerr << "usage: validate [--jobs N] [FILE...]\n"
+                  << argument << " requires a positive integer, but " << std::quoted(value)
+                  << " is given." << std::endl;
+        return 2;
+      }
+    } else {
+      files.push_back(argument);
+    }
+  }
+
+  std::mutex mutex;  // guards the input and the standard error output
+
+  auto take = [&, index = std::size_t(0)]() mutable -> std::optional<std::string> {
+    auto lock = std::lock_guard(mutex);
+    if (not files.empty()) {
+      return index < files.size() ? std::make_optional(files[index++]) : std::nullopt;
+    } else if (std::string line; std::getline(std::cin, line)) {
+      return line;
+    } else {
+      return std::nullopt;
+    }
+  };
+
+  std::atomic<std::size_t> number_of_valid_files = 0;
+
+  std::atomic<std::size_t> number_of_invalid_files = 0;
+
   try {
-    validate(file_path);
-    return 0;
+    // NOTE: The first construction parses the schema, so a broken installation fails here once.
+    openscenario_validator::OpenSCENARIOValidator{};
   } catch (const std::exception & e) {
     std::cerr << e.what() << std::endl;
     return 1;
   }
+
+  const auto begin = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> workers;
+
+  for (std::size_t i = 0; i < jobs; ++i) {
+    workers.emplace_back([&]() {
+      openscenario_validator::OpenSCENARIOValidator validate;
+      while (const auto file = take()) {
+        try {
+          validate(*file);
+          ++number_of_valid_files;
+        } catch (const std::exception & e) {
+          ++number_of_invalid_files;
+          auto lock = std::lock_guard(mutex);
+          std::cerr << e.what() << std::endl;
+        }
+      }
+    });
+  }
+
+  for (auto & worker : workers) {
+    worker.join();
+  }
+
+  const auto seconds =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  const auto number_of_files = number_of_valid_files + number_of_invalid_files;
+
+  std::cerr << number_of_files << " files (" << number_of_invalid_files << " invalid) validated in "
+            << std::fixed << std::setprecision(3) << seconds << " s with " << jobs
+            << " threads, " << (seconds > 0 ? number_of_files / seconds : 0) << " files/s"
+            << std::endl;
+
+  return number_of_invalid_files == 0 ? 0 : 1;
 }
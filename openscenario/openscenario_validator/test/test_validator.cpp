@@ -0,0 +1,96 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <openscenario_validator/validator.hpp>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/// @note write a minimal scenario, which is invalid if `storyboard` is false
+auto writeScenario(const std::string & file_name, const bool storyboard) -> std::string
+{
+  const auto path = (boost::filesystem::temp_directory_path() / file_name).string();
+  std::ofstream(path) << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                      << "<OpenSCENARIO>\n"
+                      << "  <FileHeader author=\"\" date=\"2022-01-01T00:00:00\" description=\"\" "
+                      << "revMajor=\"1\" revMinor=\"3\"/>\n"
+                      << "  <CatalogLocations/>\n"
+                      << "  <RoadNetwork/>\n"
+                      << "  <Entities/>\n"
+                      << (storyboard ? "  <Storyboard><Init><Actions/></Init></Storyboard>\n" : "")
+                      << "</OpenSCENARIO>\n";
+  return path;
+}
+}  // namespace
+
+/**
+ * @note Test function behavior. A validator must accept a valid scenario and reject an invalid one,
+ * and must stay usable after it rejected a scenario.
+ */
+TEST(OpenSCENARIOValidator, validate)
+{
+  const auto valid = writeScenario("test_validator_valid.xosc", true);
+  const auto invalid = writeScenario("test_validator_invalid.xosc", false);
+
+  openscenario_validator::OpenSCENARIOValidator validate;
+  EXPECT_NO_THROW(validate(valid));
+  EXPECT_THROW(validate(invalid), std::runtime_error);
+  EXPECT_NO_THROW(validate(valid));
+}
+
+/**
+ * @note Test function behavior in the parallel path of the validate command. Validators of
+ * several threads share the parsed schema, and each of them must report exactly the invalid files
+ * it validated.
+ */
+TEST(OpenSCENARIOValidator, parallel)
+{
+  const auto valid = writeScenario("test_validator_parallel_valid.xosc", true);
+  const auto invalid = writeScenario("test_validator_parallel_invalid.xosc", false);
+
+  constexpr int number_of_threads = 8;
+  constexpr int number_of_files_per_thread = 50;
+
+  std::atomic<int> number_of_valid_files = 0;
+  std::atomic<int> number_of_invalid_files = 0;
+
+  std::vector<std::thread> workers;
+  for (int i = 0; i < number_of_threads; ++i) {
+    workers.emplace_back([&]() {
+      openscenario_validator::OpenSCENARIOValidator validate;
+      for (int j = 0; j < number_of_files_per_thread; ++j) {
+        try {
+          validate(j % 5 == 0 ? invalid : valid);
+          ++number_of_valid_files;
+        } catch (const std::runtime_error &) {
+          ++number_of_invalid_files;
+        }
+      }
+    });
+  }
+  for (auto & worker : workers) {
+    worker.join();
+  }
+
+  EXPECT_EQ(number_of_invalid_files, number_of_threads * number_of_files_per_thread / 5);
+  EXPECT_EQ(number_of_valid_files, number_of_threads * number_of_files_per_thread * 4 / 5);
+}
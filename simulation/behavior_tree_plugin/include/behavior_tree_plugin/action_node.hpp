@@ -18,6 +18,7 @@
 #include <behaviortree_cpp_v3/action_node.h>
 
 #include <algorithm>
+#include <functional>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <memory>
 #include <optional>
@@ -55,6 +56,9 @@ public:
   auto getDistanceToStopLine(
     const lanelet::Ids & route_lanelets,
     const std::vector<geometry_msgs::msg::Point> & waypoints) const -> std::optional<double>;
+  auto getDistanceToStopLine(
+    const lanelet::Ids & route_lanelets,
+    const math::geometry::CatmullRomSplineInterface & spline) const -> std::optional<double>;
   auto getDistanceToTrafficLightStopLine(
     const lanelet::Ids & route_lanelets,
     const math::geometry::CatmullRomSplineInterface & spline) const -> std::optional<double>;
@@ -134,6 +138,10 @@ private:
     -> std::optional<traffic_simulator::CanonicalizedEntityStatus>;
   auto getConflictingEntityStatusOnCrossWalk(const lanelet::Ids & route_lanelets) const
     -> std::vector<traffic_simulator::CanonicalizedEntityStatus>;
+  auto getDistanceToRegulatoryFeature(
+    const lanelet::Ids & route_lanelets, const math::geometry::CatmullRomSplineInterface & spline,
+    const std::function<bool(const hdmap_utils::RegulatoryFeature &)> & predicate) const
+    -> std::optional<std::optional<double>>;
   auto getConflictingEntityStatusOnLane(const lanelet::Ids & route_lanelets) const
     -> std::vector<traffic_simulator::CanonicalizedEntityStatus>;
 };
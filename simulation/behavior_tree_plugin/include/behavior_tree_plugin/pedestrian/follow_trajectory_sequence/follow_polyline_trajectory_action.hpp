@@ -16,6 +16,8 @@
 #define BEHAVIOR_TREE_PLUGIN__PEDESTRIAN__FOLLOW_POLYLINE_TRAJECTORY_ACTION_HPP_
 
 #include <behavior_tree_plugin/pedestrian/pedestrian_action_node.hpp>
+#include <optional>
+#include <traffic_simulator/behavior/polyline_trajectory_cursor.hpp>
 
 namespace entity_behavior
 {
@@ -25,6 +27,13 @@ struct FollowPolylineTrajectoryAction : public PedestrianActionNode
 {
   std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> polyline_trajectory;
 
+  /*
+     polyline_trajectory preprocessed once per assignment, see
+     getPolylineTrajectoryCursor.
+  */
+  std::optional<traffic_simulator::follow_trajectory::PolylineTrajectoryCursor>
+    polyline_trajectory_cursor;
+
   using PedestrianActionNode::PedestrianActionNode;
 
   auto calculateWaypoints() -> const traffic_simulator_msgs::msg::WaypointsArray;
@@ -35,6 +44,10 @@ struct FollowPolylineTrajectoryAction : public PedestrianActionNode
   static auto providedPorts() -> BT::PortsList;
 
   auto tick() -> BT::NodeStatus override;
+
+private:
+  auto getPolylineTrajectoryCursor()
+    -> traffic_simulator::follow_trajectory::PolylineTrajectoryCursor &;
 };
 }  // namespace pedestrian
 }  // namespace entity_behavior
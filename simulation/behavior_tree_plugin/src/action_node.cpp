@@ -195,22 +195,47 @@ auto ActionNode::getRightOfWayEntities() const
   return ret;
 }
 
+auto ActionNode::getDistanceToRegulatoryFeature(
+  const lanelet::Ids & route_lanelets, const math::geometry::CatmullRomSplineInterface & spline,
+  const std::function<bool(const hdmap_utils::RegulatoryFeature &)> & predicate) const
+  -> std::optional<std::optional<double>>
+{
+  /**
+   * @note The precomputed index can be used only if the spline starts at the entity and follows the
+   *       route, as the trajectories of the follow lane sequence do. Otherwise std::nullopt is
+   *       returned and the caller falls back to intersecting the spline with the features.
+   */
+  if (
+    canonicalized_entity_status->laneMatchingSucceed() and
+    hdmap_utils->isInRoute(canonicalized_entity_status->getLaneletId(), route_lanelets)) {
+    return hdmap_utils->getDistanceToRegulatoryFeature(
+      route_lanelets, canonicalized_entity_status->getLaneletPose(), predicate, spline.getLength());
+  } else {
+    return std::nullopt;
+  }
+}
+
 auto ActionNode::getDistanceToTrafficLightStopLine(
   const lanelet::Ids & route_lanelets,
   const math::geometry::CatmullRomSplineInterface & spline) const -> std::optional<double>
 {
+  const auto is_stop_signal = [this](const lanelet::Id traffic_light_id) {
+    return traffic_light_manager->getTrafficLight(traffic_light_id).isStopSignal();
+  };
+  if (const auto distance = getDistanceToRegulatoryFeature(
+        route_lanelets, spline, [&](const auto & feature) {
+          return feature.type == hdmap_utils::RegulatoryFeature::Type::TRAFFIC_LIGHT_STOP_LINE and
+                 is_stop_signal(feature.id);
+        })) {
+    return distance.value();
+  }
   const auto traffic_light_ids = hdmap_utils->getTrafficLightIdsOnPath(route_lanelets);
   if (traffic_light_ids.empty()) {
     return std::nullopt;
   }
   std::set<double> collision_points = {};
   for (const auto id : traffic_light_ids) {
-    using Color = traffic_simulator::TrafficLight::Color;
-    using Status = traffic_simulator::TrafficLight::Status;
-    using Shape = traffic_simulator::TrafficLight::Shape;
-    if (auto && traffic_light = traffic_light_manager->getTrafficLight(id);
-        traffic_light.contains(Color::red, Status::solid_on, Shape::circle) or
-        traffic_light.contains(Color::yellow, Status::solid_on, Shape::circle)) {
+    if (is_stop_signal(id)) {
       const auto collision_point = hdmap_utils->getDistanceToTrafficLightStopLine(spline, id);
       if (collision_point) {
         collision_points.insert(collision_point.value());
@@ -230,6 +255,20 @@ auto ActionNode::getDistanceToStopLine(
   return hdmap_utils->getDistanceToStopLine(route_lanelets, waypoints);
 }
 
+auto ActionNode::getDistanceToStopLine(
+  const lanelet::Ids & route_lanelets,
+  const math::geometry::CatmullRomSplineInterface & spline) const -> std::optional<double>
+{
+  if (const auto distance = getDistanceToRegulatoryFeature(
+        route_lanelets, spline, [](const auto & feature) {
+          return feature.type == hdmap_utils::RegulatoryFeature::Type::STOP_LINE;
+        })) {
+    return distance.value();
+  } else {
+    return hdmap_utils->getDistanceToStopLine(route_lanelets, spline);
+  }
+}
+
 auto ActionNode::getDistanceToFrontEntity(
   const math::geometry::CatmullRomSplineInterface & spline) const -> std::optional<double>
 {
@@ -331,10 +370,26 @@ auto ActionNode::getDistanceToConflictingEntity(
   auto crosswalk_entity_status = getConflictingEntityStatusOnCrossWalk(route_lanelets);
   auto lane_entity_status = getConflictingEntityStatusOnLane(route_lanelets);
   std::set<double> distances;
-  for (const auto & status : crosswalk_entity_status) {
-    const auto s = getDistanceToTargetEntityOnCrosswalk(spline, status);
-    if (s) {
-      distances.insert(s.value());
+  if (not crosswalk_entity_status.empty()) {
+    std::set<lanelet::Id> occupied_crosswalk_ids;
+    for (const auto & status : crosswalk_entity_status) {
+      occupied_crosswalk_ids.insert(status.getLaneletId());
+    }
+    if (const auto distance = getDistanceToRegulatoryFeature(
+          route_lanelets, spline, [&](const auto & feature) {
+            return feature.type == hdmap_utils::RegulatoryFeature::Type::CROSSWALK and
+                   occupied_crosswalk_ids.count(feature.id);
+          })) {
+      if (distance.value()) {
+        distances.insert(distance.value().value());
+      }
+    } else {
+      for (const auto & status : crosswalk_entity_status) {
+        const auto s = getDistanceToTargetEntityOnCrosswalk(spline, status);
+        if (s) {
+          distances.insert(s.value());
+        }
+      }
     }
   }
   for (const auto & status : lane_entity_status) {
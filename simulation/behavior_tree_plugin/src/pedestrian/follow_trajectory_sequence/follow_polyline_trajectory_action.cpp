@@ -21,9 +21,11 @@ namespace pedestrian
 auto FollowPolylineTrajectoryAction::calculateWaypoints()
   -> const traffic_simulator_msgs::msg::WaypointsArray
 {
+  const auto & cursor = getPolylineTrajectoryCursor();
   auto waypoints = traffic_simulator_msgs::msg::WaypointsArray();
+  waypoints.waypoints.reserve(cursor.size() + 1);
   waypoints.waypoints.push_back(canonicalized_entity_status->getMapPose().position);
-  for (const auto & vertex : polyline_trajectory->shape.vertices) {
+  for (const auto & vertex : cursor.getRemainingVertices()) {
     waypoints.waypoints.push_back(vertex.position.position);
   }
   return waypoints;
@@ -54,6 +56,24 @@ auto FollowPolylineTrajectoryAction::providedPorts() -> BT::PortsList
   return ports;
 }
 
+auto FollowPolylineTrajectoryAction::getPolylineTrajectoryCursor()
+  -> traffic_simulator::follow_trajectory::PolylineTrajectoryCursor &
+{
+  /*
+     A new FollowTrajectoryAction always comes with a new polyline_trajectory,
+     so the cursor is rebuilt only when the pointer changes.
+  */
+  if (
+    not polyline_trajectory_cursor or
+    polyline_trajectory_cursor->getTrajectory() != polyline_trajectory) {
+    polyline_trajectory_cursor.emplace(
+      traffic_simulator::follow_trajectory::makePolylineTrajectoryCursor(
+        polyline_trajectory, canonicalized_entity_status->getBoundingBox(), hdmap_utils,
+        default_matching_distance_for_lanelet_pose_calculation));
+  }
+  return polyline_trajectory_cursor.value();
+}
+
 auto FollowPolylineTrajectoryAction::tick() -> BT::NodeStatus
 {
   auto getTargetSpeed = [&]() -> double {
@@ -77,7 +97,7 @@ auto FollowPolylineTrajectoryAction::tick() -> BT::NodeStatus
   } else if (
     const auto entity_status_updated = traffic_simulator::follow_trajectory::makeUpdatedStatus(
       static_cast<traffic_simulator::EntityStatus>(*canonicalized_entity_status),
-      *polyline_trajectory, behavior_parameter, hdmap_utils, step_time,
+      getPolylineTrajectoryCursor(), behavior_parameter, hdmap_utils, step_time,
       default_matching_distance_for_lanelet_pose_calculation, getTargetSpeed())) {
     setCanonicalizedEntityStatus(entity_status_updated.value());
     setOutput("waypoints", calculateWaypoints());
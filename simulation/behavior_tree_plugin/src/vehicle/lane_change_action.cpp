@@ -119,10 +119,11 @@ BT::NodeStatus LaneChangeAction::tick()
           10.0 is a maximum_curvature_threshold (If the curvature of the trajectory is over 10.0, the trajectory was not selected.)
           20.0 is a target_trajectory_length (The one with the closest length to 20 m is selected from the candidate trajectories.)
           1.0 is a forward_distance_threshold (If the goal x position in the cartesian coordinate was under 1.0, the goal was rejected.)
+          50 is a maximum_number_of_candidates (The goals are 1 m apart, so only the ones within about 50 m ahead, over twice the target_trajectory_length, are evaluated.)
           */
           traj_with_goal = hdmap_utils->getLaneChangeTrajectory(
             hdmap_utils->toMapPose(lanelet_pose).pose, lane_change_parameters_.value(), 10.0, 20.0,
-            1.0);
+            1.0, 50);
           along_pose = hdmap_utils->getAlongLaneletPose(
             lanelet_pose, traffic_simulator::lane_change::Parameter::default_lanechange_distance);
           break;
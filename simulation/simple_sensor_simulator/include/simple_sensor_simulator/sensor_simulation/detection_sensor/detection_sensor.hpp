@@ -55,6 +55,8 @@ public:
     const double current_simulation_time, const std::vector<traffic_simulator_msgs::EntityStatus> &,
     const rclcpp::Time & current_ros_time,
     const std::vector<std::string> & lidar_detected_entities) = 0;
+
+  auto getEntityName() const -> const std::string & { return configuration_.entity(); }
 };
 
 template <typename T, typename U = autoware_auto_perception_msgs::msg::TrackedObjects>
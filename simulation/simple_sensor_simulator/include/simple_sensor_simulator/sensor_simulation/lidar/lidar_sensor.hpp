@@ -53,6 +53,8 @@ public:
     const rclcpp::Time & current_ros_time) -> void = 0;
 
   auto getDetectedObjects() const -> const std::vector<std::string> & { return detected_objects_; }
+
+  auto getEntityName() const -> const std::string & { return configuration_.entity(); }
 };
 
 template <typename T>
@@ -56,6 +56,8 @@ public:
     const rclcpp::Time & current_ros_time,
     const std::vector<std::string> & lidar_detected_entities) = 0;
 
+  auto getEntityName() const -> const std::string & { return configuration_.entity(); }
+
   /**
    * @brief List all objects in range of sensor sight
    * @warning `status` must contain EGO object
@@ -29,6 +29,8 @@
 #include <simple_sensor_simulator/sensor_simulation/lidar/lidar_sensor.hpp>
 #include <simple_sensor_simulator/sensor_simulation/occupancy_grid/occupancy_grid_sensor.hpp>
 #include <simple_sensor_simulator/sensor_simulation/traffic_lights/traffic_lights_detector.hpp>
+#include <string>
+#include <traffic_simulator/helper/frame_profiler.hpp>
 #include <vector>
 
 namespace simple_sensor_simulator
@@ -38,13 +40,14 @@ class SensorSimulation
 public:
   auto attachLidarSensor(
     const double current_simulation_time,
-    const simulation_api_schema::LidarConfiguration & configuration, rclcpp::Node & node) -> void
+    const simulation_api_schema::LidarConfiguration & configuration, rclcpp::Node & node,
+    const std::string & topic_namespace) -> void
   {
     if (configuration.architecture_type().find("awf/universe") != std::string::npos) {
       lidar_sensors_.push_back(std::make_unique<LidarSensor<sensor_msgs::msg::PointCloud2>>(
         current_simulation_time, configuration,
         node.create_publisher<sensor_msgs::msg::PointCloud2>(
-          "/perception/obstacle_segmentation/pointcloud", 1)));
+          topic_namespace + "/perception/obstacle_segmentation/pointcloud", 1)));
     } else {
       std::stringstream ss;
       ss << "Unexpected architecture_type " << std::quoted(configuration.architecture_type())
@@ -55,17 +58,18 @@ public:
 
   auto attachDetectionSensor(
     const double current_simulation_time,
-    const simulation_api_schema::DetectionSensorConfiguration & configuration, rclcpp::Node & node)
-    -> void
+    const simulation_api_schema::DetectionSensorConfiguration & configuration, rclcpp::Node & node,
+    const std::string & topic_namespace) -> void
   {
     if (configuration.architecture_type().find("awf/universe") != std::string::npos) {
       using Message = autoware_auto_perception_msgs::msg::DetectedObjects;
       using GroundTruthMessage = autoware_auto_perception_msgs::msg::TrackedObjects;
       detection_sensors_.push_back(std::make_unique<DetectionSensor<Message>>(
         current_simulation_time, configuration,
-        node.create_publisher<Message>("/perception/object_recognition/detection/objects", 1),
+        node.create_publisher<Message>(
+          topic_namespace + "/perception/object_recognition/detection/objects", 1),
         node.create_publisher<GroundTruthMessage>(
-          "/perception/object_recognition/ground_truth/objects", 1)));
+          topic_namespace + "/perception/object_recognition/ground_truth/objects", 1)));
     } else {
       std::stringstream ss;
       ss << "Unexpected architecture_type " << std::quoted(configuration.architecture_type())
@@ -77,13 +81,13 @@ public:
   auto attachOccupancyGridSensor(
     const double current_simulation_time,
     const simulation_api_schema::OccupancyGridSensorConfiguration & configuration,
-    rclcpp::Node & node) -> void
+    rclcpp::Node & node, const std::string & topic_namespace) -> void
   {
     if (configuration.architecture_type().find("awf/universe") != std::string::npos) {
       using Message = nav_msgs::msg::OccupancyGrid;
       occupancy_grid_sensors_.push_back(std::make_unique<OccupancyGridSensor<Message>>(
         current_simulation_time, configuration,
-        node.create_publisher<Message>("/perception/occupancy_grid_map/map", 1)));
+        node.create_publisher<Message>(topic_namespace + "/perception/occupancy_grid_map/map", 1)));
     } else {
       std::stringstream ss;
       ss << "Unexpected architecture_type " << std::quoted(configuration.architecture_type())
@@ -117,11 +121,12 @@ public:
 
   auto attachImuSensor(
     const double /*current_simulation_time*/,
-    const simulation_api_schema::ImuSensorConfiguration & configuration, rclcpp::Node & node)
-    -> void
+    const simulation_api_schema::ImuSensorConfiguration & configuration, rclcpp::Node & node,
+    const std::string & topic_namespace) -> void
   {
     imu_sensors_.push_back(std::make_unique<ImuSensor<sensor_msgs::msg::Imu>>(
-      configuration, node.create_publisher<sensor_msgs::msg::Imu>("/sensing/imu/imu_data", 1)));
+      configuration, node.create_publisher<sensor_msgs::msg::Imu>(
+                       topic_namespace + "/sensing/imu/imu_data", 1)));
   }
 
   auto updateSensorFrame(
@@ -129,12 +134,26 @@ public:
     const std::vector<traffic_simulator_msgs::EntityStatus> &,
     const simulation_api_schema::UpdateTrafficLightsRequest &) -> void;
 
+  auto getFrameProfiler() const noexcept -> const traffic_simulator::helper::FrameProfiler &
+  {
+    return frame_profiler_;
+  }
+
 private:
   std::vector<std::unique_ptr<ImuSensorBase>> imu_sensors_;
   std::vector<std::unique_ptr<LidarSensorBase>> lidar_sensors_;
   std::vector<std::unique_ptr<DetectionSensorBase>> detection_sensors_;
   std::vector<std::unique_ptr<OccupancyGridSensorBase>> occupancy_grid_sensors_;
   std::vector<std::unique_ptr<traffic_lights::TrafficLightsDetector>> traffic_lights_detectors_;
+
+  traffic_simulator::helper::FrameProfiler frame_profiler_;
+
+  const traffic_simulator::helper::FrameProfiler::Section
+    imu_section_ = frame_profiler_.section("sensor/imu"),
+    lidar_section_ = frame_profiler_.section("sensor/lidar"),
+    detection_section_ = frame_profiler_.section("sensor/detection"),
+    occupancy_grid_section_ = frame_profiler_.section("sensor/occupancy_grid"),
+    traffic_lights_section_ = frame_profiler_.section("sensor/traffic_lights");
 };
 }  // namespace simple_sensor_simulator
 
@@ -18,6 +18,7 @@
 #include <tf2/LinearMath/Quaternion.h>
 #include <tf2_ros/transform_broadcaster.h>
 
+#include <chrono>
 #include <geographic_msgs/msg/geo_point.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 #include <geometry_msgs/msg/transform_stamped.hpp>
@@ -28,10 +29,13 @@
 #include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
 #include <simple_sensor_simulator/sensor_simulation/sensor_simulation.hpp>
 #include <simple_sensor_simulator/vehicle_simulation/ego_entity_simulation.hpp>
+#include <simple_sensor_simulator/vehicle_simulation/npc_vehicle_batch_simulation.hpp>
 #include <simulation_interface/zmq_multi_server.hpp>
 #include <string>
 #include <thread>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <traffic_simulator_msgs/msg/frame_profile.hpp>
+#include <unordered_map>
 #include <vector>
 #include <visualization_msgs/msg/marker_array.hpp>
 
@@ -90,6 +94,14 @@ public:
 private:
   SensorSimulation sensor_sim_;
 
+  const rclcpp::Publisher<traffic_simulator_msgs::msg::FrameProfile>::SharedPtr frame_profile_pub_;
+
+  const double frame_profile_publish_rate_;  // [Hz] in wall clock time, 0 disables the publication
+
+  std::chrono::steady_clock::time_point frame_profile_published_time_;
+
+  auto publishFrameProfile() -> void;
+
   auto initialize(const simulation_api_schema::InitializeRequest &)
     -> simulation_api_schema::InitializeResponse;
 
@@ -139,6 +151,7 @@ private:
     -> simulation_api_schema::AttachPseudoTrafficLightDetectorResponse;
 
   int getSocketPort();
+  auto getTransportProtocol() -> simulation_interface::TransportProtocol;
 
   std::vector<traffic_simulator_msgs::VehicleParameters> ego_vehicles_;
   std::vector<traffic_simulator_msgs::VehicleParameters> vehicles_;
@@ -156,9 +169,16 @@ private:
   zeromq::MultiServer server_;
   geographic_msgs::msg::GeoPoint getOrigin();
   std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils_;
-  std::shared_ptr<vehicle_simulation::EgoEntitySimulation> ego_entity_simulation_;
+  std::unordered_map<std::string, std::shared_ptr<vehicle_simulation::EgoEntitySimulation>>
+    ego_entity_simulations_;
+  std::unique_ptr<vehicle_simulation::NpcVehicleBatchSimulation> npc_vehicle_simulation_;
+
+  auto makeNpcVehicleSimulation()
+    -> std::unique_ptr<vehicle_simulation::NpcVehicleBatchSimulation>;
 
   bool isEgo(const std::string & name);
+  auto getTopicNamespace(const std::string & entity_name) const -> std::string;
+  auto makeTopicNamespace(const std::string & entity_name) const -> std::string;
   bool isEntityExists(const std::string & name);
 };
 }  // namespace simple_sensor_simulator
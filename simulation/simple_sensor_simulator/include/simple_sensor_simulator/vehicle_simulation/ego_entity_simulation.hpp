@@ -17,6 +17,7 @@
 
 #include <concealer/autoware.hpp>
 #include <memory>
+#include <string>
 #include <simple_sensor_simulator/vehicle_simulation/vehicle_model/sim_model.hpp>
 #include <traffic_simulator/data_type/entity_status.hpp>
 #include <traffic_simulator/data_type/lanelet_pose.hpp>
@@ -40,11 +41,17 @@ enum class VehicleModelType {
 class EgoEntitySimulation
 {
 public:
+  /// @note prefix of the topics of this ego's Autoware and sensors, empty for the first ego
+  const std::string topic_namespace;
+
   const std::unique_ptr<concealer::Autoware> autoware;
 
 private:
   const VehicleModelType vehicle_model_type_;
 
+  /// @note number of integration steps of the vehicle model per simulation frame
+  const int vehicle_model_substeps_;
+
   const std::shared_ptr<SimModelInterface> vehicle_model_ptr_;
 
   std::optional<double> previous_linear_velocity_, previous_angular_velocity_;
@@ -55,6 +62,8 @@ private:
 
   static auto getVehicleModelType() -> VehicleModelType;
 
+  static auto getVehicleModelSubsteps() -> int;
+
   static auto makeSimulationModel(
     const VehicleModelType, const double step_time,
     const traffic_simulator_msgs::msg::VehicleParameters &)
@@ -89,7 +98,7 @@ public:
     const traffic_simulator_msgs::msg::EntityStatus &,
     const traffic_simulator_msgs::msg::VehicleParameters &, double,
     const std::shared_ptr<hdmap_utils::HdMapUtils> &, const rclcpp::Parameter & use_sim_time,
-    const bool consider_acceleration_by_road_slope);
+    const bool consider_acceleration_by_road_slope, const std::string & topic_namespace);
 
   auto overwrite(
     const traffic_simulator_msgs::msg::EntityStatus & status, const double current_time,
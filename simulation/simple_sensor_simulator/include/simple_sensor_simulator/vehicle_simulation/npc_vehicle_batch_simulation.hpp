@@ -0,0 +1,146 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_SENSOR_SIMULATOR__VEHICLE_SIMULATION__NPC_VEHICLE_BATCH_SIMULATION_HPP_
+#define SIMPLE_SENSOR_SIMULATOR__VEHICLE_SIMULATION__NPC_VEHICLE_BATCH_SIMULATION_HPP_
+
+#include <cstddef>
+#include <geometry_msgs/msg/accel.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/twist.hpp>
+#include <string>
+#include <traffic_simulator_msgs/msg/vehicle_parameters.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace vehicle_simulation
+{
+/**
+ * @brief states of many vehicles of the DELAY_STEER_ACC model in structure-of-arrays layout
+ * @note Element i of every array belongs to the same vehicle.
+ */
+struct VehicleStateArrays
+{
+  std::vector<double> x, y, yaw, vx, steer, accx;
+
+  auto size() const noexcept -> std::size_t { return x.size(); }
+
+  auto resize(const std::size_t size) -> void;
+
+  /// @note move the last element to index, then shrink by one
+  auto swapRemove(const std::size_t index) -> void;
+};
+
+/**
+ * @brief steps many NPC vehicles through the DELAY_STEER_ACC vehicle model in a single batch
+ *
+ * The traffic_simulator integrates NPCs kinematically, and the resulting status is used here as a
+ * reference: its acceleration and yaw rate are fed to the vehicle model as commands (with a
+ * correction for velocity and heading error), and the simulated state replaces the kinematic one.
+ * All vehicles share the dead times and time constants, so the command delay is a ring buffer of
+ * rows holding one command per vehicle, and the Runge-Kutta stages are evaluated as loops over
+ * contiguous arrays without virtual calls or per-vehicle heap allocation.
+ */
+class NpcVehicleBatchSimulation
+{
+public:
+  struct Parameters
+  {
+    double acc_time_delay = 0.1;        // [s]
+    double acc_time_constant = 0.1;     // [s]
+    double steer_time_delay = 0.24;     // [s]
+    double steer_time_constant = 0.27;  // [s]
+    double velocity_gain = 1.0;         // [1/s] gain of velocity error to acceleration command
+    double heading_gain = 1.0;          // [-] gain of heading error to steering command
+    double reset_distance = 5.0;        // [m] teleport threshold re-synchronizing the model
+  };
+
+  explicit NpcVehicleBatchSimulation(const Parameters &);
+
+  auto spawn(const std::string & name, const traffic_simulator_msgs::msg::VehicleParameters &)
+    -> void;
+
+  auto despawn(const std::string & name) -> bool;
+
+  auto contains(const std::string & name) const -> bool;
+
+  auto size() const noexcept -> std::size_t { return state_.size(); }
+
+  /**
+   * @brief set status calculated by the traffic_simulator as reference for the next update
+   * @note Before the first update, or if the reference is farther than reset_distance, the vehicle
+   *       state is overwritten by the reference.
+   */
+  auto setReference(
+    const std::string & name, const geometry_msgs::msg::Pose &, const geometry_msgs::msg::Twist &,
+    const geometry_msgs::msg::Accel &) -> void;
+
+  /// @note overwrite both reference and vehicle state, e.g. while the NPC logic is not started
+  auto overwrite(
+    const std::string & name, const geometry_msgs::msg::Pose &, const geometry_msgs::msg::Twist &,
+    const geometry_msgs::msg::Accel &) -> void;
+
+  /**
+   * @brief integrate all vehicles for one step
+   * @param [in] step_time step time [s], the dead time buffers are resized if it changes
+   */
+  auto update(const double step_time) -> void;
+
+  auto getPose(const std::string & name) const -> geometry_msgs::msg::Pose;
+
+  auto getTwist(const std::string & name) const -> geometry_msgs::msg::Twist;
+
+  auto getAccel(const std::string & name) const -> geometry_msgs::msg::Accel;
+
+private:
+  auto indexOf(const std::string & name) const -> std::size_t;
+
+  auto resizeInputQueue(const double step_time) -> void;
+
+  auto calcModel(
+    const VehicleStateArrays & state, const std::vector<double> & acc_des,
+    const std::vector<double> & steer_des, VehicleStateArrays & d_state) const -> void;
+
+  const Parameters parameters_;
+
+  std::unordered_map<std::string, std::size_t> index_;
+
+  std::vector<std::string> names_;
+
+  VehicleStateArrays state_;
+
+  // per vehicle parameters
+  std::vector<double> wheelbase_, vx_lim_, vx_rate_lim_, steer_lim_, steer_rate_lim_;
+
+  // reference status, which is the one received from the traffic_simulator
+  std::vector<double> reference_z_, reference_roll_, reference_pitch_, reference_yaw_,
+    reference_vx_, reference_wz_, reference_accx_;
+
+  std::vector<bool> initialized_;
+
+  std::vector<double> acc_des_, steer_des_;
+
+  // ring buffers of delayed commands, one row per step of dead time
+  std::vector<std::vector<double>> acc_input_queue_, steer_input_queue_;
+
+  std::size_t acc_input_queue_head_ = 0, steer_input_queue_head_ = 0;
+
+  double queue_step_time_ = 0.0;
+
+  // Runge-Kutta work space, kept between updates to avoid allocation
+  VehicleStateArrays k1_, k2_, k3_, k4_, intermediate_state_;
+};
+}  // namespace vehicle_simulation
+
+#endif  // SIMPLE_SENSOR_SIMULATOR__VEHICLE_SIMULATION__NPC_VEHICLE_BATCH_SIMULATION_HPP_
@@ -0,0 +1,61 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__DELAY_BUFFER_HPP_
+#define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__DELAY_BUFFER_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class DelayBuffer
+ * @brief fixed-length ring buffer delaying an input command by a constant number of steps
+ * @note The storage is allocated once on construction, pushing and popping never allocate.
+ */
+class DelayBuffer
+{
+public:
+  /**
+   * @brief constructor
+   * @param [in] length number of steps the command is delayed by, filled with zeros
+   */
+  explicit DelayBuffer(const std::size_t length = 0) : buffer_(length, 0.0) {}
+
+  /**
+   * @brief push a new command and pop the one pushed `length` steps ago
+   * @param [in] value newest command
+   * @return delayed command (value itself if the buffer has zero length)
+   */
+  double exchange(const double value)
+  {
+    if (buffer_.empty()) {
+      return value;
+    }
+    const double delayed = buffer_[head_];
+    buffer_[head_] = value;
+    head_ = (head_ + 1 == buffer_.size()) ? 0 : head_ + 1;
+    return delayed;
+  }
+
+  /**
+   * @brief get number of steps the command is delayed by
+   */
+  std::size_t size() const { return buffer_.size(); }
+
+private:
+  std::vector<double> buffer_;  //!< @brief stored commands, oldest one at head_
+  std::size_t head_ = 0;        //!< @brief index of the oldest command
+};
+
+#endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__DELAY_BUFFER_HPP_
@@ -15,14 +15,13 @@
 #ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_ACC_GEARED_HPP_
 #define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_ACC_GEARED_HPP_
 
-#include <deque>
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/LU>
 #include <iostream>
-#include <queue>
+#include <simple_sensor_simulator/vehicle_simulation/vehicle_model/delay_buffer.hpp>
 #include <simple_sensor_simulator/vehicle_simulation/vehicle_model/sim_model_interface.hpp>
 
-class SimModelDelaySteerAccGeared : public SimModelInterface
+class SimModelDelaySteerAccGeared : public SimModelBase<SimModelDelaySteerAccGeared, 6, 2>
 {
 public:
   /**
@@ -53,6 +52,8 @@ public:
   ~SimModelDelaySteerAccGeared() = default;
 
 private:
+  friend class SimModelBase<SimModelDelaySteerAccGeared, 6, 2>;
+
   const double MIN_TIME_CONSTANT;  //!< @brief minimum time constant
 
   enum IDX {
@@ -75,8 +76,8 @@ private:
   const double steer_rate_lim_;  //!< @brief steering angular velocity limit [rad/s]
   const double wheelbase_;       //!< @brief vehicle wheelbase length [m]
 
-  std::deque<double> acc_input_queue_;       //!< @brief buffer for accel command
-  std::deque<double> steer_input_queue_;     //!< @brief buffer for steering command
+  DelayBuffer acc_input_queue_;              //!< @brief buffer for accel command
+  DelayBuffer steer_input_queue_;            //!< @brief buffer for steering command
   const double acc_delay_;                   //!< @brief time delay for accel command [s]
   const double acc_time_constant_;           //!< @brief time constant for accel dynamics
   const double steer_delay_;                 //!< @brief time delay for steering command [s]
@@ -142,7 +143,7 @@ private:
    * @param [in] state current model state
    * @param [in] input input vector to model
    */
-  Eigen::VectorXd calcModel(const Eigen::VectorXd & state, const Eigen::VectorXd & input) override;
+  State calcModel(const State & state, const Input & input) const;
 
   /**
    * @brief update state considering current gear
@@ -152,8 +153,7 @@ private:
    * @param [in] dt delta time to update state
    */
   void updateStateWithGear(
-    Eigen::VectorXd & state, const Eigen::VectorXd & prev_state, const uint8_t gear,
-    const double dt);
+    State & state, const State & prev_state, const uint8_t gear, const double dt);
 };
 
 #endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_ACC_GEARED_HPP_
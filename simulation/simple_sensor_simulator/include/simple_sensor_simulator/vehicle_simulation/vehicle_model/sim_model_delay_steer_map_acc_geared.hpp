@@ -15,10 +15,11 @@
 #ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_MAP_ACC_GEARED_HPP_
 #define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_MAP_ACC_GEARED_HPP_
 
-#include <deque>
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iostream>
-#include <queue>
+#include <simple_sensor_simulator/vehicle_simulation/vehicle_model/delay_buffer.hpp>
 #include <simple_sensor_simulator/vehicle_simulation/vehicle_model/sim_model_interface.hpp>
 #include <sstream>
 #include <string>
@@ -156,6 +157,12 @@ private:
   std::string csv_path_;
 };
 
+/**
+ * @brief conversion from desired acceleration to actual acceleration, depending on velocity
+ * @note The map read from CSV is validated and resampled once into a uniform grid, so that
+ *       getAcceleration, which is evaluated in every Runge-Kutta stage, is an O(1) bilinear
+ *       lookup without allocation. Keys that are uniformly spaced are reproduced exactly.
+ */
 class AccelerationMap
 {
 public:
@@ -169,42 +176,118 @@ public:
       return false;
     }
 
+    auto vel_index = CSVLoader::getRowIndex(table);
+    auto acc_index = CSVLoader::getColumnIndex(table);
+    buildGrid(acc_index, vel_index, CSVLoader::getMap(table));
     vehicle_name_ = table[0][0];
-    vel_index_ = CSVLoader::getRowIndex(table);
-    acc_index_ = CSVLoader::getColumnIndex(table);
-    acceleration_map_ = CSVLoader::getMap(table);
+    vel_index_ = std::move(vel_index);
+    acc_index_ = std::move(acc_index);
 
     std::cout << "[SimModelDelaySteerMapAccGeared]: success to read acceleration map from "
-              << csv_path << std::endl;
+              << csv_path << " (acc: [" << acc_index_.front() << ", " << acc_index_.back()
+              << "], vel: [" << vel_index_.front() << ", " << vel_index_.back()
+              << "], inputs out of range are clamped)" << std::endl;
     return true;
   }
 
   double getAcceleration(const double acc_des, const double vel) const
   {
-    std::vector<double> interpolated_acc_vec;
-    const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "acc: vel");
+    // When the desired acceleration or velocity is out of the map, the closest value is used
+    const auto locate = [](const double value, const double min, const double inverse_step,
+                           const std::size_t size, std::size_t & index) {
+      const double position =
+        std::clamp((value - min) * inverse_step, 0.0, static_cast<double>(size - 1));
+      index = std::min(static_cast<std::size_t>(position), size - 2);
+      return position - index;
+    };
+    std::size_t i, j;
+    const double ratio_acc = locate(acc_des, acc_min_, acc_inverse_step_, acc_size_, i);
+    const double ratio_vel = locate(vel, vel_min_, vel_inverse_step_, vel_size_, j);
+    const double * const row = grid_.data() + i * vel_size_ + j;
+    const double lower = row[0] + (row[1] - row[0]) * ratio_vel;
+    const double upper = row[vel_size_] + (row[vel_size_ + 1] - row[vel_size_]) * ratio_vel;
+    return lower + (upper - lower) * ratio_acc;
+  }
+
+  /**
+   * @brief whether no acceleration map has been read
+   * @note Only the resampled grid is kept, so it is the single source of truth.
+   */
+  bool empty() const noexcept { return grid_.empty(); }
 
-    // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-    for (const auto & acc_vec : acceleration_map_) {
-      interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, acc_vec, clamped_vel));
+private:
+  /**
+   * @brief validate the map and resample it into grid_
+   * @note Sample spacing is a quarter of the smallest key spacing, limited to max_grid_size
+   *       samples per axis. Nothing is modified when the map is invalid.
+   */
+  void buildGrid(
+    const std::vector<double> & acc_index, const std::vector<double> & vel_index,
+    const std::vector<std::vector<double>> & acceleration_map)
+  {
+    constexpr std::size_t oversampling = 4;
+    constexpr std::size_t max_grid_size = 1024;
+    interpolation_utils::validateKeysAndValues(acc_index, acceleration_map);
+    if (
+      !interpolation_utils::isIncreasing(vel_index) ||
+      !interpolation_utils::isIncreasing(acc_index)) {
+      throw std::invalid_argument("Keys of the acceleration map are not sorted.");
+    }
+    for (const auto & row : acceleration_map) {
+      interpolation_utils::validateKeysAndValues(vel_index, row);
     }
-    // calculate throttle
-    // When the desired acceleration is smaller than the throttle area, return min acc
-    // When the desired acceleration is greater than the throttle area, return max acc
-    const double clamped_acc = CSVLoader::clampValue(acc_des, acc_index_, "acceleration: acc");
-    const double acc = interpolation::lerp(acc_index_, interpolated_acc_vec, clamped_acc);
 
-    return acc;
+    const auto make_axis = [&](const std::vector<double> & keys, double & min,
+                               double & inverse_step, std::size_t & size) {
+      double min_spacing = keys.back() - keys.front();
+      for (std::size_t k = 1; k < keys.size(); ++k) {
+        min_spacing = std::min(min_spacing, keys[k] - keys[k - 1]);
+      }
+      const double cells = std::round((keys.back() - keys.front()) / min_spacing) * oversampling;
+      size = std::clamp(static_cast<std::size_t>(cells) + 1, keys.size(), max_grid_size);
+      min = keys.front();
+      inverse_step = (size - 1) / (keys.back() - keys.front());
+      std::vector<double> samples(size);
+      for (std::size_t k = 0; k < size; ++k) {
+        samples[k] = std::min(keys.front() + k / inverse_step, keys.back());
+      }
+      return samples;
+    };
+    const auto acc_samples = make_axis(acc_index, acc_min_, acc_inverse_step_, acc_size_);
+    const auto vel_samples = make_axis(vel_index, vel_min_, vel_inverse_step_, vel_size_);
+
+    // resample every row at vel_samples, and then every column at acc_samples
+    std::vector<std::vector<double>> resampled_rows;
+    for (const auto & row : acceleration_map) {
+      resampled_rows.push_back(interpolation::lerp(vel_index, row, vel_samples));
+    }
+    grid_.resize(acc_size_ * vel_size_);
+    std::vector<double> column(acc_index.size());
+    for (std::size_t j = 0; j < vel_size_; ++j) {
+      for (std::size_t i = 0; i < acc_index.size(); ++i) {
+        column[i] = resampled_rows[i][j];
+      }
+      const auto resampled_column = interpolation::lerp(acc_index, column, acc_samples);
+      for (std::size_t i = 0; i < acc_size_; ++i) {
+        grid_[i * vel_size_ + j] = resampled_column[i];
+      }
+    }
   }
-  std::vector<std::vector<double>> acceleration_map_;
 
-private:
   std::string vehicle_name_;
   std::vector<double> vel_index_;
   std::vector<double> acc_index_;
+
+  std::vector<double> grid_;  //!< @brief row-major (acc, vel) grid with uniform spacing
+  double acc_min_ = 0.0;
+  double acc_inverse_step_ = 0.0;
+  std::size_t acc_size_ = 0;
+  double vel_min_ = 0.0;
+  double vel_inverse_step_ = 0.0;
+  std::size_t vel_size_ = 0;
 };
 
-class SimModelDelaySteerMapAccGeared : public SimModelInterface
+class SimModelDelaySteerMapAccGeared : public SimModelBase<SimModelDelaySteerMapAccGeared, 6, 2>
 {
 public:
   /**
@@ -234,6 +317,8 @@ public:
   AccelerationMap acc_map_;
 
 private:
+  friend class SimModelBase<SimModelDelaySteerMapAccGeared, 6, 2>;
+
   const double MIN_TIME_CONSTANT;  //!< @brief minimum time constant
 
   enum IDX {
@@ -256,8 +341,8 @@ private:
   const double steer_rate_lim_;  //!< @brief steering angular velocity limit [rad/s]
   const double wheelbase_;       //!< @brief vehicle wheelbase length [m]
 
-  std::deque<double> acc_input_queue_;    //!< @brief buffer for accel command
-  std::deque<double> steer_input_queue_;  //!< @brief buffer for steering command
+  DelayBuffer acc_input_queue_;           //!< @brief buffer for accel command
+  DelayBuffer steer_input_queue_;         //!< @brief buffer for steering command
   const double acc_delay_;                //!< @brief time delay for accel command [s]
   const double acc_time_constant_;        //!< @brief time constant for accel dynamics
   const double steer_delay_;              //!< @brief time delay for steering command [s]
@@ -321,7 +406,7 @@ private:
    * @param [in] state current model state
    * @param [in] input input vector to model
    */
-  Eigen::VectorXd calcModel(const Eigen::VectorXd & state, const Eigen::VectorXd & input) override;
+  State calcModel(const State & state, const Input & input) const;
 
   /**
    * @brief update state considering current gear
@@ -331,8 +416,7 @@ private:
    * @param [in] dt delta time to update state
    */
   void updateStateWithGear(
-    Eigen::VectorXd & state, const Eigen::VectorXd & prev_state, const uint8_t gear,
-    const double dt);
+    State & state, const State & prev_state, const uint8_t gear, const double dt);
 };
 
 #endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_MAP_ACC_GEARED_HPP_
@@ -15,17 +15,16 @@
 #ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_VEL_HPP_
 #define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_VEL_HPP_
 
-#include <deque>
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/LU>
 #include <iostream>
-#include <queue>
+#include <simple_sensor_simulator/vehicle_simulation/vehicle_model/delay_buffer.hpp>
 #include <simple_sensor_simulator/vehicle_simulation/vehicle_model/sim_model_interface.hpp>
 /**
  * @class SimModelDelaySteerVel
  * @brief calculate delay steering dynamics
  */
-class SimModelDelaySteerVel : public SimModelInterface
+class SimModelDelaySteerVel : public SimModelBase<SimModelDelaySteerVel, 5, 2>
 {
 public:
   /**
@@ -52,7 +51,15 @@ public:
    */
   ~SimModelDelaySteerVel() = default;
 
+  /**
+   * @brief set input vector of model, remembering previous velocity command to calculate ax
+   * @param [in] input input vector
+   */
+  void setInput(const Eigen::Ref<const Eigen::VectorXd> & input) override;
+
 private:
+  friend class SimModelBase<SimModelDelaySteerVel, 5, 2>;
+
   const double MIN_TIME_CONSTANT;  //!< @brief minimum time constant
 
   enum IDX {
@@ -72,11 +79,19 @@ private:
   const double steer_lim_;       //!< @brief steering limit [rad]
   const double steer_rate_lim_;  //!< @brief steering angular velocity limit [rad/s]
   const double wheelbase_;       //!< @brief vehicle wheelbase length [m]
-  double prev_vx_ = 0.0;
+  double prev_vx_ = 0.0;  //!< @brief velocity command before the last setInput [m/s]
+  /**
+   * @brief change of the velocity command divided by the time integrated since it was set [m/ss]
+   * @note With one update per setInput, which is how EgoEntitySimulation drives the model when
+   * vehicle_model_substeps is 1, this is (vx_des - previous vx_des) / dt as before sub steps were
+   * introduced. With several updates per setInput, the command change is spread over all of them
+   * instead of being reported by the first update only.
+   */
   double current_ax_ = 0.0;
+  double elapsed_time_since_input_ = 0.0;  //!< @brief time integrated since last setInput [s]
 
-  std::deque<double> vx_input_queue_;     //!< @brief buffer for velocity command
-  std::deque<double> steer_input_queue_;  //!< @brief buffer for angular velocity command
+  DelayBuffer vx_input_queue_;            //!< @brief buffer for velocity command
+  DelayBuffer steer_input_queue_;         //!< @brief buffer for angular velocity command
   const double vx_delay_;                 //!< @brief time delay for velocity command [s]
   const double vx_time_constant_;
   //!< @brief time constant for 1D model of velocity dynamics
@@ -142,7 +157,7 @@ private:
    * @param [in] state current model state
    * @param [in] input input vector to model
    */
-  Eigen::VectorXd calcModel(const Eigen::VectorXd & state, const Eigen::VectorXd & input) override;
+  State calcModel(const State & state, const Input & input) const;
 };
 
 #endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_VEL_HPP_
@@ -24,7 +24,7 @@
  * @class SimModelIdealSteerAcc
  * @brief calculate ideal steering dynamics
  */
-class SimModelIdealSteerAcc : public SimModelInterface
+class SimModelIdealSteerAcc : public SimModelBase<SimModelIdealSteerAcc, 4, 2>
 {
 public:
   /**
@@ -39,6 +39,8 @@ public:
   ~SimModelIdealSteerAcc() = default;
 
 private:
+  friend class SimModelBase<SimModelIdealSteerAcc, 4, 2>;
+
   enum IDX { X = 0, Y, YAW, VX };
   enum IDX_U {
     AX_DES = 0,
@@ -98,7 +100,7 @@ private:
    * @param [in] state current model state
    * @param [in] input input vector to model
    */
-  Eigen::VectorXd calcModel(const Eigen::VectorXd & state, const Eigen::VectorXd & input) override;
+  State calcModel(const State & state, const Input & input) const;
 };
 
 #endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_IDEAL_STEER_ACC_HPP_
@@ -24,7 +24,7 @@
  * @class SimModelIdealSteerAccGeared
  * @brief calculate ideal steering dynamics
  */
-class SimModelIdealSteerAccGeared : public SimModelInterface
+class SimModelIdealSteerAccGeared : public SimModelBase<SimModelIdealSteerAccGeared, 4, 2>
 {
 public:
   /**
@@ -39,6 +39,8 @@ public:
   ~SimModelIdealSteerAccGeared() = default;
 
 private:
+  friend class SimModelBase<SimModelIdealSteerAccGeared, 4, 2>;
+
   enum IDX { X = 0, Y, YAW, VX };
   enum IDX_U {
     AX_DES = 0,
@@ -99,7 +101,7 @@ private:
    * @param [in] state current model state
    * @param [in] input input vector to model
    */
-  Eigen::VectorXd calcModel(const Eigen::VectorXd & state, const Eigen::VectorXd & input) override;
+  State calcModel(const State & state, const Input & input) const;
 
   /**
    * @brief update state considering current gear
@@ -109,8 +111,7 @@ private:
    * @param [in] dt delta time to update state
    */
   void updateStateWithGear(
-    Eigen::VectorXd & state, const Eigen::VectorXd & prev_state, const uint8_t gear,
-    const double dt);
+    State & state, const State & prev_state, const uint8_t gear, const double dt);
 };
 
 #endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_IDEAL_STEER_ACC_GEARED_HPP_
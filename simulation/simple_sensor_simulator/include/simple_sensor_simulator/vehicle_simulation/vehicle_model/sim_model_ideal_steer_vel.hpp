@@ -24,7 +24,7 @@
  * @class SimModelIdealSteerVel
  * @brief calculate ideal steering dynamics
  */
-class SimModelIdealSteerVel : public SimModelInterface
+class SimModelIdealSteerVel : public SimModelBase<SimModelIdealSteerVel, 3, 2>
 {
 public:
   /**
@@ -38,7 +38,15 @@ public:
    */
   ~SimModelIdealSteerVel() = default;
 
+  /**
+   * @brief set input vector of model, remembering previous velocity command to calculate ax
+   * @param [in] input input vector
+   */
+  void setInput(const Eigen::Ref<const Eigen::VectorXd> & input) override;
+
 private:
+  friend class SimModelBase<SimModelIdealSteerVel, 3, 2>;
+
   enum IDX { X = 0, Y, YAW };
   enum IDX_U {
     VX_DES = 0,
@@ -46,8 +54,16 @@ private:
   };
 
   const double wheelbase_;  //!< @brief vehicle wheelbase length
-  double prev_vx_ = 0.0;
+  double prev_vx_ = 0.0;  //!< @brief velocity command before the last setInput [m/s]
+  /**
+   * @brief change of the velocity command divided by the time integrated since it was set [m/ss]
+   * @note With one update per setInput, which is how EgoEntitySimulation drives the model when
+   * vehicle_model_substeps is 1, this is (vx_des - previous vx_des) / dt as before sub steps were
+   * introduced. With several updates per setInput, the command change is spread over all of them
+   * instead of being reported by the first update only.
+   */
   double current_ax_ = 0.0;
+  double elapsed_time_since_input_ = 0.0;  //!< @brief time integrated since last setInput [s]
 
   /**
    * @brief get vehicle position x
@@ -100,7 +116,7 @@ private:
    * @param [in] state current model state
    * @param [in] input input vector to model
    */
-  Eigen::VectorXd calcModel(const Eigen::VectorXd & state, const Eigen::VectorXd & input) override;
+  State calcModel(const State & state, const Input & input) const;
 };
 
 #endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_IDEAL_STEER_VEL_HPP_
@@ -25,15 +25,26 @@
 class SimModelInterface
 {
 protected:
-  const int dim_x_;        //!< @brief dimension of state x
-  const int dim_u_;        //!< @brief dimension of input u
-  Eigen::VectorXd state_;  //!< @brief vehicle state vector
-  Eigen::VectorXd input_;  //!< @brief vehicle input vector
+  const int dim_x_;  //!< @brief dimension of state x
+  const int dim_u_;  //!< @brief dimension of input u
 
   //!< @brief gear command defined in autoware_auto_msgs/GearCommand
   uint8_t gear_ = autoware_auto_vehicle_msgs::msg::GearCommand::DRIVE;
 
 public:
+  static constexpr int max_dim_x = 6;  //!< @brief largest state dimension among all models
+  static constexpr int max_dim_u = 2;  //!< @brief largest input dimension among all models
+
+  /**
+   * @brief state vector of any model, sized at run time but stored inline (no heap allocation)
+   */
+  using StateVector = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, max_dim_x, 1>;
+
+  /**
+   * @brief input vector of any model, sized at run time but stored inline (no heap allocation)
+   */
+  using InputVector = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, max_dim_u, 1>;
+
   /**
    * @brief constructor
    * @param [in] dim_x dimension of state x
@@ -44,31 +55,31 @@ public:
   /**
    * @brief destructor
    */
-  ~SimModelInterface() = default;
+  virtual ~SimModelInterface() = default;
 
   /**
    * @brief get state vector of model
    * @param [out] state state vector
    */
-  void getState(Eigen::VectorXd & state);
+  virtual void getState(StateVector & state) const = 0;
 
   /**
    * @brief get input vector of model
    * @param [out] input input vector
    */
-  void getInput(Eigen::VectorXd & input);
+  virtual void getInput(InputVector & input) const = 0;
 
   /**
    * @brief set state vector of model
-   * @param [in] state state vector
+   * @param [in] state state vector, its size must be equal to getDimX()
    */
-  void setState(const Eigen::VectorXd & state);
+  virtual void setState(const Eigen::Ref<const Eigen::VectorXd> & state) = 0;
 
   /**
    * @brief set input vector of model
-   * @param [in] input input vector
+   * @param [in] input input vector, its size must be equal to getDimU()
    */
-  void setInput(const Eigen::VectorXd & input);
+  virtual void setInput(const Eigen::Ref<const Eigen::VectorXd> & input) = 0;
 
   /**
    * @brief set gear
@@ -76,20 +87,6 @@ public:
    */
   void setGear(const uint8_t gear);
 
-  /**
-   * @brief update vehicle states with Runge-Kutta methods
-   * @param [in] dt delta time [s]
-   * @param [in] input vehicle input
-   */
-  void updateRungeKutta(const double & dt, const Eigen::VectorXd & input);
-
-  /**
-   * @brief update vehicle states with Euler methods
-   * @param [in] dt delta time [s]
-   * @param [in] input vehicle input
-   */
-  void updateEuler(const double & dt, const Eigen::VectorXd & input);
-
   /**
    * @brief update vehicle states
    * @param [in] dt delta time [s]
@@ -150,14 +147,67 @@ public:
    * @brief get input vector dimension
    */
   inline int getDimU() { return dim_u_; }
+};
+
+/**
+ * @class SimModelBase
+ * @brief fixed-size storage and allocation-free integrators shared by all vehicle models
+ * @tparam Model concrete vehicle model, must provide
+ *         `State calcModel(const State &, const Input &) const`
+ * @tparam DimX dimension of state x
+ * @tparam DimU dimension of input u
+ * @note calcModel is dispatched statically (CRTP), so the four derivative evaluations of
+ *       updateRungeKutta are neither virtual calls nor heap allocations.
+ */
+template <typename Model, int DimX, int DimU>
+class SimModelBase : public SimModelInterface
+{
+  static_assert(0 < DimX and DimX <= max_dim_x, "state dimension out of range");
+  static_assert(0 < DimU and DimU <= max_dim_u, "input dimension out of range");
+
+public:
+  using State = Eigen::Matrix<double, DimX, 1>;
+  using Input = Eigen::Matrix<double, DimU, 1>;
+
+  SimModelBase() : SimModelInterface(DimX, DimU) {}
+
+  void getState(StateVector & state) const override { state = state_; }
+
+  void getInput(InputVector & input) const override { input = input_; }
+
+  void setState(const Eigen::Ref<const Eigen::VectorXd> & state) override { state_ = state; }
+
+  void setInput(const Eigen::Ref<const Eigen::VectorXd> & input) override { input_ = input; }
+
+protected:
+  State state_ = State::Zero();  //!< @brief vehicle state vector
+  Input input_ = Input::Zero();  //!< @brief vehicle input vector
 
   /**
-   * @brief calculate derivative of states with vehicle model
-   * @param [in] state current model state
-   * @param [in] input input vector to model
+   * @brief update vehicle states with Runge-Kutta methods
+   * @param [in] dt delta time [s]
+   * @param [in] input vehicle input
+   */
+  void updateRungeKutta(const double & dt, const Input & input)
+  {
+    const auto & model = static_cast<const Model &>(*this);
+    const State k1 = model.calcModel(state_, input);
+    const State k2 = model.calcModel(state_ + k1 * (0.5 * dt), input);
+    const State k3 = model.calcModel(state_ + k2 * (0.5 * dt), input);
+    const State k4 = model.calcModel(state_ + k3 * dt, input);
+
+    state_ += (k1 + 2.0 * k2 + 2.0 * k3 + k4) * (dt / 6.0);
+  }
+
+  /**
+   * @brief update vehicle states with Euler methods
+   * @param [in] dt delta time [s]
+   * @param [in] input vehicle input
    */
-  virtual Eigen::VectorXd calcModel(
-    const Eigen::VectorXd & state, const Eigen::VectorXd & input) = 0;
+  void updateEuler(const double & dt, const Input & input)
+  {
+    state_ += static_cast<const Model &>(*this).calcModel(state_, input) * dt;
+  }
 };
 
 #endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_INTERFACE_HPP_
@@ -15,6 +15,7 @@
 #include <memory>
 #include <simple_sensor_simulator/sensor_simulation/sensor_simulation.hpp>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace simple_sensor_simulator
@@ -25,28 +26,42 @@ auto SensorSimulation::updateSensorFrame(
   const simulation_api_schema::UpdateTrafficLightsRequest & update_traffic_lights_request) -> void
 {
   for (auto & sensor : imu_sensors_) {
+    const auto scope = frame_profiler_.measure(imu_section_);
     sensor->update(current_ros_time, entities);
   }
 
-  std::vector<std::string> lidar_detected_objects = {};
+  /*
+     Objects detected by lidar are collected per entity the lidar is attached to, so that when
+     multiple egos are simulated, each ego sees only what its own sensor rig detects.
+  */
+  std::unordered_map<std::string, std::vector<std::string>> lidar_detected_objects;
   for (auto & sensor : lidar_sensors_) {
+    const auto scope = frame_profiler_.measure(lidar_section_);
     sensor->update(current_simulation_time, entities, current_ros_time);
+    auto & detected_objects = lidar_detected_objects[sensor->getEntityName()];
     for (const auto & object : sensor->getDetectedObjects()) {
-      if (std::count(lidar_detected_objects.begin(), lidar_detected_objects.end(), object) == 0) {
-        lidar_detected_objects.push_back(object);
+      if (std::count(detected_objects.begin(), detected_objects.end(), object) == 0) {
+        detected_objects.push_back(object);
       }
     }
   }
 
   for (auto & sensor : detection_sensors_) {
-    sensor->update(current_simulation_time, entities, current_ros_time, lidar_detected_objects);
+    const auto scope = frame_profiler_.measure(detection_section_);
+    sensor->update(
+      current_simulation_time, entities, current_ros_time,
+      lidar_detected_objects[sensor->getEntityName()]);
   }
 
   for (auto & sensor : occupancy_grid_sensors_) {
-    sensor->update(current_simulation_time, entities, current_ros_time, lidar_detected_objects);
+    const auto scope = frame_profiler_.measure(occupancy_grid_section_);
+    sensor->update(
+      current_simulation_time, entities, current_ros_time,
+      lidar_detected_objects[sensor->getEntityName()]);
   }
 
   for (auto & sensor : traffic_lights_detectors_) {
+    const auto scope = frame_profiler_.measure(traffic_lights_section_);
     sensor->updateFrame(current_ros_time, update_traffic_lights_request);
   }
 }
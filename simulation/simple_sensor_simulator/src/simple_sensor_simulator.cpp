@@ -13,7 +13,10 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <cctype>
+#include <future>
 #include <geometry_msgs/msg/pose_stamped.hpp>
+#include <iomanip>
 #include <limits>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
@@ -29,8 +32,11 @@ namespace simple_sensor_simulator
 {
 ScenarioSimulator::ScenarioSimulator(const rclcpp::NodeOptions & options)
 : Node("simple_sensor_simulator", options),
+  frame_profile_pub_(
+    create_publisher<traffic_simulator_msgs::msg::FrameProfile>("sensor_frame_profile", 1)),
+  frame_profile_publish_rate_(declare_parameter("frame_profile_publish_rate", 1.0)),
   server_(
-    simulation_interface::protocol, simulation_interface::HostName::ANY, getSocketPort(),
+    getTransportProtocol(), simulation_interface::HostName::ANY, getSocketPort(),
     [this](auto &&... xs) { return initialize(std::forward<decltype(xs)>(xs)...); },
     [this](auto &&... xs) { return updateFrame(std::forward<decltype(xs)>(xs)...); },
     [this](auto &&... xs) { return spawnVehicleEntity(std::forward<decltype(xs)>(xs)...); },
@@ -75,6 +81,12 @@ int ScenarioSimulator::getSocketPort()
   return get_parameter("port").as_int();
 }
 
+auto ScenarioSimulator::getTransportProtocol() -> simulation_interface::TransportProtocol
+{
+  if (!has_parameter("transport")) declare_parameter("transport", "tcp");
+  return simulation_interface::toTransportProtocol(get_parameter("transport").as_string());
+}
+
 auto ScenarioSimulator::initialize(const simulation_api_schema::InitializeRequest & req)
   -> simulation_api_schema::InitializeResponse
 {
@@ -86,7 +98,7 @@ auto ScenarioSimulator::initialize(const simulation_api_schema::InitializeReques
   builtin_interfaces::msg::Time t;
   simulation_interface::toMsg(req.initialize_ros_time(), t);
   current_ros_time_ = t;
-  hdmap_utils_ = std::make_shared<hdmap_utils::HdMapUtils>(req.lanelet2_map_path(), getOrigin());
+  hdmap_utils_ = hdmap_utils::HdMapUtils::shared(req.lanelet2_map_path(), getOrigin());
   traffic_simulator::lanelet_pose::CanonicalizedLaneletPose::setConsiderPoseByRoadSlope([&]() {
     if (not has_parameter("consider_pose_by_road_slope")) {
       declare_parameter("consider_pose_by_road_slope", false);
@@ -101,9 +113,35 @@ auto ScenarioSimulator::initialize(const simulation_api_schema::InitializeReques
   pedestrians_.clear();
   misc_objects_.clear();
   entity_status_.clear();
+  traffic_signals_states_.Clear();
+  ego_entity_simulations_.clear();
+  npc_vehicle_simulation_ = makeNpcVehicleSimulation();
   return res;
 }
 
+auto ScenarioSimulator::makeNpcVehicleSimulation()
+  -> std::unique_ptr<vehicle_simulation::NpcVehicleBatchSimulation>
+{
+  auto get_parameter = [this](const std::string & name, const auto & default_value) {
+    if (not has_parameter(name)) {
+      declare_parameter(name, default_value);
+    }
+    return rclcpp::Node::get_parameter(name).get_value<std::decay_t<decltype(default_value)>>();
+  };
+  if (get_parameter("npc_vehicle_dynamics", false)) {
+    vehicle_simulation::NpcVehicleBatchSimulation::Parameters parameters;
+    parameters.acc_time_delay = get_parameter("npc_acc_time_delay", parameters.acc_time_delay);
+    parameters.acc_time_constant =
+      get_parameter("npc_acc_time_constant", parameters.acc_time_constant);
+    parameters.steer_time_delay = get_parameter("npc_steer_time_delay", parameters.steer_time_delay);
+    parameters.steer_time_constant =
+      get_parameter("npc_steer_time_constant", parameters.steer_time_constant);
+    return std::make_unique<vehicle_simulation::NpcVehicleBatchSimulation>(parameters);
+  } else {
+    return nullptr;
+  }
+}
+
 auto ScenarioSimulator::updateFrame(const simulation_api_schema::UpdateFrameRequest & req)
   -> simulation_api_schema::UpdateFrameResponse
 {
@@ -133,11 +171,25 @@ auto ScenarioSimulator::updateFrame(const simulation_api_schema::UpdateFrameRequ
     });
   sensor_sim_.updateSensorFrame(
     current_simulation_time_, current_ros_time_, entity_status, traffic_signals_states_);
+  publishFrameProfile();
   res.mutable_result()->set_success(true);
   res.mutable_result()->set_description("succeed to update frame");
   return res;
 }
 
+auto ScenarioSimulator::publishFrameProfile() -> void
+{
+  if (const auto now = std::chrono::steady_clock::now();
+      0 < frame_profile_publish_rate_ and
+      1 <= std::chrono::duration<double>(now - frame_profile_published_time_).count() *
+             frame_profile_publish_rate_) {
+    auto frame_profile = sensor_sim_.getFrameProfiler().toMsg();
+    frame_profile.header.stamp = current_ros_time_;
+    frame_profile_pub_->publish(frame_profile);
+    frame_profile_published_time_ = now;
+  }
+}
+
 auto ScenarioSimulator::updateStepTime(const simulation_api_schema::UpdateStepTimeRequest & req)
   -> simulation_api_schema::UpdateStepTimeResponse
 {
@@ -159,24 +211,28 @@ auto ScenarioSimulator::updateEntityStatus(
     updated_status->mutable_pose()->CopyFrom(status.pose());
   };
 
+  std::vector<std::pair<
+    const simulation_api_schema::EntityStatus *,
+    std::shared_ptr<vehicle_simulation::EgoEntitySimulation>>>
+    egos;
+
   for (const auto & status : req.status()) {
     try {
       if (isEgo(status.name())) {
-        assert(ego_entity_simulation_ && "Ego is spawned but ego_entity_simulation_ is nullptr!");
-        if (req.overwrite_ego_status()) {
-          traffic_simulator_msgs::msg::EntityStatus ego_status_msg;
-          simulation_interface::toMsg(status, ego_status_msg);
-          ego_entity_simulation_->overwrite(
-            ego_status_msg, current_scenario_time_ + step_time_, step_time_,
-            req.npc_logic_started());
+        egos.emplace_back(&status, ego_entity_simulations_.at(status.name()));
+      } else if (npc_vehicle_simulation_ and npc_vehicle_simulation_->contains(status.name())) {
+        geometry_msgs::msg::Pose pose;
+        geometry_msgs::msg::Twist twist;
+        geometry_msgs::msg::Accel accel;
+        simulation_interface::toMsg(status.pose(), pose);
+        simulation_interface::toMsg(status.action_status().twist(), twist);
+        simulation_interface::toMsg(status.action_status().accel(), accel);
+        if (req.npc_logic_started()) {
+          npc_vehicle_simulation_->setReference(status.name(), pose, twist, accel);
         } else {
-          ego_entity_simulation_->update(
-            current_scenario_time_ + step_time_, step_time_, req.npc_logic_started());
+          npc_vehicle_simulation_->overwrite(status.name(), pose, twist, accel);
         }
-        simulation_api_schema::EntityStatus ego_status;
-        simulation_interface::toProto(ego_entity_simulation_->getStatus(), ego_status);
-        entity_status_.at(status.name()) = ego_status;
-        copyStatusToResponse(ego_status);
+        entity_status_.at(status.name()) = status;
       } else {
         entity_status_.at(status.name()) = status;
         copyStatusToResponse(status);
@@ -186,6 +242,68 @@ auto ScenarioSimulator::updateEntityStatus(
     }
   }
 
+  /*
+     Each ego has its own vehicle model and Autoware, so they are stepped in parallel when
+     multiple egos are simulated.
+  */
+  auto update_ego = [&](
+                      const simulation_api_schema::EntityStatus & status,
+                      vehicle_simulation::EgoEntitySimulation & ego_entity_simulation) {
+    if (req.overwrite_ego_status()) {
+      traffic_simulator_msgs::msg::EntityStatus ego_status_msg;
+      simulation_interface::toMsg(status, ego_status_msg);
+      ego_entity_simulation.overwrite(
+        ego_status_msg, current_scenario_time_ + step_time_, step_time_, req.npc_logic_started());
+    } else {
+      ego_entity_simulation.update(
+        current_scenario_time_ + step_time_, step_time_, req.npc_logic_started());
+    }
+  };
+  if (egos.size() > 1) {
+    std::vector<std::future<void>> ego_updates;
+    for (const auto & [status, ego_entity_simulation] : egos) {
+      ego_updates.push_back(std::async(
+        std::launch::async, update_ego, std::cref(*status), std::ref(*ego_entity_simulation)));
+    }
+    for (auto & ego_update : ego_updates) {
+      ego_update.get();
+    }
+  } else {
+    for (const auto & [status, ego_entity_simulation] : egos) {
+      update_ego(*status, *ego_entity_simulation);
+    }
+  }
+  for (const auto & [status, ego_entity_simulation] : egos) {
+    simulation_api_schema::EntityStatus ego_status;
+    simulation_interface::toProto(ego_entity_simulation->getStatus(), ego_status);
+    entity_status_.at(status->name()) = ego_status;
+    copyStatusToResponse(ego_status);
+  }
+
+  /*
+     NPC vehicles are stepped together after all references are received, so that the batch
+     simulation runs once per frame regardless of the number of vehicles.
+  */
+  if (npc_vehicle_simulation_) {
+    if (req.npc_logic_started()) {
+      npc_vehicle_simulation_->update(step_time_);
+    }
+    for (const auto & status : req.status()) {
+      if (npc_vehicle_simulation_->contains(status.name())) {
+        auto & npc_status = entity_status_.at(status.name());
+        simulation_interface::toProto(
+          npc_vehicle_simulation_->getPose(status.name()), *npc_status.mutable_pose());
+        simulation_interface::toProto(
+          npc_vehicle_simulation_->getTwist(status.name()),
+          *npc_status.mutable_action_status()->mutable_twist());
+        simulation_interface::toProto(
+          npc_vehicle_simulation_->getAccel(status.name()),
+          *npc_status.mutable_action_status()->mutable_accel());
+        copyStatusToResponse(npc_status);
+      }
+    }
+  }
+
   res.mutable_result()->set_success(true);
   res.mutable_result()->set_description("");
   return res;
@@ -210,9 +328,6 @@ auto ScenarioSimulator::spawnVehicleEntity(
   const simulation_api_schema::SpawnVehicleEntityRequest & req)
   -> simulation_api_schema::SpawnVehicleEntityResponse
 {
-  if (ego_vehicles_.size() != 0 && req.is_ego()) {
-    throw SimulationRuntimeError("multi ego does not support");
-  }
   auto entity_type = traffic_simulator_msgs::EntityType::VEHICLE;
   if (req.is_ego()) {
     entity_type = traffic_simulator_msgs::EntityType::EGO;
@@ -229,12 +344,24 @@ auto ScenarioSimulator::spawnVehicleEntity(
     initial_status.name = parameters.name;
     initial_status.bounding_box = parameters.bounding_box;
     simulation_interface::toMsg(req.pose(), initial_status.pose);
-    ego_entity_simulation_ = std::make_shared<vehicle_simulation::EgoEntitySimulation>(
-      initial_status, parameters, step_time_, hdmap_utils_,
-      get_parameter_or("use_sim_time", rclcpp::Parameter("use_sim_time", false)),
-      get_consider_acceleration_by_road_slope());
+    /*
+       The first ego keeps the default topics. Every additional ego, which is driven by another
+       Autoware, uses the same topics under a namespace of its name.
+    */
+    ego_entity_simulations_.emplace(
+      parameters.name,
+      std::make_shared<vehicle_simulation::EgoEntitySimulation>(
+        initial_status, parameters, step_time_, hdmap_utils_,
+        get_parameter_or("use_sim_time", rclcpp::Parameter("use_sim_time", false)),
+        get_consider_acceleration_by_road_slope(),
+        ego_entity_simulations_.empty() ? "" : makeTopicNamespace(parameters.name)));
   } else {
     vehicles_.emplace_back(req.parameters());
+    if (npc_vehicle_simulation_) {
+      traffic_simulator_msgs::msg::VehicleParameters parameters;
+      simulation_interface::toMsg(req.parameters(), parameters);
+      npc_vehicle_simulation_->spawn(parameters.name, parameters);
+    }
   }
   insertEntitySpawnedStatus(req, entity_type, traffic_simulator_msgs::EntitySubtype::UNKNOWN);
   auto res = simulation_api_schema::SpawnVehicleEntityResponse();
@@ -285,7 +412,7 @@ auto ScenarioSimulator::despawnEntity(const simulation_api_schema::DespawnEntity
   };
   const auto ego_entity_was_removed = remove_despawn_requested_entity_from(ego_vehicles_);
   if (ego_entity_was_removed) {
-    ego_entity_simulation_.reset();
+    ego_entity_simulations_.erase(req.name());
   }
   const auto any_entity_was_removed = ego_entity_was_removed or
                                       remove_despawn_requested_entity_from(vehicles_) or
@@ -293,6 +420,9 @@ auto ScenarioSimulator::despawnEntity(const simulation_api_schema::DespawnEntity
                                       remove_despawn_requested_entity_from(misc_objects_);
   if (any_entity_was_removed) {
     entity_status_.erase(req.name());
+    if (npc_vehicle_simulation_) {
+      npc_vehicle_simulation_->despawn(req.name());
+    }
   }
   auto res = simulation_api_schema::DespawnEntityResponse();
   res.mutable_result()->set_success(any_entity_was_removed);
@@ -302,7 +432,9 @@ auto ScenarioSimulator::despawnEntity(const simulation_api_schema::DespawnEntity
 auto ScenarioSimulator::attachImuSensor(const simulation_api_schema::AttachImuSensorRequest & req)
   -> simulation_api_schema::AttachImuSensorResponse
 {
-  sensor_sim_.attachImuSensor(current_simulation_time_, req.configuration(), *this);
+  sensor_sim_.attachImuSensor(
+    current_simulation_time_, req.configuration(), *this,
+    getTopicNamespace(req.configuration().entity()));
   auto res = simulation_api_schema::AttachImuSensorResponse();
   res.mutable_result()->set_success(true);
   return res;
@@ -312,7 +444,9 @@ auto ScenarioSimulator::attachDetectionSensor(
   const simulation_api_schema::AttachDetectionSensorRequest & req)
   -> simulation_api_schema::AttachDetectionSensorResponse
 {
-  sensor_sim_.attachDetectionSensor(current_simulation_time_, req.configuration(), *this);
+  sensor_sim_.attachDetectionSensor(
+    current_simulation_time_, req.configuration(), *this,
+    getTopicNamespace(req.configuration().entity()));
   auto res = simulation_api_schema::AttachDetectionSensorResponse();
   res.mutable_result()->set_success(true);
   return res;
@@ -322,7 +456,9 @@ auto ScenarioSimulator::attachLidarSensor(
   const simulation_api_schema::AttachLidarSensorRequest & req)
   -> simulation_api_schema::AttachLidarSensorResponse
 {
-  sensor_sim_.attachLidarSensor(current_simulation_time_, req.configuration(), *this);
+  sensor_sim_.attachLidarSensor(
+    current_simulation_time_, req.configuration(), *this,
+    getTopicNamespace(req.configuration().entity()));
   auto res = simulation_api_schema::AttachLidarSensorResponse();
   res.mutable_result()->set_success(true);
   return res;
@@ -333,7 +469,9 @@ auto ScenarioSimulator::attachOccupancyGridSensor(
   -> simulation_api_schema::AttachOccupancyGridSensorResponse
 {
   auto res = simulation_api_schema::AttachOccupancyGridSensorResponse();
-  sensor_sim_.attachOccupancyGridSensor(current_simulation_time_, req.configuration(), *this);
+  sensor_sim_.attachOccupancyGridSensor(
+    current_simulation_time_, req.configuration(), *this,
+    getTopicNamespace(req.configuration().entity()));
   res.mutable_result()->set_success(true);
   return res;
 }
@@ -342,7 +480,17 @@ auto ScenarioSimulator::updateTrafficLights(
   const simulation_api_schema::UpdateTrafficLightsRequest & req)
   -> simulation_api_schema::UpdateTrafficLightsResponse
 {
-  traffic_signals_states_ = req;
+  /// @note The request contains only the changed traffic lights, the others keep their state.
+  auto & states = *traffic_signals_states_.mutable_states();
+  for (const auto & state : req.states()) {
+    if (auto iter = std::find_if(
+          states.begin(), states.end(), [&](const auto & each) { return each.id() == state.id(); });
+        iter != states.end()) {
+      *iter = state;
+    } else {
+      *states.Add() = state;
+    }
+  }
   auto res = simulation_api_schema::UpdateTrafficLightsResponse();
   res.mutable_result()->set_success(true);
   return res;
@@ -392,6 +540,47 @@ bool ScenarioSimulator::isEgo(const std::string & name)
          }) != std::end(ego_vehicles_);
 }
 
+auto ScenarioSimulator::getTopicNamespace(const std::string & entity_name) const -> std::string
+{
+  if (const auto iter = ego_entity_simulations_.find(entity_name);
+      iter != std::end(ego_entity_simulations_)) {
+    return iter->second->topic_namespace;
+  } else {
+    return "";
+  }
+}
+
+/*
+   Entity names are free text in scenarios, but a namespace must be a legal ROS name. Characters
+   that cannot appear in a ROS name are replaced with underscores, consecutive underscores are
+   merged, and a name starting with a digit is prefixed with an underscore.
+*/
+auto ScenarioSimulator::makeTopicNamespace(const std::string & entity_name) const -> std::string
+{
+  std::string topic_namespace = "/";
+  for (const char c : entity_name) {
+    const auto legal = std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+    if (legal != '_' or topic_namespace.back() != '_') {
+      topic_namespace.push_back(legal);
+    }
+  }
+  if (topic_namespace.size() == 1 or topic_namespace == "/_") {
+    THROW_SEMANTIC_ERROR(
+      "Entity name ", std::quoted(entity_name), " cannot be converted to a topic namespace");
+  } else if (std::isdigit(static_cast<unsigned char>(topic_namespace[1]))) {
+    topic_namespace.insert(1, "_");
+  }
+  for (const auto & [name, ego_entity_simulation] : ego_entity_simulations_) {
+    if (ego_entity_simulation->topic_namespace == topic_namespace) {
+      THROW_SEMANTIC_ERROR(
+        "Egos ", std::quoted(name), " and ", std::quoted(entity_name),
+        " would share the topic namespace ", std::quoted(topic_namespace),
+        ", please rename one of them");
+    }
+  }
+  return topic_namespace;
+}
+
 bool ScenarioSimulator::isEntityExists(const std::string & name)
 {
   return entity_status_.find(name) != entity_status_.end();
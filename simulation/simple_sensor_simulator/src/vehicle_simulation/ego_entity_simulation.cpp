@@ -40,10 +40,14 @@ EgoEntitySimulation::EgoEntitySimulation(
   const traffic_simulator_msgs::msg::EntityStatus & initial_status,
   const traffic_simulator_msgs::msg::VehicleParameters & parameters, double step_time,
   const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils,
-  const rclcpp::Parameter & use_sim_time, const bool consider_acceleration_by_road_slope)
-: autoware(std::make_unique<concealer::AutowareUniverse>()),
+  const rclcpp::Parameter & use_sim_time, const bool consider_acceleration_by_road_slope,
+  const std::string & topic_namespace)
+: topic_namespace(topic_namespace),
+  autoware(std::make_unique<concealer::AutowareUniverse>(topic_namespace)),
   vehicle_model_type_(getVehicleModelType()),
-  vehicle_model_ptr_(makeSimulationModel(vehicle_model_type_, step_time, parameters)),
+  vehicle_model_substeps_(getVehicleModelSubsteps()),
+  vehicle_model_ptr_(
+    makeSimulationModel(vehicle_model_type_, step_time / vehicle_model_substeps_, parameters)),
   status_(initial_status, std::nullopt),
   consider_acceleration_by_road_slope_(consider_acceleration_by_road_slope),
   hdmap_utils_ptr_(hdmap_utils),
@@ -99,6 +103,16 @@ auto EgoEntitySimulation::getVehicleModelType() -> VehicleModelType
   }
 }
 
+auto EgoEntitySimulation::getVehicleModelSubsteps() -> int
+{
+  if (const auto substeps = getParameter<int>("vehicle_model_substeps", 1); substeps < 1) {
+    THROW_SEMANTIC_ERROR(
+      "vehicle_model_substeps must be a positive integer, but ", substeps, " specified");
+  } else {
+    return substeps;
+  }
+}
+
 auto EgoEntitySimulation::makeSimulationModel(
   const VehicleModelType vehicle_model_type, const double step_time,
   const traffic_simulator_msgs::msg::VehicleParameters & parameters)
@@ -188,7 +202,7 @@ auto EgoEntitySimulation::setAutowareStatus() -> void
 
 void EgoEntitySimulation::requestSpeedChange(double value)
 {
-  Eigen::VectorXd v(vehicle_model_ptr_->getDimX());
+  SimModelInterface::StateVector v(vehicle_model_ptr_->getDimX());
 
   switch (vehicle_model_type_) {
     case VehicleModelType::DELAY_STEER_ACC:
@@ -252,7 +266,8 @@ auto EgoEntitySimulation::overwrite(
              (previous_linear_velocity_ ? *previous_angular_velocity_ : 0) * step_time;
     }();
 
-    switch (auto state = Eigen::VectorXd(vehicle_model_ptr_->getDimX()); vehicle_model_type_) {
+    switch (auto state = SimModelInterface::StateVector(vehicle_model_ptr_->getDimX());
+            vehicle_model_type_) {
       case VehicleModelType::DELAY_STEER_ACC:
       case VehicleModelType::DELAY_STEER_ACC_GEARED:
       case VehicleModelType::DELAY_STEER_MAP_ACC_GEARED:
@@ -303,7 +318,7 @@ void EgoEntitySimulation::update(
                                status_.getMapPose().position.z - initial_pose_.position.z);
 
   if (is_npc_logic_started) {
-    auto input = Eigen::VectorXd(vehicle_model_ptr_->getDimU());
+    auto input = SimModelInterface::InputVector(vehicle_model_ptr_->getDimU());
 
     auto acceleration_by_slope = [this]() {
       if (consider_acceleration_by_road_slope_) {
@@ -340,7 +355,9 @@ void EgoEntitySimulation::update(
 
     vehicle_model_ptr_->setGear(autoware->getGearCommand().command);
     vehicle_model_ptr_->setInput(input);
-    vehicle_model_ptr_->update(step_time);
+    for (int substep = 0; substep < vehicle_model_substeps_; ++substep) {
+      vehicle_model_ptr_->update(step_time / vehicle_model_substeps_);
+    }
   }
   // only the position in the Oz axis is left unchanged, the rest is taken from SimModelInterface
   world_relative_position_.x() = vehicle_model_ptr_->getX();
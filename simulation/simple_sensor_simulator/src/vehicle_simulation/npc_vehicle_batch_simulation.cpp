@@ -0,0 +1,333 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <geometry/quaternion/euler_to_quaternion.hpp>
+#include <geometry/quaternion/quaternion_to_euler.hpp>
+#include <iomanip>
+#include <scenario_simulator_exception/exception.hpp>
+#include <simple_sensor_simulator/vehicle_simulation/npc_vehicle_batch_simulation.hpp>
+
+namespace vehicle_simulation
+{
+namespace
+{
+constexpr std::array<std::vector<double> VehicleStateArrays::*, 6> state_members = {
+  &VehicleStateArrays::x,  &VehicleStateArrays::y,     &VehicleStateArrays::yaw,
+  &VehicleStateArrays::vx, &VehicleStateArrays::steer, &VehicleStateArrays::accx};
+
+template <typename T>
+auto swapRemove(std::vector<T> & v, const std::size_t index) -> void
+{
+  v[index] = v.back();
+  v.pop_back();
+}
+
+/// @note result = base + k * h, element-wise for every state
+auto addScaled(
+  VehicleStateArrays & result, const VehicleStateArrays & base, const VehicleStateArrays & k,
+  const double h) -> void
+{
+  for (const auto member : state_members) {
+    const auto size = (base.*member).size();
+    const double * b = (base.*member).data();
+    const double * d = (k.*member).data();
+    double * r = (result.*member).data();
+    for (std::size_t i = 0; i < size; ++i) {
+      r[i] = b[i] + d[i] * h;
+    }
+  }
+}
+
+auto normalizeAngle(const double angle) -> double
+{
+  return std::atan2(std::sin(angle), std::cos(angle));
+}
+}  // namespace
+
+auto VehicleStateArrays::resize(const std::size_t size) -> void
+{
+  for (const auto member : state_members) {
+    (this->*member).resize(size, 0.0);
+  }
+}
+
+auto VehicleStateArrays::swapRemove(const std::size_t index) -> void
+{
+  for (const auto member : state_members) {
+    vehicle_simulation::swapRemove(this->*member, index);
+  }
+}
+
+NpcVehicleBatchSimulation::NpcVehicleBatchSimulation(const Parameters & parameters)
+: parameters_(parameters)
+{
+}
+
+auto NpcVehicleBatchSimulation::spawn(
+  const std::string & name, const traffic_simulator_msgs::msg::VehicleParameters & parameters)
+  -> void
+{
+  if (contains(name)) {
+    THROW_SIMULATION_ERROR("NPC vehicle ", std::quoted(name), " is already simulated");
+  }
+  index_.emplace(name, names_.size());
+  names_.push_back(name);
+
+  state_.resize(names_.size());
+  wheelbase_.push_back(
+    parameters.axles.front_axle.position_x - parameters.axles.rear_axle.position_x);
+  vx_lim_.push_back(parameters.performance.max_speed);
+  vx_rate_lim_.push_back(
+    std::max(parameters.performance.max_acceleration, parameters.performance.max_deceleration));
+  steer_lim_.push_back(parameters.axles.front_axle.max_steering);
+  steer_rate_lim_.push_back(5.0);
+
+  for (auto * reference :
+       {&reference_z_, &reference_roll_, &reference_pitch_, &reference_yaw_, &reference_vx_,
+        &reference_wz_, &reference_accx_, &acc_des_, &steer_des_}) {
+    reference->push_back(0.0);
+  }
+  initialized_.push_back(false);
+
+  for (auto & row : acc_input_queue_) {
+    row.push_back(0.0);
+  }
+  for (auto & row : steer_input_queue_) {
+    row.push_back(0.0);
+  }
+  for (auto * work_space : {&k1_, &k2_, &k3_, &k4_, &intermediate_state_}) {
+    work_space->resize(names_.size());
+  }
+}
+
+auto NpcVehicleBatchSimulation::despawn(const std::string & name) -> bool
+{
+  const auto iter = index_.find(name);
+  if (iter == std::end(index_)) {
+    return false;
+  }
+  const auto index = iter->second;
+  index_.erase(iter);
+  if (index + 1 != names_.size()) {
+    index_.at(names_.back()) = index;
+  }
+
+  swapRemove(names_, index);
+  state_.swapRemove(index);
+  for (auto * values :
+       {&wheelbase_, &vx_lim_, &vx_rate_lim_, &steer_lim_, &steer_rate_lim_, &reference_z_,
+        &reference_roll_, &reference_pitch_, &reference_yaw_, &reference_vx_, &reference_wz_,
+        &reference_accx_, &acc_des_, &steer_des_}) {
+    swapRemove(*values, index);
+  }
+  initialized_[index] = initialized_.back();
+  initialized_.pop_back();
+
+  for (auto & row : acc_input_queue_) {
+    swapRemove(row, index);
+  }
+  for (auto & row : steer_input_queue_) {
+    swapRemove(row, index);
+  }
+  for (auto * work_space : {&k1_, &k2_, &k3_, &k4_, &intermediate_state_}) {
+    work_space->resize(names_.size());
+  }
+  return true;
+}
+
+auto NpcVehicleBatchSimulation::contains(const std::string & name) const -> bool
+{
+  return index_.find(name) != std::end(index_);
+}
+
+auto NpcVehicleBatchSimulation::indexOf(const std::string & name) const -> std::size_t
+{
+  if (const auto iter = index_.find(name); iter != std::end(index_)) {
+    return iter->second;
+  } else {
+    THROW_SIMULATION_ERROR("NPC vehicle ", std::quoted(name), " is not simulated");
+  }
+}
+
+auto NpcVehicleBatchSimulation::overwrite(
+  const std::string & name, const geometry_msgs::msg::Pose & pose,
+  const geometry_msgs::msg::Twist & twist, const geometry_msgs::msg::Accel & accel) -> void
+{
+  const auto i = indexOf(name);
+  const auto rpy = math::geometry::convertQuaternionToEulerAngle(pose.orientation);
+  reference_z_[i] = pose.position.z;
+  reference_roll_[i] = rpy.x;
+  reference_pitch_[i] = rpy.y;
+  reference_yaw_[i] = rpy.z;
+  reference_vx_[i] = twist.linear.x;
+  reference_wz_[i] = twist.angular.z;
+  reference_accx_[i] = accel.linear.x;
+
+  state_.x[i] = pose.position.x;
+  state_.y[i] = pose.position.y;
+  state_.yaw[i] = rpy.z;
+  state_.vx[i] = twist.linear.x;
+  state_.steer[i] = std::abs(twist.linear.x) < 1e-3
+                      ? 0.0
+                      : std::atan(wheelbase_[i] * twist.angular.z / twist.linear.x);
+  state_.accx[i] = accel.linear.x;
+  initialized_[i] = true;
+}
+
+auto NpcVehicleBatchSimulation::setReference(
+  const std::string & name, const geometry_msgs::msg::Pose & pose,
+  const geometry_msgs::msg::Twist & twist, const geometry_msgs::msg::Accel & accel) -> void
+{
+  const auto i = indexOf(name);
+  if (
+    not initialized_[i] or
+    std::hypot(pose.position.x - state_.x[i], pose.position.y - state_.y[i]) >
+      parameters_.reset_distance) {
+    overwrite(name, pose, twist, accel);
+  } else {
+    const auto rpy = math::geometry::convertQuaternionToEulerAngle(pose.orientation);
+    reference_z_[i] = pose.position.z;
+    reference_roll_[i] = rpy.x;
+    reference_pitch_[i] = rpy.y;
+    reference_yaw_[i] = rpy.z;
+    reference_vx_[i] = twist.linear.x;
+    reference_wz_[i] = twist.angular.z;
+    reference_accx_[i] = accel.linear.x;
+  }
+}
+
+auto NpcVehicleBatchSimulation::resizeInputQueue(const double step_time) -> void
+{
+  const auto resize = [&](auto & queue, auto & head, const double delay) {
+    const auto rows = static_cast<std::size_t>(std::round(delay / step_time));
+    if (queue.size() != rows) {
+      queue.assign(rows, std::vector<double>(size(), 0.0));
+      head = 0;
+    }
+  };
+  resize(acc_input_queue_, acc_input_queue_head_, parameters_.acc_time_delay);
+  resize(steer_input_queue_, steer_input_queue_head_, parameters_.steer_time_delay);
+  queue_step_time_ = step_time;
+}
+
+auto NpcVehicleBatchSimulation::calcModel(
+  const VehicleStateArrays & state, const std::vector<double> & acc_des,
+  const std::vector<double> & steer_des, VehicleStateArrays & d_state) const -> void
+{
+  const auto acc_time_constant = std::max(parameters_.acc_time_constant, 0.03);
+  const auto steer_time_constant = std::max(parameters_.steer_time_constant, 0.03);
+  for (std::size_t i = 0; i < state.size(); ++i) {
+    const double vel = std::clamp(state.vx[i], -vx_lim_[i], vx_lim_[i]);
+    const double acc = std::clamp(state.accx[i], -vx_rate_lim_[i], vx_rate_lim_[i]);
+    const double yaw = state.yaw[i];
+    const double steer = state.steer[i];
+    const double acc_command = std::clamp(acc_des[i], -vx_rate_lim_[i], vx_rate_lim_[i]);
+    const double steer_command = std::clamp(steer_des[i], -steer_lim_[i], steer_lim_[i]);
+    const double steer_rate = std::clamp(
+      -(steer - steer_command) / steer_time_constant, -steer_rate_lim_[i], steer_rate_lim_[i]);
+
+    d_state.x[i] = vel * std::cos(yaw);
+    d_state.y[i] = vel * std::sin(yaw);
+    d_state.yaw[i] = vel * std::tan(steer) / wheelbase_[i];
+    d_state.vx[i] = acc;
+    d_state.steer[i] = steer_rate;
+    d_state.accx[i] = -(acc - acc_command) / acc_time_constant;
+  }
+}
+
+auto NpcVehicleBatchSimulation::update(const double step_time) -> void
+{
+  if (step_time != queue_step_time_) {
+    resizeInputQueue(step_time);
+  }
+
+  for (std::size_t i = 0; i < size(); ++i) {
+    acc_des_[i] = reference_accx_[i] + parameters_.velocity_gain * (reference_vx_[i] - state_.vx[i]);
+    steer_des_[i] = (std::abs(reference_vx_[i]) < 1e-3
+                       ? 0.0
+                       : std::atan(wheelbase_[i] * reference_wz_[i] / reference_vx_[i])) +
+                    parameters_.heading_gain * normalizeAngle(reference_yaw_[i] - state_.yaw[i]);
+  }
+
+  const auto delay = [](auto & queue, auto & head, auto & commands) {
+    if (not queue.empty()) {
+      std::swap_ranges(std::begin(commands), std::end(commands), std::begin(queue[head]));
+      head = (head + 1 == queue.size()) ? 0 : head + 1;
+    }
+  };
+  delay(acc_input_queue_, acc_input_queue_head_, acc_des_);
+  delay(steer_input_queue_, steer_input_queue_head_, steer_des_);
+
+  calcModel(state_, acc_des_, steer_des_, k1_);
+  addScaled(intermediate_state_, state_, k1_, 0.5 * step_time);
+  calcModel(intermediate_state_, acc_des_, steer_des_, k2_);
+  addScaled(intermediate_state_, state_, k2_, 0.5 * step_time);
+  calcModel(intermediate_state_, acc_des_, steer_des_, k3_);
+  addScaled(intermediate_state_, state_, k3_, step_time);
+  calcModel(intermediate_state_, acc_des_, steer_des_, k4_);
+
+  for (const auto member : state_members) {
+    auto & x = state_.*member;
+    const auto & d1 = k1_.*member;
+    const auto & d2 = k2_.*member;
+    const auto & d3 = k3_.*member;
+    const auto & d4 = k4_.*member;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+      x[i] += (d1[i] + 2.0 * d2[i] + 2.0 * d3[i] + d4[i]) * (step_time / 6.0);
+    }
+  }
+
+  for (std::size_t i = 0; i < size(); ++i) {
+    state_.vx[i] = std::clamp(state_.vx[i], -vx_lim_[i], vx_lim_[i]);
+  }
+}
+
+auto NpcVehicleBatchSimulation::getPose(const std::string & name) const
+  -> geometry_msgs::msg::Pose
+{
+  const auto i = indexOf(name);
+  return geometry_msgs::build<geometry_msgs::msg::Pose>()
+    .position(geometry_msgs::build<geometry_msgs::msg::Point>()
+                .x(state_.x[i])
+                .y(state_.y[i])
+                .z(reference_z_[i]))
+    .orientation(math::geometry::convertEulerAngleToQuaternion(
+      geometry_msgs::build<geometry_msgs::msg::Vector3>()
+        .x(reference_roll_[i])
+        .y(reference_pitch_[i])
+        .z(state_.yaw[i])));
+}
+
+auto NpcVehicleBatchSimulation::getTwist(const std::string & name) const
+  -> geometry_msgs::msg::Twist
+{
+  const auto i = indexOf(name);
+  geometry_msgs::msg::Twist twist;
+  twist.linear.x = state_.vx[i];
+  twist.angular.z = state_.vx[i] * std::tan(state_.steer[i]) / wheelbase_[i];
+  return twist;
+}
+
+auto NpcVehicleBatchSimulation::getAccel(const std::string & name) const
+  -> geometry_msgs::msg::Accel
+{
+  const auto i = indexOf(name);
+  geometry_msgs::msg::Accel accel;
+  accel.linear.x = state_.accx[i];
+  return accel;
+}
+}  // namespace vehicle_simulation
@@ -20,8 +20,7 @@ SimModelDelaySteerAcc::SimModelDelaySteerAcc(
   double dt, double acc_delay, double acc_time_constant, double steer_delay,
   double steer_time_constant, double steer_dead_band, double debug_acc_scaling_factor,
   double debug_steer_scaling_factor)
-: SimModelInterface(6 /* dim x */, 2 /* dim u */),
-  MIN_TIME_CONSTANT(0.03),
+: MIN_TIME_CONSTANT(0.03),
   vx_lim_(vx_lim),
   vx_rate_lim_(vx_rate_lim),
   steer_lim_(steer_lim),
@@ -51,14 +50,9 @@ double SimModelDelaySteerAcc::getWz()
 double SimModelDelaySteerAcc::getSteer() { return state_(IDX::STEER); }
 void SimModelDelaySteerAcc::update(const double & dt)
 {
-  Eigen::VectorXd delayed_input = Eigen::VectorXd::Zero(dim_u_);
-
-  acc_input_queue_.push_back(input_(IDX_U::ACCX_DES));
-  delayed_input(IDX_U::ACCX_DES) = acc_input_queue_.front();
-  acc_input_queue_.pop_front();
-  steer_input_queue_.push_back(input_(IDX_U::STEER_DES));
-  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.front();
-  steer_input_queue_.pop_front();
+  Input delayed_input = Input::Zero();
+  delayed_input(IDX_U::ACCX_DES) = acc_input_queue_.exchange(input_(IDX_U::ACCX_DES));
+  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.exchange(input_(IDX_U::STEER_DES));
 
   updateRungeKutta(dt, delayed_input);
 
@@ -67,17 +61,12 @@ void SimModelDelaySteerAcc::update(const double & dt)
 
 void SimModelDelaySteerAcc::initializeInputQueue(const double & dt)
 {
-  size_t acc_input_queue_size = static_cast<size_t>(round(acc_delay_ / dt));
-  acc_input_queue_.resize(acc_input_queue_size);
-  std::fill(acc_input_queue_.begin(), acc_input_queue_.end(), 0.0);
-
-  size_t steer_input_queue_size = static_cast<size_t>(round(steer_delay_ / dt));
-  steer_input_queue_.resize(steer_input_queue_size);
-  std::fill(steer_input_queue_.begin(), steer_input_queue_.end(), 0.0);
+  acc_input_queue_ = DelayBuffer(static_cast<size_t>(round(acc_delay_ / dt)));
+  steer_input_queue_ = DelayBuffer(static_cast<size_t>(round(steer_delay_ / dt)));
 }
 
-Eigen::VectorXd SimModelDelaySteerAcc::calcModel(
-  const Eigen::VectorXd & state, const Eigen::VectorXd & input)
+SimModelDelaySteerAcc::State SimModelDelaySteerAcc::calcModel(
+  const State & state, const Input & input) const
 {
   auto sat = [](double val, double u, double l) { return std::max(std::min(val, u), l); };
 
@@ -102,7 +91,7 @@ Eigen::VectorXd SimModelDelaySteerAcc::calcModel(
   const double steer_rate =
     sat(-steer_diff_with_dead_band / steer_time_constant_, steer_rate_lim_, -steer_rate_lim_);
 
-  Eigen::VectorXd d_state = Eigen::VectorXd::Zero(dim_x_);
+  State d_state = State::Zero();
   d_state(IDX::X) = vel * cos(yaw);
   d_state(IDX::Y) = vel * sin(yaw);
   d_state(IDX::YAW) = vel * std::tan(steer) / wheelbase_;
@@ -190,8 +190,7 @@ SimModelDelaySteerMapAccGeared::SimModelDelaySteerMapAccGeared(
   double vx_lim, double steer_lim, double vx_rate_lim, double steer_rate_lim, double wheelbase,
   double dt, double acc_delay, double acc_time_constant, double steer_delay,
   double steer_time_constant, std::string path)
-: SimModelInterface(6 /* dim x */, 2 /* dim u */),
-  MIN_TIME_CONSTANT(0.03),
+: MIN_TIME_CONSTANT(0.03),
   vx_lim_(vx_lim),
   vx_rate_lim_(vx_rate_lim),
   steer_lim_(steer_lim),
@@ -220,14 +219,9 @@ double SimModelDelaySteerMapAccGeared::getWz()
 double SimModelDelaySteerMapAccGeared::getSteer() { return state_(IDX::STEER); }
 void SimModelDelaySteerMapAccGeared::update(const double & dt)
 {
-  Eigen::VectorXd delayed_input = Eigen::VectorXd::Zero(dim_u_);
-
-  acc_input_queue_.push_back(input_(IDX_U::ACCX_DES));
-  delayed_input(IDX_U::ACCX_DES) = acc_input_queue_.front();
-  acc_input_queue_.pop_front();
-  steer_input_queue_.push_back(input_(IDX_U::STEER_DES));
-  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.front();
-  steer_input_queue_.pop_front();
+  Input delayed_input = Input::Zero();
+  delayed_input(IDX_U::ACCX_DES) = acc_input_queue_.exchange(input_(IDX_U::ACCX_DES));
+  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.exchange(input_(IDX_U::STEER_DES));
 
   const auto prev_state = state_;
   updateRungeKutta(dt, delayed_input);
@@ -242,17 +236,12 @@ void SimModelDelaySteerMapAccGeared::update(const double & dt)
 
 void SimModelDelaySteerMapAccGeared::initializeInputQueue(const double & dt)
 {
-  size_t acc_input_queue_size = static_cast<size_t>(round(acc_delay_ / dt));
-  acc_input_queue_.resize(acc_input_queue_size);
-  std::fill(acc_input_queue_.begin(), acc_input_queue_.end(), 0.0);
-
-  size_t steer_input_queue_size = static_cast<size_t>(round(steer_delay_ / dt));
-  steer_input_queue_.resize(steer_input_queue_size);
-  std::fill(steer_input_queue_.begin(), steer_input_queue_.end(), 0.0);
+  acc_input_queue_ = DelayBuffer(static_cast<size_t>(round(acc_delay_ / dt)));
+  steer_input_queue_ = DelayBuffer(static_cast<size_t>(round(steer_delay_ / dt)));
 }
 
-Eigen::VectorXd SimModelDelaySteerMapAccGeared::calcModel(
-  const Eigen::VectorXd & state, const Eigen::VectorXd & input)
+SimModelDelaySteerMapAccGeared::State SimModelDelaySteerMapAccGeared::calcModel(
+  const State & state, const Input & input) const
 {
   const double vel = std::clamp(state(IDX::VX), -vx_lim_, vx_lim_);
   const double acc = std::clamp(state(IDX::ACCX), -vx_rate_lim_, vx_rate_lim_);
@@ -263,14 +252,14 @@ Eigen::VectorXd SimModelDelaySteerMapAccGeared::calcModel(
   double steer_rate = -(steer - steer_des) / steer_time_constant_;
   steer_rate = std::clamp(steer_rate, -steer_rate_lim_, steer_rate_lim_);
 
-  Eigen::VectorXd d_state = Eigen::VectorXd::Zero(dim_x_);
+  State d_state = State::Zero();
   d_state(IDX::X) = vel * cos(yaw);
   d_state(IDX::Y) = vel * sin(yaw);
   d_state(IDX::YAW) = vel * std::tan(steer) / wheelbase_;
   d_state(IDX::VX) = acc;
   d_state(IDX::STEER) = steer_rate;
   const double converted_acc =
-    acc_map_.acceleration_map_.empty() ? acc_des : acc_map_.getAcceleration(acc_des, vel);
+    acc_map_.empty() ? acc_des : acc_map_.getAcceleration(acc_des, vel);
 
   d_state(IDX::ACCX) = -(acc - converted_acc) / acc_time_constant_;
 
@@ -278,7 +267,7 @@ Eigen::VectorXd SimModelDelaySteerMapAccGeared::calcModel(
 }
 
 void SimModelDelaySteerMapAccGeared::updateStateWithGear(
-  Eigen::VectorXd & state, const Eigen::VectorXd & prev_state, const uint8_t gear, const double dt)
+  State & state, const State & prev_state, const uint8_t gear, const double dt)
 {
   using autoware_auto_vehicle_msgs::msg::GearCommand;
   if (
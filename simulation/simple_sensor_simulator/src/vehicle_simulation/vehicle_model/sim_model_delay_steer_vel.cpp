@@ -19,8 +19,7 @@ SimModelDelaySteerVel::SimModelDelaySteerVel(
   double vx_lim, double steer_lim, double vx_rate_lim, double steer_rate_lim, double wheelbase,
   double dt, double vx_delay, double vx_time_constant, double steer_delay,
   double steer_time_constant, double steer_dead_band)
-: SimModelInterface(5 /* dim x */, 2 /* dim u */),
-  MIN_TIME_CONSTANT(0.03),
+: MIN_TIME_CONSTANT(0.03),
   vx_lim_(vx_lim),
   vx_rate_lim_(vx_rate_lim),
   steer_lim_(steer_lim),
@@ -48,34 +47,31 @@ double SimModelDelaySteerVel::getWz()
 double SimModelDelaySteerVel::getSteer() { return state_(IDX::STEER); }
 void SimModelDelaySteerVel::update(const double & dt)
 {
-  Eigen::VectorXd delayed_input = Eigen::VectorXd::Zero(dim_u_);
-
-  vx_input_queue_.push_back(input_(IDX_U::VX_DES));
-  delayed_input(IDX_U::VX_DES) = vx_input_queue_.front();
-  vx_input_queue_.pop_front();
-  steer_input_queue_.push_back(input_(IDX_U::STEER_DES));
-  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.front();
-  steer_input_queue_.pop_front();
+  Input delayed_input = Input::Zero();
+  delayed_input(IDX_U::VX_DES) = vx_input_queue_.exchange(input_(IDX_U::VX_DES));
+  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.exchange(input_(IDX_U::STEER_DES));
   // do not use deadzone_delta_steer (Steer IF does not exist in this model)
   updateRungeKutta(dt, delayed_input);
-  current_ax_ = (input_(IDX_U::VX_DES) - prev_vx_) / dt;
+  // the velocity command may be integrated in several sub steps, so ax is averaged over all of them
+  elapsed_time_since_input_ += dt;
+  current_ax_ = (input_(IDX_U::VX_DES) - prev_vx_) / elapsed_time_since_input_;
+}
+
+void SimModelDelaySteerVel::setInput(const Eigen::Ref<const Eigen::VectorXd> & input)
+{
   prev_vx_ = input_(IDX_U::VX_DES);
+  elapsed_time_since_input_ = 0.0;
+  SimModelBase::setInput(input);
 }
 
 void SimModelDelaySteerVel::initializeInputQueue(const double & dt)
 {
-  size_t vx_input_queue_size = static_cast<size_t>(round(vx_delay_ / dt));
-  for (size_t i = 0; i < vx_input_queue_size; i++) {
-    vx_input_queue_.push_back(0.0);
-  }
-  size_t steer_input_queue_size = static_cast<size_t>(round(steer_delay_ / dt));
-  for (size_t i = 0; i < steer_input_queue_size; i++) {
-    steer_input_queue_.push_back(0.0);
-  }
+  vx_input_queue_ = DelayBuffer(static_cast<size_t>(round(vx_delay_ / dt)));
+  steer_input_queue_ = DelayBuffer(static_cast<size_t>(round(steer_delay_ / dt)));
 }
 
-Eigen::VectorXd SimModelDelaySteerVel::calcModel(
-  const Eigen::VectorXd & state, const Eigen::VectorXd & input)
+SimModelDelaySteerVel::State SimModelDelaySteerVel::calcModel(
+  const State & state, const Input & input) const
 {
   auto sat = [](double val, double u, double l) { return std::max(std::min(val, u), l); };
 
@@ -100,7 +96,7 @@ Eigen::VectorXd SimModelDelaySteerVel::calcModel(
   const double steer_rate =
     sat(-steer_diff_with_dead_band / steer_time_constant_, steer_rate_lim_, -steer_rate_lim_);
 
-  Eigen::VectorXd d_state = Eigen::VectorXd::Zero(dim_x_);
+  State d_state = State::Zero();
   d_state(IDX::X) = vx * cos(yaw);
   d_state(IDX::Y) = vx * sin(yaw);
   d_state(IDX::YAW) = vx * std::tan(steer) / wheelbase_;
@@ -14,10 +14,7 @@
 
 #include <simple_sensor_simulator/vehicle_simulation/vehicle_model/sim_model_ideal_steer_vel.hpp>
 
-SimModelIdealSteerVel::SimModelIdealSteerVel(double wheelbase)
-: SimModelInterface(3 /* dim x */, 2 /* dim u */), wheelbase_(wheelbase)
-{
-}
+SimModelIdealSteerVel::SimModelIdealSteerVel(double wheelbase) : wheelbase_(wheelbase) {}
 
 double SimModelIdealSteerVel::getX() { return state_(IDX::X); }
 double SimModelIdealSteerVel::getY() { return state_(IDX::Y); }
@@ -33,18 +30,26 @@ double SimModelIdealSteerVel::getSteer() { return input_(IDX_U::STEER_DES); }
 void SimModelIdealSteerVel::update(const double & dt)
 {
   updateRungeKutta(dt, input_);
-  current_ax_ = (input_(IDX_U::VX_DES) - prev_vx_) / dt;
+  // the velocity command may be integrated in several sub steps, so ax is averaged over all of them
+  elapsed_time_since_input_ += dt;
+  current_ax_ = (input_(IDX_U::VX_DES) - prev_vx_) / elapsed_time_since_input_;
+}
+
+void SimModelIdealSteerVel::setInput(const Eigen::Ref<const Eigen::VectorXd> & input)
+{
   prev_vx_ = input_(IDX_U::VX_DES);
+  elapsed_time_since_input_ = 0.0;
+  SimModelBase::setInput(input);
 }
 
-Eigen::VectorXd SimModelIdealSteerVel::calcModel(
-  const Eigen::VectorXd & state, const Eigen::VectorXd & input)
+SimModelIdealSteerVel::State SimModelIdealSteerVel::calcModel(
+  const State & state, const Input & input) const
 {
   const double yaw = state(IDX::YAW);
   const double vx = input(IDX_U::VX_DES);
   const double steer = input(IDX_U::STEER_DES);
 
-  Eigen::VectorXd d_state = Eigen::VectorXd::Zero(dim_x_);
+  State d_state = State::Zero();
   d_state(IDX::X) = vx * std::cos(yaw);
   d_state(IDX::Y) = vx * std::sin(yaw);
   d_state(IDX::YAW) = vx * std::tan(steer) / wheelbase_;
@@ -0,0 +1,78 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <simple_sensor_simulator/vehicle_simulation/npc_vehicle_batch_simulation.hpp>
+#include <simple_sensor_simulator/vehicle_simulation/vehicle_model/sim_model.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+auto makeVehicleParameters(const std::string & name)
+{
+  traffic_simulator_msgs::msg::VehicleParameters parameters;
+  parameters.name = name;
+  parameters.performance.max_speed = 50.0;
+  parameters.performance.max_acceleration = 10.0;
+  parameters.performance.max_deceleration = 10.0;
+  parameters.axles.front_axle.max_steering = 0.5;
+  parameters.axles.front_axle.position_x = 2.5;
+  return parameters;
+}
+}  // namespace
+
+/// @note one frame of N vehicles stepped by the batch simulation
+static void batchUpdate(benchmark::State & state)
+{
+  vehicle_simulation::NpcVehicleBatchSimulation simulation({});
+  geometry_msgs::msg::Pose pose;
+  pose.orientation.w = 1.0;
+  geometry_msgs::msg::Twist twist;
+  twist.linear.x = 10.0;
+  for (int i = 0; i < state.range(0); ++i) {
+    const auto name = "npc" + std::to_string(i);
+    simulation.spawn(name, makeVehicleParameters(name));
+    pose.position.y = 4.0 * i;
+    simulation.setReference(name, pose, twist, {});
+  }
+  for (auto _ : state) {
+    simulation.update(0.01);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(batchUpdate)->Arg(10)->Arg(100)->Arg(1000);
+
+/// @note one frame of N vehicles stepped as independent DELAY_STEER_ACC models, for comparison
+static void perVehicleUpdate(benchmark::State & state)
+{
+  std::vector<std::unique_ptr<SimModelInterface>> models;
+  for (int i = 0; i < state.range(0); ++i) {
+    auto & model = models.emplace_back(std::make_unique<SimModelDelaySteerAcc>(
+      50.0, 0.5, 10.0, 5.0, 2.5, 0.01, 0.1, 0.1, 0.24, 0.27, 0.0, 1.0, 1.0));
+    model->setInput(Eigen::Vector2d(0.0, 0.0));
+    model->setState((Eigen::Matrix<double, 6, 1>() << 0.0, 0.0, 0.0, 10.0, 0.0, 0.0).finished());
+  }
+  for (auto _ : state) {
+    for (auto & model : models) {
+      model->update(0.01);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(perVehicleUpdate)->Arg(10)->Arg(100)->Arg(1000);
@@ -0,0 +1,115 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <geometry/quaternion/euler_to_quaternion.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <simple_sensor_simulator/vehicle_simulation/npc_vehicle_batch_simulation.hpp>
+
+namespace
+{
+auto makeVehicleParameters(const std::string & name)
+{
+  traffic_simulator_msgs::msg::VehicleParameters parameters;
+  parameters.name = name;
+  parameters.performance.max_speed = 50.0;
+  parameters.performance.max_acceleration = 10.0;
+  parameters.performance.max_deceleration = 10.0;
+  parameters.axles.front_axle.max_steering = 0.5;
+  parameters.axles.front_axle.position_x = 2.5;
+  parameters.axles.rear_axle.position_x = 0.0;
+  return parameters;
+}
+
+auto makePose(const double x, const double y, const double yaw)
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.orientation = math::geometry::convertEulerAngleToQuaternion(
+    geometry_msgs::build<geometry_msgs::msg::Vector3>().x(0.0).y(0.0).z(yaw));
+  return pose;
+}
+
+auto makeTwist(const double vx)
+{
+  geometry_msgs::msg::Twist twist;
+  twist.linear.x = vx;
+  return twist;
+}
+}  // namespace
+
+/**
+ * @note Test basic functionality. Test that despawning moves the last vehicle into the freed slot
+ * without mixing up the states of the remaining vehicles.
+ */
+TEST(NpcVehicleBatchSimulation, spawnDespawn)
+{
+  vehicle_simulation::NpcVehicleBatchSimulation simulation({});
+  for (const auto & name : {"a", "b", "c"}) {
+    simulation.spawn(name, makeVehicleParameters(name));
+  }
+  simulation.setReference("a", makePose(1.0, 0.0, 0.0), makeTwist(0.0), {});
+  simulation.setReference("b", makePose(2.0, 0.0, 0.0), makeTwist(0.0), {});
+  simulation.setReference("c", makePose(3.0, 0.0, 0.0), makeTwist(0.0), {});
+
+  EXPECT_TRUE(simulation.despawn("b"));
+  EXPECT_FALSE(simulation.despawn("b"));
+  EXPECT_EQ(simulation.size(), 2u);
+  EXPECT_FALSE(simulation.contains("b"));
+  EXPECT_DOUBLE_EQ(simulation.getPose("a").position.x, 1.0);
+  EXPECT_DOUBLE_EQ(simulation.getPose("c").position.x, 3.0);
+  EXPECT_THROW(simulation.getPose("b"), common::SimulationError);
+  EXPECT_THROW(simulation.spawn("a", makeVehicleParameters("a")), common::SimulationError);
+}
+
+/**
+ * @note Test calculation correctness. Test that the vehicle converges to a reference moving
+ * straight at constant speed, once the dead time and the time constants have elapsed.
+ */
+TEST(NpcVehicleBatchSimulation, followStraightReference)
+{
+  vehicle_simulation::NpcVehicleBatchSimulation simulation({});
+  simulation.spawn("npc", makeVehicleParameters("npc"));
+
+  constexpr double step_time = 0.01;
+  constexpr double speed = 10.0;
+  simulation.setReference("npc", makePose(0.0, 0.0, 0.0), makeTwist(0.0), {});
+  for (int i = 0; i < 1000; ++i) {
+    simulation.setReference("npc", makePose(speed * i * step_time, 0.0, 0.0), makeTwist(speed), {});
+    simulation.update(step_time);
+  }
+  EXPECT_NEAR(simulation.getTwist("npc").linear.x, speed, 1e-2);
+  EXPECT_NEAR(simulation.getTwist("npc").angular.z, 0.0, 1e-9);
+  EXPECT_NEAR(simulation.getPose("npc").position.y, 0.0, 1e-9);
+  EXPECT_GT(simulation.getPose("npc").position.x, 0.0);
+}
+
+/**
+ * @note Test function behavior when the reference jumps. Test that a reference farther than
+ * reset_distance re-synchronizes the vehicle state instead of being tracked.
+ */
+TEST(NpcVehicleBatchSimulation, resetOnTeleport)
+{
+  vehicle_simulation::NpcVehicleBatchSimulation simulation({});
+  simulation.spawn("npc", makeVehicleParameters("npc"));
+  simulation.setReference("npc", makePose(0.0, 0.0, 0.0), makeTwist(0.0), {});
+  simulation.update(0.01);
+
+  simulation.setReference("npc", makePose(100.0, 50.0, 1.0), makeTwist(3.0), {});
+  EXPECT_DOUBLE_EQ(simulation.getPose("npc").position.x, 100.0);
+  EXPECT_DOUBLE_EQ(simulation.getPose("npc").position.y, 50.0);
+  EXPECT_DOUBLE_EQ(simulation.getTwist("npc").linear.x, 3.0);
+}
@@ -0,0 +1,120 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <simple_sensor_simulator/vehicle_simulation/vehicle_model/sim_model.hpp>
+#include <string>
+#include <vector>
+
+constexpr double step_time = 0.05;
+
+/// @note write an acceleration map CSV of the size typically used with DELAY_STEER_MAP_ACC_GEARED
+static auto writeAccelerationMap() -> std::string
+{
+  const auto path = (std::filesystem::temp_directory_path() / "benchmark_acceleration_map.csv");
+  std::ofstream ofs(path);
+  ofs << "default";
+  for (int j = 0; j < 11; ++j) {
+    ofs << "," << 1.39 * j;
+  }
+  ofs << "\n";
+  for (int i = 0; i < 9; ++i) {
+    const double acc = -3.0 + 0.5 * i;
+    ofs << acc;
+    for (int j = 0; j < 11; ++j) {
+      ofs << "," << acc * (1.0 - 0.02 * j) - 0.01 * j * j;
+    }
+    ofs << "\n";
+  }
+  return path.string();
+}
+
+static const auto acceleration_map_path = writeAccelerationMap();
+
+template <typename Model>
+static auto makeModel() -> std::unique_ptr<SimModelInterface>
+{
+  if constexpr (std::is_same_v<Model, SimModelDelaySteerAcc>) {
+    return std::make_unique<Model>(
+      50.0, 1.0, 7.0, 5.0, 2.0, step_time, 0.1, 0.1, 0.24, 0.27, 0.0, 1.0, 1.0);
+  } else if constexpr (std::is_same_v<Model, SimModelDelaySteerAccGeared>) {
+    return std::make_unique<Model>(
+      50.0, 1.0, 7.0, 5.0, 2.0, step_time, 0.1, 0.1, 0.24, 0.27, 0.0, 1.0, 1.0);
+  } else if constexpr (std::is_same_v<Model, SimModelDelaySteerMapAccGeared>) {
+    return std::make_unique<Model>(
+      50.0, 1.0, 7.0, 5.0, 2.0, step_time, 0.1, 0.1, 0.24, 0.27, acceleration_map_path);
+  } else if constexpr (std::is_same_v<Model, SimModelDelaySteerVel>) {
+    return std::make_unique<Model>(
+      50.0, 1.0, 7.0, 5.0, 2.0, step_time, 0.1, 0.1, 0.24, 0.27, 0.0);
+  } else {
+    return std::make_unique<Model>(2.0);
+  }
+}
+
+/**
+ * @note Steps state.range(0) models of the same type through one frame each iteration, the way
+ * the simulator steps vehicles every frame, with state.range(1) integration sub steps per frame.
+ */
+template <typename Model>
+static void stepModels(benchmark::State & state)
+{
+  std::vector<std::unique_ptr<SimModelInterface>> models;
+  for (auto i = 0; i < state.range(0); ++i) {
+    models.push_back(makeModel<Model>());
+    models.back()->setInput(Eigen::Vector2d(1.0, 0.1));
+  }
+  const auto substeps = state.range(1);
+  for (auto _ : state) {
+    for (auto & model : models) {
+      for (auto i = 0; i < substeps; ++i) {
+        model->update(step_time / substeps);
+      }
+      benchmark::DoNotOptimize(model->getX());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * substeps);
+}
+
+#define BENCHMARK_SIM_MODEL(MODEL) \
+  BENCHMARK_TEMPLATE(stepModels, MODEL)->ArgsProduct({{1000, 10000}, {1, 10}})
+
+BENCHMARK_SIM_MODEL(SimModelDelaySteerAcc);
+BENCHMARK_SIM_MODEL(SimModelDelaySteerAccGeared);
+BENCHMARK_SIM_MODEL(SimModelDelaySteerMapAccGeared);
+BENCHMARK_SIM_MODEL(SimModelDelaySteerVel);
+BENCHMARK_SIM_MODEL(SimModelIdealSteerAcc);
+BENCHMARK_SIM_MODEL(SimModelIdealSteerAccGeared);
+BENCHMARK_SIM_MODEL(SimModelIdealSteerVel);
+
+#undef BENCHMARK_SIM_MODEL
+
+/// @note evaluation of the acceleration map alone, which is done in every Runge-Kutta stage
+static void getAcceleration(benchmark::State & state)
+{
+  AccelerationMap map;
+  map.readAccelerationMapFromCSV(acceleration_map_path);
+  double acc_des = -3.0;
+  double vel = 0.0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.getAcceleration(acc_des, vel));
+    acc_des = acc_des < 1.0 ? acc_des + 0.013 : -3.0;
+    vel = vel < 13.9 ? vel + 0.037 : 0.0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(getAcceleration);
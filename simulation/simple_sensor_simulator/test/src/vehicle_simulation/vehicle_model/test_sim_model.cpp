@@ -0,0 +1,271 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <initializer_list>
+#include <iomanip>
+#include <memory>
+#include <simple_sensor_simulator/vehicle_simulation/vehicle_model/sim_model.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/// @note write an acceleration map CSV, with acc_keys as rows and vel_keys as columns
+auto writeAccelerationMap(
+  const std::string & file_name, const std::vector<double> & vel_keys,
+  const std::vector<double> & acc_keys, const std::function<double(double, double)> & f)
+  -> std::string
+{
+  const auto path = (std::filesystem::temp_directory_path() / file_name).string();
+  std::ofstream ofs(path);
+  ofs << std::setprecision(17) << "default";
+  for (const auto vel : vel_keys) {
+    ofs << "," << vel;
+  }
+  ofs << "\n";
+  for (const auto acc : acc_keys) {
+    ofs << acc;
+    for (const auto vel : vel_keys) {
+      ofs << "," << f(acc, vel);
+    }
+    ofs << "\n";
+  }
+  return path;
+}
+
+/// @note interpolate the original map bilinearly over its own keys, as before it was resampled
+auto interpolateOriginalMap(
+  const std::vector<double> & vel_keys, const std::vector<double> & acc_keys,
+  const std::function<double(double, double)> & f, const double acc, const double vel) -> double
+{
+  const auto locate = [](const std::vector<double> & keys, const double value) {
+    const double clamped = std::clamp(value, keys.front(), keys.back());
+    const auto k = std::min<std::size_t>(
+      std::upper_bound(keys.begin(), keys.end(), clamped) - keys.begin() - 1, keys.size() - 2);
+    return std::make_pair(k, (clamped - keys[k]) / (keys[k + 1] - keys[k]));
+  };
+  const auto [i, ratio_acc] = locate(acc_keys, acc);
+  const auto [j, ratio_vel] = locate(vel_keys, vel);
+  const auto at = [&](const std::size_t a, const std::size_t v) {
+    return f(acc_keys[a], vel_keys[v]);
+  };
+  const double lower = at(i, j) + (at(i, j + 1) - at(i, j)) * ratio_vel;
+  const double upper = at(i + 1, j) + (at(i + 1, j + 1) - at(i + 1, j)) * ratio_vel;
+  return lower + (upper - lower) * ratio_acc;
+}
+}  // namespace
+
+/**
+ * @note Test basic functionality. Test that a zero length buffer passes commands through.
+ */
+TEST(DelayBuffer, zeroLength)
+{
+  DelayBuffer buffer(0);
+  EXPECT_EQ(buffer.size(), 0u);
+  EXPECT_DOUBLE_EQ(buffer.exchange(1.0), 1.0);
+  EXPECT_DOUBLE_EQ(buffer.exchange(2.0), 2.0);
+}
+
+/**
+ * @note Test basic functionality. Test that commands are returned after `length` steps in order,
+ * preceded by zeros, also after the ring buffer wraps around.
+ */
+TEST(DelayBuffer, delay)
+{
+  DelayBuffer buffer(3);
+  EXPECT_EQ(buffer.size(), 3u);
+  for (int i = 1; i <= 3; ++i) {
+    EXPECT_DOUBLE_EQ(buffer.exchange(i), 0.0);
+  }
+  for (int i = 4; i <= 10; ++i) {
+    EXPECT_DOUBLE_EQ(buffer.exchange(i), i - 3);
+  }
+}
+
+/**
+ * @note Test calculation correctness. Runge-Kutta integration of a constant acceleration along
+ * a straight line is exact, so the position must follow x = a * t^2 / 2.
+ */
+TEST(SimModelIdealSteerAcc, constantAcceleration)
+{
+  std::unique_ptr<SimModelInterface> model = std::make_unique<SimModelIdealSteerAcc>(2.0);
+  ASSERT_EQ(model->getDimX(), 4);
+  ASSERT_EQ(model->getDimU(), 2);
+
+  model->setInput(Eigen::Vector2d(1.0, 0.0));
+  for (int i = 0; i < 100; ++i) {
+    model->update(0.01);
+  }
+  EXPECT_NEAR(model->getX(), 0.5, 1e-9);
+  EXPECT_NEAR(model->getY(), 0.0, 1e-9);
+  EXPECT_NEAR(model->getVx(), 1.0, 1e-9);
+  EXPECT_DOUBLE_EQ(model->getAx(), 1.0);
+}
+
+/**
+ * @note Test function behavior. The acceleration command must take effect only after the
+ * configured delay has elapsed.
+ */
+TEST(SimModelDelaySteerAcc, accelerationDelay)
+{
+  constexpr double step_time = 0.05;
+  std::unique_ptr<SimModelInterface> model = std::make_unique<SimModelDelaySteerAcc>(
+    50.0, 1.0, 7.0, 5.0, 2.0, step_time, 0.1, 0.1, 0.0, 0.27, 0.0, 1.0, 1.0);
+
+  model->setInput(Eigen::Vector2d(1.0, 0.0));
+  model->update(step_time);
+  model->update(step_time);
+  EXPECT_DOUBLE_EQ(model->getAx(), 0.0);
+  EXPECT_DOUBLE_EQ(model->getVx(), 0.0);
+
+  model->update(step_time);
+  EXPECT_GT(model->getAx(), 0.0);
+}
+
+/**
+ * @note Test function behavior. Integrating one frame in several sub steps must report the same
+ * acceleration as integrating it in a single step, and must move the vehicle the same distance.
+ */
+TEST(SimModelIdealSteerVel, substeps)
+{
+  SimModelIdealSteerVel single_step(2.0);
+  SimModelIdealSteerVel sub_steps(2.0);
+  SimModelInterface & single = single_step;
+  SimModelInterface & multiple = sub_steps;
+
+  constexpr double step_time = 0.1;
+  constexpr int substeps = 10;
+  for (const double velocity : {1.0, 3.0, 2.0}) {
+    single.setInput(Eigen::Vector2d(velocity, 0.0));
+    single.update(step_time);
+    multiple.setInput(Eigen::Vector2d(velocity, 0.0));
+    for (int i = 0; i < substeps; ++i) {
+      multiple.update(step_time / substeps);
+    }
+    EXPECT_NEAR(single.getAx(), multiple.getAx(), 1e-9);
+    EXPECT_NEAR(single.getX(), multiple.getX(), 1e-9);
+  }
+}
+
+/**
+ * @note Test calculation correctness. With one update per input, velocity-input models must report
+ * the change of the velocity command divided by the step time, as they did before sub steps.
+ */
+TEST(SimModelDelaySteerVel, accelerationFromVelocityCommand)
+{
+  SimModelIdealSteerVel ideal(2.0);
+  SimModelDelaySteerVel delay(50.0, 1.0, 7.0, 5.0, 2.0, 0.1, 0.2, 0.1, 0.2, 0.1, 0.0);
+
+  constexpr double step_time = 0.1;
+  for (SimModelInterface * model : std::initializer_list<SimModelInterface *>{&ideal, &delay}) {
+    double previous_velocity = 0.0;
+    for (const double velocity : {1.0, 3.0, 3.0, 2.0}) {
+      model->setInput(Eigen::Vector2d(velocity, 0.0));
+      model->update(step_time);
+      EXPECT_DOUBLE_EQ(model->getAx(), (velocity - previous_velocity) / step_time);
+      previous_velocity = velocity;
+    }
+  }
+}
+
+/**
+ * @note Test calculation correctness. A function that is bilinear in acceleration and velocity is
+ * reproduced exactly by the interpolation of the original map, so the resampled grid must
+ * reproduce it too, also for keys that are not uniformly spaced.
+ */
+TEST(AccelerationMap, bilinearFunction)
+{
+  const auto f = [](const double acc, const double vel) {
+    return acc * (1.0 - 0.05 * vel) + 0.1 * vel;
+  };
+  AccelerationMap map;
+  ASSERT_TRUE(map.readAccelerationMapFromCSV(writeAccelerationMap(
+    "test_acceleration_map_bilinear.csv", {0.0, 1.0, 3.0, 6.0, 13.0}, {-1.0, 0.0, 0.5, 1.5}, f)));
+  for (double acc = -1.0; acc <= 1.5; acc += 0.07) {
+    for (double vel = 0.0; vel <= 13.0; vel += 0.31) {
+      EXPECT_NEAR(map.getAcceleration(acc, vel), f(acc, vel), 1e-9);
+    }
+  }
+}
+
+/**
+ * @note Test calculation correctness. For a map that is not bilinear, the resampled grid must
+ * reproduce the interpolation of the original map at points between the grid samples. Keys that
+ * are multiples of the smallest key spacing fall on the grid, so the result is exact; other keys
+ * only add an error bounded by the curvature within one grid cell.
+ */
+TEST(AccelerationMap, originalMap)
+{
+  const auto f = [](const double acc, const double vel) {
+    return std::tanh(2.0 * acc) * (1.0 - 0.04 * vel) + 0.02 * vel * vel * acc;
+  };
+  const auto check = [&](
+                       const std::string & file_name, const std::vector<double> & vel_keys,
+                       const std::vector<double> & acc_keys, const double tolerance) {
+    AccelerationMap map;
+    ASSERT_TRUE(
+      map.readAccelerationMapFromCSV(writeAccelerationMap(file_name, vel_keys, acc_keys, f)));
+    for (double acc = -1.61; acc <= 1.61; acc += 0.0123) {
+      for (double vel = -0.37; vel <= 13.37; vel += 0.0731) {
+        EXPECT_NEAR(
+          map.getAcceleration(acc, vel),
+          interpolateOriginalMap(vel_keys, acc_keys, f, acc, vel), tolerance)
+          << "acc: " << acc << ", vel: " << vel;
+      }
+    }
+  };
+  check(
+    "test_acceleration_map_aligned.csv", {0.0, 1.0, 3.0, 6.0, 13.0}, {-1.5, -0.5, 0.0, 0.5, 1.5},
+    1e-9);
+  check(
+    "test_acceleration_map_unaligned.csv", {0.0, 1.4, 3.0, 7.7, 13.0},
+    {-1.5, -0.3, 0.0, 0.7, 1.5}, 2e-2);
+}
+
+/**
+ * @note Test function behavior when inputs are out of the map. The closest value in the map must
+ * be used.
+ */
+TEST(AccelerationMap, clamp)
+{
+  const auto f = [](const double acc, const double vel) { return acc + 0.1 * vel; };
+  AccelerationMap map;
+  ASSERT_TRUE(map.readAccelerationMapFromCSV(writeAccelerationMap(
+    "test_acceleration_map_clamp.csv", {0.0, 5.0, 10.0}, {-1.0, 0.0, 1.0}, f)));
+  EXPECT_NEAR(map.getAcceleration(3.0, 20.0), f(1.0, 10.0), 1e-9);
+  EXPECT_NEAR(map.getAcceleration(-3.0, -1.0), f(-1.0, 0.0), 1e-9);
+  EXPECT_NEAR(map.getAcceleration(0.5, -1.0), f(0.5, 0.0), 1e-9);
+}
+
+/**
+ * @note Test function behavior when the map is invalid. Unsorted keys must be rejected when the
+ * map is read, not when it is evaluated.
+ */
+TEST(AccelerationMap, unsortedKeys)
+{
+  AccelerationMap map;
+  EXPECT_THROW(
+    map.readAccelerationMapFromCSV(writeAccelerationMap(
+      "test_acceleration_map_unsorted.csv", {0.0, 5.0, 3.0}, {-1.0, 0.0, 1.0},
+      [](const double acc, const double) { return acc; })),
+    std::invalid_argument);
+}
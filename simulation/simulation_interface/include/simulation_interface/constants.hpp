@@ -19,10 +19,18 @@
 
 namespace simulation_interface
 {
-enum class TransportProtocol { TCP /*, UDP*/ };
+/**
+ * @brief transport between the traffic_simulator and the simulator
+ * @note IPC and SHM can only be used when both processes run on the same host, and ignore the
+ *       hostname of the endpoint.
+ */
+enum class TransportProtocol { TCP, IPC, SHM /*, UDP*/ };
 
 std::string enumToString(const TransportProtocol & protocol);
 
+/// @note parse "tcp", "ipc" or "shm", as given by the "transport" parameter
+TransportProtocol toTransportProtocol(const std::string & protocol);
+
 enum class HostName { LOCALHOST, ANY };
 
 std::string enumToString(const HostName & hostname);
@@ -0,0 +1,97 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMULATION_INTERFACE__SHARED_MEMORY_CHANNEL_HPP_
+#define SIMULATION_INTERFACE__SHARED_MEMORY_CHANNEL_HPP_
+
+#include <google/protobuf/message_lite.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace simulation_interface
+{
+/**
+ * @brief request/response channel between two processes on the same host
+ *
+ * The channel is a POSIX shared memory object holding one single-producer single-consumer ring
+ * buffer per direction. Messages are serialized directly into the ring buffer and parsed directly
+ * from it, so no intermediate string or socket buffer is involved and no system call is made
+ * unless one side has to wait for the other.
+ */
+class SharedMemoryChannel
+{
+public:
+  enum class Role {
+    server,  // creates the shared memory object, receives requests and sends responses
+    client,  // opens the shared memory object, sends requests and receives responses
+  };
+
+  /**
+   * @param name name of the shared memory object, as given in the endpoint "shm://<name>"
+   * @param capacity size of each ring buffer in bytes, only used by the server
+   * @param timeout how long the client waits for the server to create the shared memory object
+   * @note The client throws if the timeout expires or rclcpp is shut down while it waits.
+   */
+  explicit SharedMemoryChannel(
+    const std::string & name, const Role role, const std::size_t capacity = 16 * 1024 * 1024,
+    const std::chrono::milliseconds timeout = std::chrono::seconds(60));
+
+  ~SharedMemoryChannel();
+
+  SharedMemoryChannel(const SharedMemoryChannel &) = delete;
+
+  auto operator=(const SharedMemoryChannel &) -> SharedMemoryChannel & = delete;
+
+  auto send(const google::protobuf::MessageLite &) -> void;
+
+  /**
+   * @brief wait for the next message and parse it into the given message
+   * @return false if no message arrived within the timeout
+   * @note The client skips responses to requests other than its last one, which are left behind
+   * when a call is abandoned.
+   */
+  auto receive(google::protobuf::MessageLite &, const std::chrono::milliseconds timeout) -> bool;
+
+  static auto nameFromEndPoint(const std::string & endpoint) -> std::string;
+
+private:
+  struct Ring;
+
+  struct Header;
+
+  const std::string name_;
+
+  const Role role_;
+
+  std::size_t mapped_size_ = 0;
+
+  void * mapped_ = nullptr;
+
+  Header * header_ = nullptr;
+
+  // sequence number of the last request sent by the client, or received by the server
+  std::uint64_t sequence_ = 0;
+
+  auto sendRing() const -> Ring &;
+
+  auto receiveRing() const -> Ring &;
+
+  auto data(const Ring &) const -> std::uint8_t *;
+};
+}  // namespace simulation_interface
+
+#endif  // SIMULATION_INTERFACE__SHARED_MEMORY_CHANNEL_HPP_
@@ -23,6 +23,7 @@
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
 #include <simulation_interface/constants.hpp>
+#include <simulation_interface/shared_memory_channel.hpp>
 #include <string>
 #include <thread>
 #include <zmqpp/zmqpp.hpp>
@@ -93,6 +94,11 @@ private:
   const zmqpp::socket_type type_;
   zmqpp::socket socket_;
 
+  const std::string endpoint_;
+
+  // used instead of the socket if the transport protocol is SHM, opened on the first call
+  std::unique_ptr<simulation_interface::SharedMemoryChannel> channel_;
+
   bool is_running = true;
 };
 }  // namespace zeromq
@@ -18,9 +18,11 @@
 #include <simulation_api_schema.pb.h>
 
 #include <functional>
+#include <memory>
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
 #include <simulation_interface/constants.hpp>
+#include <simulation_interface/shared_memory_channel.hpp>
 #include <string>
 #include <thread>
 #include <tuple>
@@ -40,8 +42,15 @@ public:
     socket_(context_, type_),
     functions_(std::forward<decltype(xs)>(xs)...)
   {
-    socket_.bind(simulation_interface::getEndPoint(protocol, hostname, socket_port));
-    poller_.add(socket_);
+    const auto endpoint = simulation_interface::getEndPoint(protocol, hostname, socket_port);
+    if (protocol == simulation_interface::TransportProtocol::SHM) {
+      channel_ = std::make_unique<simulation_interface::SharedMemoryChannel>(
+        simulation_interface::SharedMemoryChannel::nameFromEndPoint(endpoint),
+        simulation_interface::SharedMemoryChannel::Role::server);
+    } else {
+      socket_.bind(endpoint);
+      poller_.add(socket_);
+    }
     thread_ = std::thread(&MultiServer::start_poll, this);
   }
 
@@ -49,13 +58,19 @@ public:
 
 private:
   void poll();
+  void pollSharedMemory();
   void start_poll();
+  void handle(
+    const simulation_api_schema::SimulationRequest &, simulation_api_schema::SimulationResponse &);
   std::thread thread_;
   const zmqpp::context context_;
   const zmqpp::socket_type type_;
   zmqpp::poller poller_;
   zmqpp::socket socket_;
 
+  // used instead of the socket if the transport protocol is SHM
+  std::unique_ptr<simulation_interface::SharedMemoryChannel> channel_;
+
 #define DEFINE_FUNCTION_TYPE(TYPENAME)                                      \
   using TYPENAME = std::function<simulation_api_schema::TYPENAME##Response( \
     const simulation_api_schema::TYPENAME##Request &)>
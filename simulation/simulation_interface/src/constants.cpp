@@ -21,15 +21,21 @@ namespace simulation_interface
 std::string getEndPoint(
   const TransportProtocol & protocol, const HostName & hostname, const unsigned int & port)
 {
-  return simulation_interface::enumToString(protocol) + "://" +
-         simulation_interface::enumToString(hostname) + ":" + std::to_string(port);
+  return getEndPoint(protocol, simulation_interface::enumToString(hostname), port);
 }
 
 std::string getEndPoint(
   const TransportProtocol & protocol, const std::string & hostname, const unsigned int & port)
 {
-  return simulation_interface::enumToString(protocol) + "://" + hostname + ":" +
-         std::to_string(port);
+  switch (protocol) {
+    case TransportProtocol::IPC:
+      return "ipc:///tmp/simulation_interface_" + std::to_string(port);
+    case TransportProtocol::SHM:
+      return "shm://simulation_interface_" + std::to_string(port);
+    default:
+      return simulation_interface::enumToString(protocol) + "://" + hostname + ":" +
+             std::to_string(port);
+  }
 }
 
 std::string enumToString(const TransportProtocol & protocol)
@@ -37,12 +43,30 @@ std::string enumToString(const TransportProtocol & protocol)
   switch (protocol) {
     case TransportProtocol::TCP:
       return "tcp";
+    case TransportProtocol::IPC:
+      return "ipc";
+    case TransportProtocol::SHM:
+      return "shm";
       /*
     case TransportProtocol::UDP:
       return "udp";              
       */
   }
-  THROW_SIMULATION_ERROR("Protocol should be TCP.");  // LCOV_EXCL_LINE
+  THROW_SIMULATION_ERROR("Protocol should be TCP, IPC or SHM.");  // LCOV_EXCL_LINE
+}
+
+TransportProtocol toTransportProtocol(const std::string & protocol)
+{
+  if (protocol == "tcp") {
+    return TransportProtocol::TCP;
+  } else if (protocol == "ipc") {
+    return TransportProtocol::IPC;
+  } else if (protocol == "shm") {
+    return TransportProtocol::SHM;
+  } else {
+    THROW_SIMULATION_ERROR(
+      "Unknown transport protocol ", protocol, ", it should be tcp, ipc or shm.");
+  }
 }
 
 std::string enumToString(const HostName & hostname)
@@ -0,0 +1,303 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/interprocess/sync/interprocess_condition.hpp>
+#include <boost/interprocess/sync/interprocess_mutex.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <rclcpp/utilities.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <simulation_interface/shared_memory_channel.hpp>
+#include <string>
+#include <thread>
+
+namespace simulation_interface
+{
+namespace
+{
+constexpr std::uint64_t magic_number = 0x73696d5f73686d31;  // "sim_shm1"
+
+/**
+   Every record starts with the size of the serialized message, followed by the sequence number of
+   the request, which the response repeats. The size alone is written at the end of the buffer to
+   tell the consumer to continue from the beginning, so it is read before the sequence number.
+*/
+constexpr std::size_t record_size_field_size = sizeof(std::uint64_t);
+
+constexpr std::size_t record_header_size = record_size_field_size + sizeof(std::uint64_t);
+
+/// @note record size value telling the consumer to continue from the beginning of the buffer
+constexpr std::uint64_t wrap_around = std::numeric_limits<std::uint64_t>::max();
+
+constexpr auto align(const std::size_t size, const std::size_t alignment) -> std::size_t
+{
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+constexpr auto recordSize(const std::size_t message_size) -> std::size_t
+{
+  return record_header_size + align(message_size, record_size_field_size);
+}
+
+auto deadline(const std::chrono::milliseconds timeout)
+{
+  return boost::posix_time::microsec_clock::universal_time() +
+         boost::posix_time::milliseconds(timeout.count());
+}
+}  // namespace
+
+struct SharedMemoryChannel::Ring
+{
+  boost::interprocess::interprocess_mutex mutex;
+
+  boost::interprocess::interprocess_condition readable;
+
+  boost::interprocess::interprocess_condition writable;
+
+  std::uint64_t head = 0;  // total number of bytes published by the producer
+
+  std::uint64_t tail = 0;  // total number of bytes released by the consumer
+
+  std::uint64_t offset = 0;  // offset of the buffer from the beginning of the shared memory
+};
+
+struct SharedMemoryChannel::Header
+{
+  std::atomic<std::uint64_t> magic;
+
+  std::uint64_t capacity;
+
+  std::atomic<std::uint64_t> sequence;  // sequence number of the last request of any client
+
+  Ring request;
+
+  Ring response;
+};
+
+SharedMemoryChannel::SharedMemoryChannel(
+  const std::string & name, const Role role, const std::size_t capacity,
+  const std::chrono::milliseconds timeout)
+: name_("/" + name), role_(role)
+{
+  switch (role_) {
+    case Role::server: {
+      const auto aligned_capacity = align(capacity, 64);
+      const auto header_size = align(sizeof(Header), 64);
+      mapped_size_ = header_size + 2 * aligned_capacity;
+      // remove the shared memory object left by a server that was not shut down cleanly
+      ::shm_unlink(name_.c_str());
+      const auto fd = ::shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+      if (fd < 0) {
+        THROW_SIMULATION_ERROR("Failed to create shared memory ", name_, ": ", std::strerror(errno));
+      }
+      if (::ftruncate(fd, mapped_size_) != 0) {
+        ::close(fd);
+        THROW_SIMULATION_ERROR("Failed to allocate shared memory ", name_, ": ", std::strerror(errno));
+      }
+      mapped_ = ::mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      ::close(fd);
+      if (mapped_ == MAP_FAILED) {
+        THROW_SIMULATION_ERROR("Failed to map shared memory ", name_, ": ", std::strerror(errno));
+      }
+      header_ = new (mapped_) Header();
+      header_->capacity = aligned_capacity;
+      header_->sequence.store(0, std::memory_order_relaxed);
+      header_->request.offset = header_size;
+      header_->response.offset = header_size + aligned_capacity;
+      header_->magic.store(magic_number, std::memory_order_release);
+      break;
+    }
+    case Role::client: {
+      const auto until = std::chrono::steady_clock::now() + timeout;
+      const auto wait = [&](const char * what) {
+        if (not rclcpp::ok()) {
+          THROW_SIMULATION_ERROR("Interrupted while waiting for ", what, " ", name_, ".");
+        } else if (until < std::chrono::steady_clock::now()) {
+          THROW_SIMULATION_ERROR(
+            "Timed out after ", timeout.count(), " ms while waiting for ", what, " ", name_,
+            ". Please check that the simulator is running with the same transport and port.");
+        } else {
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+      };
+      int fd = -1;
+      struct stat status = {};
+      while ((fd = ::shm_open(name_.c_str(), O_RDWR, 0)) < 0 or ::fstat(fd, &status) != 0 or
+             static_cast<std::size_t>(status.st_size) < sizeof(Header)) {
+        if (0 <= fd) {
+          ::close(fd);
+        }
+        wait("shared memory");
+      }
+      mapped_size_ = status.st_size;
+      mapped_ = ::mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      ::close(fd);
+      if (mapped_ == MAP_FAILED) {
+        THROW_SIMULATION_ERROR("Failed to map shared memory ", name_, ": ", std::strerror(errno));
+      }
+      header_ = static_cast<Header *>(mapped_);
+      while (header_->magic.load(std::memory_order_acquire) != magic_number) {
+        wait("initialization of shared memory");
+      }
+      break;
+    }
+  }
+}
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+  if (mapped_ and mapped_ != MAP_FAILED) {
+    ::munmap(mapped_, mapped_size_);
+  }
+  if (role_ == Role::server) {
+    ::shm_unlink(name_.c_str());
+  }
+}
+
+auto SharedMemoryChannel::nameFromEndPoint(const std::string & endpoint) -> std::string
+{
+  constexpr auto scheme = "shm://";
+  if (endpoint.rfind(scheme, 0) != 0) {
+    THROW_SIMULATION_ERROR("Endpoint ", endpoint, " is not a shared memory endpoint.");
+  }
+  return endpoint.substr(std::strlen(scheme));
+}
+
+auto SharedMemoryChannel::sendRing() const -> Ring &
+{
+  return role_ == Role::server ? header_->response : header_->request;
+}
+
+auto SharedMemoryChannel::receiveRing() const -> Ring &
+{
+  return role_ == Role::server ? header_->request : header_->response;
+}
+
+auto SharedMemoryChannel::data(const Ring & ring) const -> std::uint8_t *
+{
+  return static_cast<std::uint8_t *>(mapped_) + ring.offset;
+}
+
+auto SharedMemoryChannel::send(const google::protobuf::MessageLite & message) -> void
+{
+  auto & ring = sendRing();
+  const auto capacity = header_->capacity;
+  const auto message_size = message.ByteSizeLong();
+  const auto record_size = recordSize(message_size);
+  if (capacity < 2 * record_size) {
+    THROW_SIMULATION_ERROR(
+      "Message of ", message_size, " bytes does not fit in shared memory ", name_, " of ", capacity,
+      " bytes.");
+  }
+
+  std::uint8_t * record = nullptr;
+  {
+    boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex> lock(ring.mutex);
+    const auto position = ring.head % capacity;
+    const auto contiguous = capacity - position;
+    const auto required = record_size <= contiguous ? record_size : contiguous + record_size;
+    while (capacity - (ring.head - ring.tail) < required) {
+      ring.writable.wait(lock);
+    }
+    if (contiguous < record_size) {
+      std::memcpy(data(ring) + position, &wrap_around, record_size_field_size);
+      ring.head += contiguous;
+    }
+    record = data(ring) + ring.head % capacity;
+  }
+
+  /*
+     A client numbers its requests from the counter shared by all clients, so that a response to a
+     request of an earlier call or of a destroyed client is never mistaken for the response to this
+     one. The server repeats the sequence number of the request it responds to.
+  */
+  if (role_ == Role::client) {
+    sequence_ = header_->sequence.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  // serialization is done without the lock, since the consumer never reads beyond head
+  const std::uint64_t size = message_size;
+  std::memcpy(record, &size, record_size_field_size);
+  std::memcpy(record + record_size_field_size, &sequence_, sizeof(sequence_));
+  message.SerializeWithCachedSizesToArray(record + record_header_size);
+
+  {
+    boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex> lock(ring.mutex);
+    ring.head += record_size;
+  }
+  ring.readable.notify_one();
+}
+
+auto SharedMemoryChannel::receive(
+  google::protobuf::MessageLite & message, const std::chrono::milliseconds timeout) -> bool
+{
+  auto & ring = receiveRing();
+  const auto capacity = header_->capacity;
+  const auto until = deadline(timeout);
+
+  const std::uint8_t * record = nullptr;
+  std::uint64_t size = 0;
+  {
+    boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex> lock(ring.mutex);
+    while (true) {
+      while (ring.head == ring.tail) {
+        if (not ring.readable.timed_wait(lock, until) and ring.head == ring.tail) {
+          return false;
+        }
+      }
+      const auto position = ring.tail % capacity;
+      std::memcpy(&size, data(ring) + position, record_size_field_size);
+      if (size == wrap_around) {
+        ring.tail += capacity - position;
+        ring.writable.notify_one();
+        continue;
+      }
+      std::uint64_t sequence = 0;
+      std::memcpy(&sequence, data(ring) + position + record_size_field_size, sizeof(sequence));
+      if (role_ == Role::client and sequence != sequence_) {
+        // a stale response to a request that its client did not wait for
+        ring.tail += recordSize(size);
+        ring.writable.notify_one();
+      } else {
+        sequence_ = sequence;
+        record = data(ring) + position;
+        break;
+      }
+    }
+  }
+
+  // parsing is done without the lock, since the producer never writes beyond tail
+  const auto parsed = message.ParseFromArray(record + record_header_size, size);
+
+  {
+    boost::interprocess::scoped_lock<boost::interprocess::interprocess_mutex> lock(ring.mutex);
+    ring.tail += recordSize(size);
+  }
+  ring.writable.notify_one();
+
+  if (not parsed) {
+    THROW_SIMULATION_ERROR("Failed to parse message received over shared memory ", name_, ".");
+  }
+  return true;
+}
+}  // namespace simulation_interface
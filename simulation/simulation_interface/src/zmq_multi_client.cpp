@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <memory>
 #include <rclcpp/utilities.hpp>
 #include <simulation_interface/conversions.hpp>
 #include <simulation_interface/zmq_multi_client.hpp>
@@ -25,9 +27,12 @@ MultiClient::MultiClient(
   hostname(hostname),
   context_(zmqpp::context()),
   type_(zmqpp::socket_type::request),
-  socket_(context_, type_)
+  socket_(context_, type_),
+  endpoint_(simulation_interface::getEndPoint(protocol, hostname, socket_port))
 {
-  socket_.connect(simulation_interface::getEndPoint(protocol, hostname, socket_port));
+  if (protocol != simulation_interface::TransportProtocol::SHM) {
+    socket_.connect(endpoint_);
+  }
 }
 
 void MultiClient::closeConnection()
@@ -35,6 +40,7 @@ void MultiClient::closeConnection()
   if (is_running) {
     is_running = false;
     socket_.close();
+    channel_.reset();
   }
 }
 
@@ -43,6 +49,21 @@ MultiClient::~MultiClient() { closeConnection(); }
 auto MultiClient::call(const simulation_api_schema::SimulationRequest & req)
   -> simulation_api_schema::SimulationResponse
 {
+  if (protocol == simulation_interface::TransportProtocol::SHM) {
+    if (not channel_) {
+      channel_ = std::make_unique<simulation_interface::SharedMemoryChannel>(
+        simulation_interface::SharedMemoryChannel::nameFromEndPoint(endpoint_),
+        simulation_interface::SharedMemoryChannel::Role::client);
+    }
+    channel_->send(req);
+    simulation_api_schema::SimulationResponse response;
+    while (not channel_->receive(response, std::chrono::milliseconds(100))) {
+      if (not rclcpp::ok()) {
+        return {};
+      }
+    }
+    return response;
+  }
   zmqpp::message message = toZMQ(req);
   socket_.send(message);
   zmqpp::message buffer;
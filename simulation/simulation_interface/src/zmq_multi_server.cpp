@@ -22,79 +22,97 @@ MultiServer::~MultiServer() { thread_.join(); }
 
 void MultiServer::poll()
 {
+  if (channel_) {
+    return pollSharedMemory();
+  }
   constexpr long timeout_ms = 1L;
   poller_.poll(timeout_ms);
   if (poller_.has_input(socket_)) {
     simulation_api_schema::SimulationResponse sim_response;
     zmqpp::message sim_request;
     socket_.receive(sim_request);
-    auto proto = toProto<simulation_api_schema::SimulationRequest>(sim_request);
-    switch (proto.request_case()) {
-      case simulation_api_schema::SimulationRequest::RequestCase::kInitialize:
-        *sim_response.mutable_initialize() = std::get<Initialize>(functions_)(proto.initialize());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kUpdateFrame:
-        *sim_response.mutable_update_frame() =
-          std::get<UpdateFrame>(functions_)(proto.update_frame());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kSpawnVehicleEntity:
-        *sim_response.mutable_spawn_vehicle_entity() =
-          std::get<SpawnVehicleEntity>(functions_)(proto.spawn_vehicle_entity());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kSpawnPedestrianEntity:
-        *sim_response.mutable_spawn_pedestrian_entity() =
-          std::get<SpawnPedestrianEntity>(functions_)(proto.spawn_pedestrian_entity());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kSpawnMiscObjectEntity:
-        *sim_response.mutable_spawn_misc_object_entity() =
-          std::get<SpawnMiscObjectEntity>(functions_)(proto.spawn_misc_object_entity());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kDespawnEntity:
-        *sim_response.mutable_despawn_entity() =
-          std::get<DespawnEntity>(functions_)(proto.despawn_entity());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kUpdateEntityStatus:
-        *sim_response.mutable_update_entity_status() =
-          std::get<UpdateEntityStatus>(functions_)(proto.update_entity_status());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kAttachImuSensor:
-        *sim_response.mutable_attach_imu_sensor() =
-          std::get<AttachImuSensor>(functions_)(proto.attach_imu_sensor());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kAttachLidarSensor:
-        *sim_response.mutable_attach_lidar_sensor() =
-          std::get<AttachLidarSensor>(functions_)(proto.attach_lidar_sensor());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kAttachDetectionSensor:
-        *sim_response.mutable_attach_detection_sensor() =
-          std::get<AttachDetectionSensor>(functions_)(proto.attach_detection_sensor());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kAttachOccupancyGridSensor:
-        *sim_response.mutable_attach_occupancy_grid_sensor() =
-          std::get<AttachOccupancyGridSensor>(functions_)(proto.attach_occupancy_grid_sensor());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kUpdateTrafficLights:
-        *sim_response.mutable_update_traffic_lights() =
-          std::get<UpdateTrafficLights>(functions_)(proto.update_traffic_lights());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kAttachPseudoTrafficLightDetector:
-        *sim_response.mutable_attach_pseudo_traffic_light_detector() =
-          std::get<AttachPseudoTrafficLightDetector>(functions_)(
-            proto.attach_pseudo_traffic_light_detector());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::kUpdateStepTime:
-        *sim_response.mutable_update_step_time() =
-          std::get<UpdateStepTime>(functions_)(proto.update_step_time());
-        break;
-      case simulation_api_schema::SimulationRequest::RequestCase::REQUEST_NOT_SET: {
-        THROW_SIMULATION_ERROR("No case defined for oneof in SimulationRequest message");
-      }
-    }
+    handle(toProto<simulation_api_schema::SimulationRequest>(sim_request), sim_response);
     auto msg = toZMQ(sim_response);
     socket_.send(msg);
   }
 }
 
+void MultiServer::pollSharedMemory()
+{
+  simulation_api_schema::SimulationRequest request;
+  if (channel_->receive(request, std::chrono::milliseconds(1))) {
+    simulation_api_schema::SimulationResponse response;
+    handle(request, response);
+    channel_->send(response);
+  }
+}
+
+void MultiServer::handle(
+  const simulation_api_schema::SimulationRequest & request,
+  simulation_api_schema::SimulationResponse & response)
+{
+  switch (request.request_case()) {
+    case simulation_api_schema::SimulationRequest::RequestCase::kInitialize:
+      *response.mutable_initialize() = std::get<Initialize>(functions_)(request.initialize());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kUpdateFrame:
+      *response.mutable_update_frame() = std::get<UpdateFrame>(functions_)(request.update_frame());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kSpawnVehicleEntity:
+      *response.mutable_spawn_vehicle_entity() =
+        std::get<SpawnVehicleEntity>(functions_)(request.spawn_vehicle_entity());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kSpawnPedestrianEntity:
+      *response.mutable_spawn_pedestrian_entity() =
+        std::get<SpawnPedestrianEntity>(functions_)(request.spawn_pedestrian_entity());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kSpawnMiscObjectEntity:
+      *response.mutable_spawn_misc_object_entity() =
+        std::get<SpawnMiscObjectEntity>(functions_)(request.spawn_misc_object_entity());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kDespawnEntity:
+      *response.mutable_despawn_entity() =
+        std::get<DespawnEntity>(functions_)(request.despawn_entity());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kUpdateEntityStatus:
+      *response.mutable_update_entity_status() =
+        std::get<UpdateEntityStatus>(functions_)(request.update_entity_status());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kAttachImuSensor:
+      *response.mutable_attach_imu_sensor() =
+        std::get<AttachImuSensor>(functions_)(request.attach_imu_sensor());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kAttachLidarSensor:
+      *response.mutable_attach_lidar_sensor() =
+        std::get<AttachLidarSensor>(functions_)(request.attach_lidar_sensor());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kAttachDetectionSensor:
+      *response.mutable_attach_detection_sensor() =
+        std::get<AttachDetectionSensor>(functions_)(request.attach_detection_sensor());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kAttachOccupancyGridSensor:
+      *response.mutable_attach_occupancy_grid_sensor() =
+        std::get<AttachOccupancyGridSensor>(functions_)(request.attach_occupancy_grid_sensor());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kUpdateTrafficLights:
+      *response.mutable_update_traffic_lights() =
+        std::get<UpdateTrafficLights>(functions_)(request.update_traffic_lights());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kAttachPseudoTrafficLightDetector:
+      *response.mutable_attach_pseudo_traffic_light_detector() =
+        std::get<AttachPseudoTrafficLightDetector>(functions_)(
+          request.attach_pseudo_traffic_light_detector());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::kUpdateStepTime:
+      *response.mutable_update_step_time() =
+        std::get<UpdateStepTime>(functions_)(request.update_step_time());
+      break;
+    case simulation_api_schema::SimulationRequest::RequestCase::REQUEST_NOT_SET: {
+      THROW_SIMULATION_ERROR("No case defined for oneof in SimulationRequest message");
+    }
+  }
+}
+
 void MultiServer::start_poll()
 {
   while (rclcpp::ok()) {
@@ -0,0 +1,183 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <simulation_api_schema.pb.h>
+#include <unistd.h>
+
+#include <rclcpp/rclcpp.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <simulation_interface/constants.hpp>
+#include <simulation_interface/shared_memory_channel.hpp>
+#include <string>
+#include <thread>
+
+using simulation_interface::SharedMemoryChannel;
+
+auto channelName() -> std::string
+{
+  return "test_shared_memory_channel_" + std::to_string(::getpid());
+}
+
+auto makeRequest(const int index) -> simulation_api_schema::SimulationRequest
+{
+  simulation_api_schema::SimulationRequest request;
+  auto despawn = request.mutable_despawn_entity();
+  // vary the size of the messages, so that the records wrap around at different positions
+  despawn->set_name(std::string(1 + (index * 37) % 1000, 'a' + index % 26));
+  return request;
+}
+
+/**
+ * @brief Test cases
+ */
+
+TEST(SharedMemoryChannel, EndPoint)
+{
+  EXPECT_EQ(
+    simulation_interface::getEndPoint(
+      simulation_interface::TransportProtocol::SHM, simulation_interface::HostName::ANY, 5555),
+    "shm://simulation_interface_5555");
+  EXPECT_EQ(
+    SharedMemoryChannel::nameFromEndPoint("shm://simulation_interface_5555"),
+    "simulation_interface_5555");
+  EXPECT_THROW(
+    SharedMemoryChannel::nameFromEndPoint("tcp://localhost:5555"), common::SimulationError);
+  EXPECT_EQ(
+    simulation_interface::toTransportProtocol("shm"), simulation_interface::TransportProtocol::SHM);
+  EXPECT_THROW(simulation_interface::toTransportProtocol("udp"), common::SimulationError);
+}
+
+TEST(SharedMemoryChannel, Timeout)
+{
+  SharedMemoryChannel server(channelName(), SharedMemoryChannel::Role::server, 4096);
+  simulation_api_schema::SimulationRequest request;
+  EXPECT_FALSE(server.receive(request, std::chrono::milliseconds(10)));
+}
+
+TEST(SharedMemoryChannel, RequestResponse)
+{
+  constexpr int count = 2000;
+  // the capacity is small compared to the total size of the messages, to exercise wrap around
+  SharedMemoryChannel server(channelName(), SharedMemoryChannel::Role::server, 4096);
+
+  std::thread server_thread([&server]() {
+    for (int i = 0; i < count; ++i) {
+      simulation_api_schema::SimulationRequest request;
+      while (not server.receive(request, std::chrono::milliseconds(100))) {
+      }
+      simulation_api_schema::SimulationResponse response;
+      response.mutable_despawn_entity()->mutable_result()->set_description(
+        request.despawn_entity().name());
+      server.send(response);
+    }
+  });
+
+  SharedMemoryChannel client(channelName(), SharedMemoryChannel::Role::client);
+  for (int i = 0; i < count; ++i) {
+    const auto request = makeRequest(i);
+    client.send(request);
+    simulation_api_schema::SimulationResponse response;
+    ASSERT_TRUE(client.receive(response, std::chrono::seconds(10)));
+    EXPECT_EQ(response.despawn_entity().result().description(), request.despawn_entity().name());
+  }
+  server_thread.join();
+}
+
+TEST(SharedMemoryChannel, Pipelined)
+{
+  constexpr int count = 2000;
+  SharedMemoryChannel server(channelName(), SharedMemoryChannel::Role::server, 4096);
+  SharedMemoryChannel client(channelName(), SharedMemoryChannel::Role::client);
+
+  // the producer blocks while the ring buffer is full, so messages arrive complete and in order
+  std::thread client_thread([&client]() {
+    for (int i = 0; i < count; ++i) {
+      client.send(makeRequest(i));
+    }
+  });
+
+  for (int i = 0; i < count; ++i) {
+    simulation_api_schema::SimulationRequest request;
+    ASSERT_TRUE(server.receive(request, std::chrono::seconds(10)));
+    EXPECT_EQ(request.despawn_entity().name(), makeRequest(i).despawn_entity().name());
+  }
+  client_thread.join();
+}
+
+TEST(SharedMemoryChannel, StaleResponse)
+{
+  SharedMemoryChannel server(channelName(), SharedMemoryChannel::Role::server, 4096);
+  const auto respond = [&server]() {
+    simulation_api_schema::SimulationRequest request;
+    ASSERT_TRUE(server.receive(request, std::chrono::seconds(10)));
+    simulation_api_schema::SimulationResponse response;
+    response.mutable_despawn_entity()->mutable_result()->set_description(
+      request.despawn_entity().name());
+    server.send(response);
+  };
+
+  const auto expectResponse = [](SharedMemoryChannel & client, const int index) {
+    simulation_api_schema::SimulationResponse response;
+    ASSERT_TRUE(client.receive(response, std::chrono::seconds(10)));
+    EXPECT_EQ(
+      response.despawn_entity().result().description(), makeRequest(index).despawn_entity().name());
+  };
+
+  // a client that is destroyed before receiving the response to its request
+  {
+    SharedMemoryChannel client(channelName(), SharedMemoryChannel::Role::client);
+    client.send(makeRequest(1));
+  }
+  respond();
+
+  SharedMemoryChannel client(channelName(), SharedMemoryChannel::Role::client);
+  client.send(makeRequest(2));
+  respond();
+  expectResponse(client, 2);
+
+  // a call that is abandoned before receiving the response, as on shutdown
+  client.send(makeRequest(3));
+  respond();
+  client.send(makeRequest(4));
+  respond();
+  expectResponse(client, 4);
+}
+
+TEST(SharedMemoryChannel, ConnectionTimeout)
+{
+  EXPECT_THROW(
+    SharedMemoryChannel(
+      channelName() + "_without_server", SharedMemoryChannel::Role::client, 0,
+      std::chrono::milliseconds(50)),
+    common::SimulationError);
+}
+
+TEST(SharedMemoryChannel, MessageTooLarge)
+{
+  SharedMemoryChannel server(channelName(), SharedMemoryChannel::Role::server, 4096);
+  SharedMemoryChannel client(channelName(), SharedMemoryChannel::Role::client);
+  simulation_api_schema::SimulationRequest request;
+  request.mutable_despawn_entity()->set_name(std::string(4096, 'a'));
+  EXPECT_THROW(client.send(request), common::SimulationError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  const auto result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
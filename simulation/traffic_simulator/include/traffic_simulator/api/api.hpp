@@ -37,11 +37,13 @@
 #include <traffic_simulator/entity/entity_base.hpp>
 #include <traffic_simulator/entity/entity_manager.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <traffic_simulator/helper/frame_profiler.hpp>
 #include <traffic_simulator/helper/helper.hpp>
 #include <traffic_simulator/simulation_clock/simulation_clock.hpp>
 #include <traffic_simulator/traffic/traffic_controller.hpp>
 #include <traffic_simulator/traffic_lights/traffic_light.hpp>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
+#include <traffic_simulator_msgs/msg/frame_profile.hpp>
 #include <utility>
 
 namespace traffic_simulator
@@ -67,6 +69,9 @@ public:
   : configuration(configuration),
     node_parameters_(
       rclcpp::node_interfaces::get_node_parameters_interface(std::forward<NodeT>(node))),
+    frame_profiler_(std::make_shared<helper::FrameProfiler>(
+      configuration.frame_trace_path.empty() ? 0 : frame_trace_capacity)),
+    frame_sections_(*frame_profiler_),
     entity_manager_ptr_(
       std::make_shared<entity::EntityManager>(node, configuration, node_parameters_)),
     traffic_controller_ptr_(std::make_shared<traffic::TrafficController>(
@@ -84,6 +89,8 @@ public:
       rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
     debug_marker_pub_(rclcpp::create_publisher<visualization_msgs::msg::MarkerArray>(
       node, "debug_marker", rclcpp::QoS(100), rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
+    frame_profile_pub_(rclcpp::create_publisher<traffic_simulator_msgs::msg::FrameProfile>(
+      node, "frame_profile", rclcpp::QoS(1), rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
     real_time_factor_subscriber(rclcpp::create_subscription<std_msgs::msg::Float64>(
       node, "/real_time_factor", rclcpp::QoS(rclcpp::KeepLast(1)).best_effort(),
       [this](const std_msgs::msg::Float64 & message) {
@@ -100,10 +107,12 @@ public:
       })),
     clock_(node->get_parameter("use_sim_time").as_bool(), std::forward<decltype(xs)>(xs)...),
     zeromq_client_(
-      simulation_interface::protocol, configuration.simulator_host, getZMQSocketPort(*node))
+      getZMQTransportProtocol(*node), configuration.simulator_host, getZMQSocketPort(*node))
   {
     setVerbose(configuration.verbose);
 
+    entity_manager_ptr_->setFrameProfiler(frame_profiler_);
+
     if (not configuration.standalone_mode) {
       simulation_api_schema::InitializeRequest request;
       request.set_initialize_time(clock_.getCurrentSimulationTime());
@@ -118,6 +127,8 @@ public:
     }
   }
 
+  ~API();
+
   template <typename ParameterT, typename... Ts>
   auto getROS2Parameter(Ts &&... xs) const -> decltype(auto)
   {
@@ -131,6 +142,13 @@ public:
     return node.get_parameter("port").as_int();
   }
 
+  template <typename Node>
+  auto getZMQTransportProtocol(Node & node) -> simulation_interface::TransportProtocol
+  {
+    if (!node.has_parameter("transport")) node.declare_parameter("transport", "tcp");
+    return simulation_interface::toTransportProtocol(node.get_parameter("transport").as_string());
+  }
+
   void closeZMQConnection() { zeromq_client_.closeConnection(); }
 
   void setVerbose(const bool verbose);
@@ -360,6 +378,7 @@ public:
   FORWARD_TO_ENTITY_MANAGER(entityExists);
   FORWARD_TO_ENTITY_MANAGER(getBehaviorParameter);
   FORWARD_TO_ENTITY_MANAGER(getBoundingBox);
+  FORWARD_TO_ENTITY_MANAGER(getCollidingPairs);
   FORWARD_TO_ENTITY_MANAGER(getConventionalTrafficLight);
   FORWARD_TO_ENTITY_MANAGER(getConventionalTrafficLights);
   FORWARD_TO_ENTITY_MANAGER(getCurrentAccel);
@@ -415,10 +434,38 @@ private:
 
   bool updateTrafficLightsInSim();
 
+  auto publishDebugMarker() -> void;
+
+  auto publishFrameProfile() -> void;
+
   const Configuration configuration;
 
   const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr node_parameters_;
 
+  static constexpr std::size_t frame_trace_capacity = 1 << 16;  // events per thread
+
+  const std::shared_ptr<helper::FrameProfiler> frame_profiler_;
+
+  const struct FrameSections
+  {
+    explicit FrameSections(helper::FrameProfiler & profiler)
+    : frame(profiler.section("frame")),
+      update_entities_status_in_sim(profiler.section("zmq/update_entities_status")),
+      update_entities(profiler.section("entity_manager/update")),
+      execute_traffic_controller(profiler.section("traffic_controller/execute")),
+      update_colliding_pairs(profiler.section("entity_manager/update_colliding_pairs")),
+      update_traffic_lights_in_sim(profiler.section("zmq/update_traffic_lights")),
+      update_time_in_sim(profiler.section("zmq/update_frame")),
+      broadcast_entity_transform(profiler.section("entity_manager/broadcast_transform")),
+      make_debug_marker(profiler.section("debug_marker"))
+    {
+    }
+
+    const helper::FrameProfiler::Section frame, update_entities_status_in_sim, update_entities,
+      execute_traffic_controller, update_colliding_pairs, update_traffic_lights_in_sim,
+      update_time_in_sim, broadcast_entity_transform, make_debug_marker;
+  } frame_sections_;
+
   const std::shared_ptr<entity::EntityManager> entity_manager_ptr_;
 
   const std::shared_ptr<traffic::TrafficController> traffic_controller_ptr_;
@@ -427,6 +474,12 @@ private:
 
   const rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr debug_marker_pub_;
 
+  helper::FrameProfiler::Clock::time_point debug_marker_published_time_;
+
+  const rclcpp::Publisher<traffic_simulator_msgs::msg::FrameProfile>::SharedPtr frame_profile_pub_;
+
+  helper::FrameProfiler::Clock::time_point frame_profile_published_time_;
+
   const rclcpp::Subscription<std_msgs::msg::Float64>::SharedPtr real_time_factor_subscriber;
 
   SimulationClock clock_;
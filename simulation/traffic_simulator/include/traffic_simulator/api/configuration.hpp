@@ -43,6 +43,12 @@ struct Configuration
 
   double v2i_traffic_light_publish_rate = 10.0;
 
+  double debug_marker_publish_rate = 10.0;  // [Hz] in wall clock time, 0 disables the publication
+
+  double frame_profile_publish_rate = 1.0;  // [Hz] in wall clock time, 0 disables the publication
+
+  Pathname frame_trace_path = "";  // Chrome trace of the frames written on exit if not empty
+
   /* ---- NOTE -----------------------------------------------------------------
    *
    *  This setting comes from the argument of the same name (= `map_path`) in
@@ -19,7 +19,7 @@
 #include <string>
 #include <traffic_simulator/behavior/follow_trajectory.hpp>
 #include <traffic_simulator/data_type/behavior.hpp>
-#include <traffic_simulator/data_type/entity_status.hpp>
+#include <traffic_simulator/data_type/entity_status_dict.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/traffic_lights/traffic_light_manager.hpp>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
@@ -33,8 +33,7 @@
 
 namespace entity_behavior
 {
-using EntityStatusDict =
-  std::unordered_map<std::string, traffic_simulator::CanonicalizedEntityStatus>;
+using EntityStatusDict = traffic_simulator::EntityStatusDict;
 
 class BehaviorPluginBase
 {
@@ -15,10 +15,13 @@
 #ifndef TRAFFIC_SIMULATOR__BEHAVIOR__FOLLOW_TRAJECTORY_HPP_
 #define TRAFFIC_SIMULATOR__BEHAVIOR__FOLLOW_TRAJECTORY_HPP_
 
+#include <memory>
 #include <optional>
+#include <traffic_simulator/behavior/polyline_trajectory_cursor.hpp>
 #include <traffic_simulator/data_type/entity_status.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
+#include <traffic_simulator_msgs/msg/bounding_box.hpp>
 #include <traffic_simulator_msgs/msg/entity_status.hpp>
 #include <traffic_simulator_msgs/msg/polyline_trajectory.hpp>
 
@@ -26,9 +29,17 @@ namespace traffic_simulator
 {
 namespace follow_trajectory
 {
+/*
+   The trajectory is preprocessed here once per assignment of
+   FollowTrajectoryAction, the cursor is then advanced by makeUpdatedStatus.
+*/
+auto makePolylineTrajectoryCursor(
+  const std::shared_ptr<const traffic_simulator_msgs::msg::PolylineTrajectory> &,
+  const traffic_simulator_msgs::msg::BoundingBox &,
+  const std::shared_ptr<hdmap_utils::HdMapUtils> &, double) -> PolylineTrajectoryCursor;
+
 auto makeUpdatedStatus(
-  const traffic_simulator_msgs::msg::EntityStatus &,
-  traffic_simulator_msgs::msg::PolylineTrajectory &,
+  const traffic_simulator_msgs::msg::EntityStatus &, PolylineTrajectoryCursor &,
   const traffic_simulator_msgs::msg::BehaviorParameter &,
   const std::shared_ptr<hdmap_utils::HdMapUtils> &, double, double,
   std::optional<double> target_speed = std::nullopt) -> std::optional<EntityStatus>;
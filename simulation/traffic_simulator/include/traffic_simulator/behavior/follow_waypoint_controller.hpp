@@ -24,7 +24,8 @@
 #include <scenario_simulator_exception/exception.hpp>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
 #include <traffic_simulator_msgs/msg/entity_status.hpp>
-#include <traffic_simulator_msgs/msg/polyline_trajectory.hpp>
+#include <traffic_simulator_msgs/msg/vertex.hpp>
+#include <vector>
 
 namespace traffic_simulator
 {
@@ -74,6 +75,8 @@ struct PredictedState
 
 class FollowWaypointController
 {
+  friend class FollowWaypointControllerTest;
+
   const double step_time;
   const bool with_breaking;
 
@@ -215,6 +218,49 @@ class FollowWaypointController
 
   auto moveStraight(PredictedState & state, const double candidate_acceleration) const -> void;
 
+  /*
+     This advances the state by the braking steps (steps with the candidate
+     acceleration equal to acceleration - max_deceleration_rate * step_time)
+     in closed form, as many as follow one of two regimes:
+
+     - The acceleration decreases by max_deceleration_rate * step_time in each
+       step, so the speed and the distance are sums of arithmetic sequences.
+
+     - The acceleration is limited by -speed / time_for_non_acceleration,
+       which gives a(k+1) * a(k) = speed(k) * max_acceleration_rate. Then
+       a(k+2) = a(k) + max_acceleration_rate * step_time, so the even and the
+       odd steps are arithmetic sequences again and the speed is a product of
+       two of them.
+
+     The steps leading to immobility and all the other cases (positive or zero
+     acceleration, speed close to target_speed) are not covered, this returns
+     false for them and they have to be simulated with moveStraight.
+
+     The result is the same as repeating moveStraight, except for rounding
+     errors, so the prediction of braking takes a few evaluations of these
+     formulas instead of one call of getAccelerationLimits per step.
+  */
+  auto brakeAnalytically(PredictedState & state) const -> bool;
+
+  /*
+     This predicts braking until immobility, or until a condition of giving up
+     is met. The condition is checked between the steps, or the runs of steps
+     skipped by brakeAnalytically - this is enough, as the traveled distance
+     and the travel time only increase during braking.
+  */
+  template <typename Predicate>
+  auto brakeUntilImmobility(PredictedState & state, Predicate && give_up) const -> bool
+  {
+    while (!state.isImmobile(local_epsilon)) {
+      if (give_up(state)) {
+        return false;
+      } else if (!brakeAnalytically(state)) {
+        moveStraight(state, state.acceleration - max_deceleration_rate * step_time);
+      }
+    }
+    return true;
+  }
+
   auto getPredictedStopStateWithoutConsideringTime(
     const double step_acceleration, const double remaining_distance, const double acceleration,
     const double speed) const -> std::optional<PredictedState>;
@@ -238,18 +284,16 @@ public:
   /*
      This is a debugging method, it is not worth giving it much attention.
   */
-  auto getFollowedWaypointDetails(
-    const traffic_simulator_msgs::msg::PolylineTrajectory & polyline_trajectory) const
-    -> std::string
+  template <typename Vertices>
+  auto getFollowedWaypointDetails(const Vertices & vertices) const -> std::string
   {
-    if (const auto & vertices = polyline_trajectory.shape.vertices; !vertices.empty()) {
+    if (!vertices.empty()) {
       std::stringstream waypoint_details;
       waypoint_details << "Currently followed waypoint: ";
       if (const auto first_waypoint_with_arrival_time_specified = std::find_if(
             vertices.begin(), vertices.end(),
             [](auto && vertex) { return not std::isnan(vertex.time); });
-          first_waypoint_with_arrival_time_specified !=
-          std::end(polyline_trajectory.shape.vertices)) {
+          first_waypoint_with_arrival_time_specified != std::end(vertices)) {
         waypoint_details << "[" << first_waypoint_with_arrival_time_specified->position.position.x
                          << ", " << first_waypoint_with_arrival_time_specified->position.position.y
                          << "] with specified time equal to "
@@ -23,6 +23,17 @@ namespace traffic_simulator
 {
 namespace longitudinal_speed_planning
 {
+/**
+ * @brief Longitudinal part of the dynamic states, free of ROS message types so that it can be
+ * integrated repeatedly without building geometry_msgs.
+ */
+struct LongitudinalState
+{
+  double speed;
+  double acceleration;
+  double linear_jerk;
+};
+
 class LongitudinalSpeedPlanner
 {
 public:
@@ -32,6 +43,12 @@ public:
     const geometry_msgs::msg::Twist & current_twist,
     const geometry_msgs::msg::Accel & current_accel) const
     -> std::tuple<geometry_msgs::msg::Twist, geometry_msgs::msg::Accel, double>;
+  /**
+   * @note Same as the linear x of the overload above.
+   */
+  auto getDynamicStates(
+    double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints &,
+    double current_speed, double current_acceleration) const -> LongitudinalState;
   auto getAccelerationDuration(
     double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints &,
     const geometry_msgs::msg::Twist & current_twist,
@@ -85,6 +102,9 @@ private:
     double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints &,
     const geometry_msgs::msg::Twist & current_twist,
     const geometry_msgs::msg::Accel & current_accel) const -> double;
+  auto planLinearJerk(
+    double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints &,
+    double current_speed, double current_acceleration) const -> double;
   auto forward(
     double linear_jerk, const geometry_msgs::msg::Accel &,
     const traffic_simulator_msgs::msg::DynamicConstraints &) const -> geometry_msgs::msg::Accel;
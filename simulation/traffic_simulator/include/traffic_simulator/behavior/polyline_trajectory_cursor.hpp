@@ -0,0 +1,141 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__BEHAVIOR__POLYLINE_TRAJECTORY_CURSOR_HPP_
+#define TRAFFIC_SIMULATOR__BEHAVIOR__POLYLINE_TRAJECTORY_CURSOR_HPP_
+
+#include <boost/range/adaptor/transformed.hpp>
+#include <boost/range/irange.hpp>
+#include <cstddef>
+#include <functional>
+#include <geometry_msgs/msg/point.hpp>
+#include <memory>
+#include <traffic_simulator_msgs/msg/polyline_trajectory.hpp>
+#include <traffic_simulator_msgs/msg/vertex.hpp>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace follow_trajectory
+{
+/*
+   PolylineTrajectory of FollowTrajectoryAction preprocessed once per
+   assignment. The distances between consecutive vertices and the index of the
+   nearest vertex with a specified arrival time are computed in the
+   constructor, so following the trajectory does not need to walk the vertices
+   on every step. Vertices that have been reached are discarded by advancing
+   the cursor - the trajectory itself is never modified.
+
+   Vertices are addressed by an "unwrapped" index. For an open trajectory it
+   is the index of the vertex. For a closed trajectory the vertices are laid
+   out twice, so that the remaining vertices (from the front vertex around to
+   the vertex just before it) are always a contiguous range.
+*/
+class PolylineTrajectoryCursor
+{
+public:
+  using Distance =
+    std::function<double(const geometry_msgs::msg::Point &, const geometry_msgs::msg::Point &)>;
+
+  using Vertex = traffic_simulator_msgs::msg::Vertex;
+
+  explicit PolylineTrajectoryCursor(
+    const std::shared_ptr<const traffic_simulator_msgs::msg::PolylineTrajectory> &,
+    const Distance &);
+
+  auto getTrajectory() const noexcept
+    -> const std::shared_ptr<const traffic_simulator_msgs::msg::PolylineTrajectory> &;
+
+  auto isClosed() const noexcept -> bool;
+
+  auto isDynamicConstraintsIgnorable() const noexcept -> bool;
+
+  /*
+     Note: base_time is NaN if Timing.domainAbsoluteRelative is "absolute".
+  */
+  auto getBaseTime() const noexcept -> double;
+
+  auto empty() const noexcept -> bool;
+
+  /*
+     Number of remaining vertices, including the front vertex.
+  */
+  auto size() const noexcept -> std::size_t;
+
+  auto front() const -> const Vertex &;
+
+  /*
+     Random access range of the remaining vertices, from the front vertex to
+     the last one. It refers to the vertices of the trajectory without copying
+     them, and is invalidated by pop.
+  */
+  auto getRemainingVertices() const
+  {
+    return boost::adaptors::transform(
+      boost::irange(front_index_, getEndIndex()),
+      [this](const std::size_t index) -> const Vertex & { return getVertex(index); });
+  }
+
+  /*
+     The target vertex is the nearest remaining vertex with a specified arrival
+     time, or the last remaining vertex if there is no such vertex.
+  */
+  auto hasTargetArrivalTime() const -> bool;
+
+  auto getTargetVertex() const -> const Vertex &;
+
+  auto isTargetTheLastVertex() const -> bool;
+
+  /*
+     Distance along the trajectory from the front vertex to the target vertex.
+  */
+  auto getDistanceToTargetVertex() const -> double;
+
+  /*
+     Discard the front vertex. If the vertex discarded has a specified arrival
+     time and the timing is relative, the relative time restarts at the
+     current_time.
+  */
+  auto pop(double current_time) -> void;
+
+private:
+  auto getEndIndex() const noexcept -> std::size_t;
+
+  auto getTargetIndex() const -> std::size_t;
+
+  auto getVertex(std::size_t index) const -> const Vertex &;
+
+  const std::shared_ptr<const traffic_simulator_msgs::msg::PolylineTrajectory> trajectory_;
+
+  /*
+     cumulative_lengths_[i] is the length along the trajectory from the vertex
+     of unwrapped index 0 to the vertex of unwrapped index i.
+  */
+  std::vector<double> cumulative_lengths_;
+
+  /*
+     timed_vertex_indices_[i] is the smallest unwrapped index not less than i
+     of a vertex with a specified arrival time, or the number of unwrapped
+     indices if there is no such vertex.
+  */
+  std::vector<std::size_t> timed_vertex_indices_;
+
+  std::size_t front_index_ = 0;
+
+  double base_time_;
+};
+}  // namespace follow_trajectory
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__BEHAVIOR__POLYLINE_TRAJECTORY_CURSOR_HPP_
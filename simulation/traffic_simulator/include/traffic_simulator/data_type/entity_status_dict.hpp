@@ -0,0 +1,138 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__DATA_TYPE__ENTITY_STATUS_DICT_HPP_
+#define TRAFFIC_SIMULATOR__DATA_TYPE__ENTITY_STATUS_DICT_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <traffic_simulator/data_type/entity_status.hpp>
+#include <unordered_map>
+
+namespace traffic_simulator
+{
+/*
+   Statuses of the other entities, as seen by one entity.
+
+   EntityManager takes one immutable snapshot of all the entity statuses per
+   update, and every entity, behavior plugin and action node refers to it
+   through this view, which only hides the entity itself. Copying the view
+   copies a shared pointer instead of the statuses, so handing the statuses
+   around does not allocate.
+
+   The interface is the read-only subset of std::unordered_map used by the
+   callers.
+*/
+class EntityStatusDict
+{
+public:
+  using Statuses = std::unordered_map<std::string, CanonicalizedEntityStatus>;
+
+  using key_type = Statuses::key_type;
+
+  using mapped_type = Statuses::mapped_type;
+
+  using value_type = Statuses::value_type;
+
+  using size_type = Statuses::size_type;
+
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+
+    using value_type = Statuses::value_type;
+
+    using difference_type = std::ptrdiff_t;
+
+    using pointer = const value_type *;
+
+    using reference = const value_type &;
+
+    explicit const_iterator(
+      const Statuses::const_iterator & iter, const Statuses::const_iterator & end,
+      const Statuses::const_iterator & excluded)
+    : iter_(iter), end_(end), excluded_(excluded)
+    {
+      skipExcluded();
+    }
+
+    auto operator*() const -> reference { return *iter_; }
+
+    auto operator->() const -> pointer { return &*iter_; }
+
+    auto operator++() -> const_iterator &
+    {
+      ++iter_;
+      skipExcluded();
+      return *this;
+    }
+
+    auto operator++(int) -> const_iterator
+    {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    auto operator==(const const_iterator & other) const -> bool { return iter_ == other.iter_; }
+
+    auto operator!=(const const_iterator & other) const -> bool { return iter_ != other.iter_; }
+
+  private:
+    auto skipExcluded() -> void
+    {
+      if (iter_ != end_ and iter_ == excluded_) {
+        ++iter_;
+      }
+    }
+
+    Statuses::const_iterator iter_;
+
+    Statuses::const_iterator end_;
+
+    Statuses::const_iterator excluded_;
+  };
+
+  using iterator = const_iterator;
+
+  EntityStatusDict();
+
+  explicit EntityStatusDict(
+    const std::shared_ptr<const Statuses> & statuses, const std::string & excluded_name = "");
+
+  auto begin() const -> const_iterator;
+
+  auto end() const -> const_iterator;
+
+  auto find(const std::string & name) const -> const_iterator;
+
+  auto at(const std::string & name) const -> const CanonicalizedEntityStatus &;
+
+  auto count(const std::string & name) const -> size_type;
+
+  auto size() const -> size_type;
+
+  auto empty() const -> bool;
+
+private:
+  std::shared_ptr<const Statuses> statuses_;
+
+  Statuses::const_iterator excluded_;
+};
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__DATA_TYPE__ENTITY_STATUS_DICT_HPP_
@@ -0,0 +1,83 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__ENTITY__COLLISION_DETECTOR_HPP_
+#define TRAFFIC_SIMULATOR__ENTITY__COLLISION_DETECTOR_HPP_
+
+#include <cstddef>
+#include <geometry/intersection/collision.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <string>
+#include <traffic_simulator_msgs/msg/bounding_box.hpp>
+#include <utility>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace entity
+{
+/**
+ * @brief finds all colliding pairs of entities in one pass
+ * @note The broad phase sorts the axis aligned bounding boxes of the footprints along the x axis
+ *       (sweep and prune), and only the pairs overlapping on both axes are checked by the separating
+ *       axis test. The buffers, including those of the names, are reused between frames, so memory
+ *       is only allocated when there are more entities or longer names than before, or when
+ *       colliding pairs are found.
+ */
+class CollisionDetector
+{
+public:
+  using Pair = std::pair<std::string, std::string>;
+
+  auto clear() -> void;
+
+  auto add(
+    const std::string & name, const geometry_msgs::msg::Pose & pose,
+    const traffic_simulator_msgs::msg::BoundingBox & bounding_box) -> void;
+
+  /**
+   * @brief find the colliding pairs of the entities added since the last call of clear
+   */
+  auto update() -> void;
+
+  /**
+   * @return colliding pairs, each pair ordered by name and the list sorted
+   */
+  auto getCollidingPairs() const noexcept -> const std::vector<Pair> & { return colliding_pairs_; }
+
+  auto isColliding(const std::string & first_entity_name, const std::string & second_entity_name)
+    const -> bool;
+
+private:
+  struct Proxy
+  {
+    double min_x, max_x;
+
+    std::size_t index;
+  };
+
+  std::vector<std::string> names_;  //!< only the first size_ names are the current entities
+
+  std::size_t size_ = 0;
+
+  std::vector<math::geometry::OrientedBoundingBox> boxes_;
+
+  std::vector<Proxy> proxies_;  //!< sorted by min_x after update
+
+  std::vector<Pair> colliding_pairs_;
+};
+}  // namespace entity
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__ENTITY__COLLISION_DETECTOR_HPP_
@@ -24,6 +24,7 @@
 #include <optional>
 #include <string>
 #include <traffic_simulator/api/configuration.hpp>
+#include <traffic_simulator/behavior/polyline_trajectory_cursor.hpp>
 #include <traffic_simulator/entity/vehicle_entity.hpp>
 #include <traffic_simulator/utils/node_parameters.hpp>
 #include <traffic_simulator_msgs/msg/entity_type.hpp>
@@ -44,7 +45,7 @@ class EgoEntity : public VehicleEntity
   bool is_controlled_by_simulator_{false};
   std::optional<double> target_speed_;
   traffic_simulator_msgs::msg::BehaviorParameter behavior_parameter_;
-  std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> polyline_trajectory_;
+  std::optional<follow_trajectory::PolylineTrajectoryCursor> polyline_trajectory_cursor_;
 
 public:
   explicit EgoEntity() = delete;
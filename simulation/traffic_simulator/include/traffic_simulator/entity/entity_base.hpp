@@ -25,6 +25,7 @@
 #include <traffic_simulator/behavior/follow_trajectory.hpp>
 #include <traffic_simulator/behavior/longitudinal_speed_planning.hpp>
 #include <traffic_simulator/data_type/entity_status.hpp>
+#include <traffic_simulator/data_type/entity_status_dict.hpp>
 #include <traffic_simulator/data_type/lane_change.hpp>
 #include <traffic_simulator/data_type/speed_change.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
@@ -189,6 +190,8 @@ public:
 
   /*   */ void setOtherStatus(const std::unordered_map<std::string, CanonicalizedEntityStatus> &);
 
+  /*   */ void setOtherStatus(const std::shared_ptr<const EntityStatusDict::Statuses> &);
+
   virtual auto setStatus(const EntityStatus & status, const lanelet::Ids & lanelet_ids) -> void;
 
   virtual auto setStatus(const EntityStatus & status) -> void;
@@ -256,7 +259,7 @@ protected:
   double prev_job_duration_ = 0.0;
   double step_time_ = 0.0;
 
-  std::unordered_map<std::string, CanonicalizedEntityStatus> other_status_;
+  EntityStatusDict other_status_;
 
   std::optional<double> target_speed_;
   traffic_simulator::job::JobList job_list_;
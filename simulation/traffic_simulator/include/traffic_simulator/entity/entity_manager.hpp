@@ -32,12 +32,14 @@
 #include <traffic_simulator/api/configuration.hpp>
 #include <traffic_simulator/data_type/lane_change.hpp>
 #include <traffic_simulator/data_type/speed_change.hpp>
+#include <traffic_simulator/entity/collision_detector.hpp>
 #include <traffic_simulator/entity/ego_entity.hpp>
 #include <traffic_simulator/entity/entity_base.hpp>
 #include <traffic_simulator/entity/misc_object_entity.hpp>
 #include <traffic_simulator/entity/pedestrian_entity.hpp>
 #include <traffic_simulator/entity/vehicle_entity.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <traffic_simulator/helper/frame_profiler.hpp>
 #include <traffic_simulator/traffic/traffic_sink.hpp>
 #include <traffic_simulator/traffic_lights/configurable_rate_updater.hpp>
 #include <traffic_simulator/traffic_lights/traffic_light_marker_publisher.hpp>
@@ -87,6 +89,12 @@ class EntityManager
 
   bool npc_logic_started_;
 
+  CollisionDetector collision_detector_;
+
+  std::shared_ptr<helper::FrameProfiler> frame_profiler_;
+
+  std::unordered_map<std::string, helper::FrameProfiler::Section> npc_logic_sections_;
+
   using EntityStatusWithTrajectoryArray =
     traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray;
   const rclcpp::Publisher<EntityStatusWithTrajectoryArray>::SharedPtr entity_status_array_pub_ptr_;
@@ -96,8 +104,6 @@ class EntityManager
 
   const std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils_ptr_;
 
-  MarkerArray markers_raw_;
-
   const std::shared_ptr<TrafficLightManager> conventional_traffic_light_manager_ptr_;
   const std::shared_ptr<TrafficLightMarkerPublisher>
     conventional_traffic_light_marker_publisher_ptr_;
@@ -161,9 +167,8 @@ public:
     lanelet_marker_pub_ptr_(rclcpp::create_publisher<MarkerArray>(
       node, "lanelet/marker", LaneletMarkerQoS(),
       rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
-    hdmap_utils_ptr_(std::make_shared<hdmap_utils::HdMapUtils>(
-      configuration.lanelet2_map_path(), getOrigin(*node))),
-    markers_raw_(hdmap_utils_ptr_->generateMarker()),
+    hdmap_utils_ptr_(
+      hdmap_utils::HdMapUtils::shared(configuration.lanelet2_map_path(), getOrigin(*node))),
     conventional_traffic_light_manager_ptr_(
       std::make_shared<TrafficLightManager>(hdmap_utils_ptr_)),
     conventional_traffic_light_marker_publisher_ptr_(
@@ -224,6 +229,11 @@ public:
     return conventional_traffic_light_manager_ptr_->generateUpdateTrafficLightsRequest();
   }
 
+  auto generateDeltaUpdateRequestForConventionalTrafficLights()
+  {
+    return conventional_traffic_light_manager_ptr_->generateDeltaUpdateTrafficLightsRequest();
+  }
+
   auto resetConventionalTrafficLightPublishRate(double rate) -> void
   {
     conventional_traffic_light_updater_.resetUpdateRate(rate);
@@ -237,7 +247,7 @@ public:
   auto setConventionalTrafficLightConfidence(lanelet::Id id, double confidence) -> void
   {
     for (auto & traffic_light : conventional_traffic_light_manager_ptr_->getTrafficLights(id)) {
-      traffic_light.get().confidence = confidence;
+      traffic_light.get().setConfidence(confidence);
     }
   }
 
@@ -304,7 +314,10 @@ public:
 
   visualization_msgs::msg::MarkerArray makeDebugMarker() const;
 
-  bool trafficLightsChanged();
+  /**
+   * @brief measure the behavior of each entity type, e.g. "npc_logic/VehicleEntity", by the profiler
+   */
+  auto setFrameProfiler(const std::shared_ptr<helper::FrameProfiler> &) -> void;
 
   auto updateNpcLogic(const std::string & name, const double current_time, const double step_time)
     -> const CanonicalizedEntityStatus &;
@@ -317,6 +330,22 @@ public:
   bool checkCollision(
     const std::string & first_entity_name, const std::string & second_entity_name);
 
+  /**
+   * @brief find all colliding pairs of entities at once, called once per frame after all entities
+   *        and the traffic are updated
+   */
+  auto updateCollidingPairs() -> void;
+
+  /**
+   * @return pairs of colliding entities found by the last call of updateCollidingPairs, each pair
+   *         ordered by name
+   */
+  auto getCollidingPairs() const noexcept
+    -> const std::vector<std::pair<std::string, std::string>> &
+  {
+    return collision_detector_.getCollidingPairs();
+  }
+
   bool despawnEntity(const std::string & name);
 
   bool entityExists(const std::string & name);
@@ -493,6 +522,13 @@ public:
 
   void update(const double current_time, const double step_time);
 
+  /**
+   * @brief publish the status, waypoints, goals and obstacle of each entity for visualization
+   */
+  auto publishEntityStatusArray(
+    const std::unordered_map<std::string, CanonicalizedEntityStatus> &, const double current_time,
+    const double step_time) -> void;
+
   void updateHdmapMarker();
 
   auto startNpcLogic(const double current_time) -> void;
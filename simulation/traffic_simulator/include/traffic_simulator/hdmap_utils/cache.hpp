@@ -17,10 +17,14 @@
 
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/vector3.hpp>
 #include <mutex>
 #include <optional>
 #include <scenario_simulator_exception/exception.hpp>
+#include <traffic_simulator_msgs/msg/lanelet_pose.hpp>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace std
@@ -81,6 +85,48 @@ private:
   std::mutex mutex_;
 };
 
+/**
+ * @brief longitudinal distance from the origin (s = 0) of a lanelet to the origin of another lanelet
+ * along the route, or std::nullopt if no route exists. The distance between two lanelet poses is
+ * this distance minus the s value of the start plus the s value of the goal.
+ */
+class RouteDistanceCache
+{
+public:
+  auto exists(lanelet::Id from, lanelet::Id to, bool allow_lane_change)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::tuple<lanelet::Id, lanelet::Id, bool> key = {from, to, allow_lane_change};
+    return data_.find(key) != data_.end();
+  }
+
+  auto getDistance(const lanelet::Id from, const lanelet::Id to, const bool allow_lane_change)
+    -> std::optional<double>
+  {
+    if (!exists(from, to, allow_lane_change)) {
+      THROW_SIMULATION_ERROR(
+        "distance from : ", from, " to : ", to, (allow_lane_change ? " with" : " without"),
+        " lane change does not exists on route distance cache.");
+    } else {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return data_.at({from, to, allow_lane_change});
+    }
+  }
+
+  auto appendData(
+    lanelet::Id from, lanelet::Id to, const bool allow_lane_change,
+    const std::optional<double> & distance) -> void
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    data_[{from, to, allow_lane_change}] = distance;
+  }
+
+private:
+  std::unordered_map<std::tuple<lanelet::Id, lanelet::Id, bool>, std::optional<double>> data_;
+
+  std::mutex mutex_;
+};
+
 class CenterPointsCache
 {
 public:
@@ -123,7 +169,19 @@ private:
   std::mutex mutex_;
 };
 
-class LaneletLengthCache
+/**
+ * @brief goal candidate of the lane change trajectory, which depends on the target lanelet only
+ */
+struct LaneChangeGoal
+{
+  traffic_simulator_msgs::msg::LaneletPose lanelet_pose;
+
+  geometry_msgs::msg::Pose pose;
+
+  std::optional<geometry_msgs::msg::Vector3> tangent_vector;
+};
+
+class LaneChangeGoalCache
 {
 public:
   auto exists(lanelet::Id lanelet_id)
@@ -132,23 +190,24 @@ public:
     return data_.find(lanelet_id) != data_.end();
   }
 
-  auto getLength(lanelet::Id lanelet_id)
+  auto getGoals(lanelet::Id lanelet_id) -> decltype(auto)
   {
     if (!exists(lanelet_id)) {
-      THROW_SIMULATION_ERROR("length of : ", lanelet_id, " does not exists on route cache.");
+      THROW_SIMULATION_ERROR(
+        "lane change goals of : ", lanelet_id, " does not exists on lane change goal cache.");
     }
     std::lock_guard<std::mutex> lock(mutex_);
-    return data_[lanelet_id];
+    return std::as_const(data_.at(lanelet_id));
   }
 
-  auto appendData(lanelet::Id lanelet_id, double length)
+  auto appendData(lanelet::Id lanelet_id, const std::vector<LaneChangeGoal> & goals)
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    data_[lanelet_id] = length;
+    data_.emplace(lanelet_id, goals);
   }
 
 private:
-  std::unordered_map<lanelet::Id, double> data_;
+  std::unordered_map<lanelet::Id, std::vector<LaneChangeGoal>> data_;
 
   std::mutex mutex_;
 };
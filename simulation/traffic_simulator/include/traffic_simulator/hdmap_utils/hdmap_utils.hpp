@@ -33,11 +33,13 @@
 #include <autoware_lanelet2_extension/utility/query.hpp>
 #include <autoware_lanelet2_extension/utility/utilities.hpp>
 #include <boost/filesystem.hpp>
+#include <functional>
 #include <geographic_msgs/msg/geo_point.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <geometry/spline/catmull_rom_spline_interface.hpp>
 #include <geometry/spline/hermite_curve.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -58,11 +60,40 @@ namespace hdmap_utils
 {
 enum class LaneletType { LANE, CROSSWALK };
 
+/**
+ * @brief stop line, traffic light stop line, crosswalk or conflicting lane crossed by the
+ *        centerline of a lanelet
+ */
+struct RegulatoryFeature
+{
+  enum class Type { STOP_LINE, TRAFFIC_LIGHT_STOP_LINE, CROSSWALK, CONFLICTING_LANE };
+
+  Type type;
+
+  /// id of the stop line, the traffic light, the crosswalk or the conflicting lanelet
+  lanelet::Id id;
+
+  /// position along the lanelet where its centerline enters the feature
+  double s;
+
+  /// position along the lanelet where its centerline leaves the feature (s for a stop line)
+  double end_s;
+};
+
 class HdMapUtils
 {
 public:
   explicit HdMapUtils(const boost::filesystem::path &, const geographic_msgs::msg::GeoPoint &);
 
+  /**
+   * @brief get the HdMapUtils of the map, shared with all other callers in this process
+   * @note HdMapUtils is not modified after construction (its caches are synchronized), so any
+   *       number of API instances can use the same one. The map is loaded again only after all
+   *       holders of the previous instance have released it.
+   */
+  static auto shared(const boost::filesystem::path &, const geographic_msgs::msg::GeoPoint &)
+    -> std::shared_ptr<HdMapUtils>;
+
   auto canChangeLane(const lanelet::Id from, const lanelet::Id to) const -> bool;
 
   auto canonicalizeLaneletPose(const traffic_simulator_msgs::msg::LaneletPose &) const
@@ -113,6 +144,20 @@ public:
 
   auto getConflictingLaneIds(const lanelet::Ids &) const -> lanelet::Ids;
 
+  /**
+   * @brief get the distance along the route to the nearest regulatory feature ahead
+   * @note The features are looked up in the index built when the map is loaded, so no geometry is
+   *       computed here. The distance is measured along the centerlines of the route lanelets,
+   *       like the reference trajectory of the behavior, and the search stops at max_distance.
+   *       If `from` is already inside a feature, the distance to the edge where the centerline
+   *       leaves it is returned, like the first intersection of a trajectory starting there.
+   */
+  auto getDistanceToRegulatoryFeature(
+    const lanelet::Ids & route_lanelets, const traffic_simulator_msgs::msg::LaneletPose & from,
+    const std::function<bool(const RegulatoryFeature &)> & predicate,
+    const double max_distance = std::numeric_limits<double>::infinity()) const
+    -> std::optional<double>;
+
   auto getDistanceToStopLine(
     const lanelet::Ids & route_lanelets,
     const math::geometry::CatmullRomSplineInterface & spline) const -> std::optional<double>;
@@ -147,11 +192,18 @@ public:
 
   auto getHeight(const traffic_simulator_msgs::msg::LaneletPose &) const -> double;
 
+  /**
+   * @brief find the lane change trajectory with the length closest to target_trajectory_length
+   * @param maximum_number_of_candidates number of goals ahead of `from` to evaluate, nearest
+   *        first. The search does not depend on the speed of the host, so it is reproducible.
+   * @return trajectory and the s value of its goal on the target lanelet
+   */
   auto getLaneChangeTrajectory(
     const geometry_msgs::msg::Pose & from,
     const traffic_simulator::lane_change::Parameter & lane_change_parameter,
     const double maximum_curvature_threshold, const double target_trajectory_length,
-    const double forward_distance_threshold) const
+    const double forward_distance_threshold,
+    const std::size_t maximum_number_of_candidates = std::numeric_limits<std::size_t>::max()) const
     -> std::optional<std::pair<math::geometry::HermiteCurve, double>>;
 
   auto getLaneChangeTrajectory(
@@ -221,6 +273,11 @@ public:
 
   auto getPreviousLanelets(const lanelet::Id, const double distance = 100) const -> lanelet::Ids;
 
+  /**
+   * @return regulatory features crossed by the centerline of the lanelet, sorted by s
+   */
+  auto getRegulatoryFeatures(const lanelet::Id) const -> const std::vector<RegulatoryFeature> &;
+
   auto getRightBound(const lanelet::Id) const -> std::vector<geometry_msgs::msg::Point>;
 
   auto getRightLaneletIds(
@@ -317,13 +374,18 @@ public:
     const -> geometry_msgs::msg::PoseStamped;
 
 private:
+  auto getLongitudinalDistanceBetweenLaneletOrigins(
+    const lanelet::Id from, const lanelet::Id to, const bool allow_lane_change) const
+    -> std::optional<double>;
+
   /** @defgroup cache
    *  Declared mutable for caching
    */
   // @{
   mutable RouteCache route_cache_;
+  mutable RouteDistanceCache route_distance_cache_;
   mutable CenterPointsCache center_points_cache_;
-  mutable LaneletLengthCache lanelet_length_cache_;
+  mutable LaneChangeGoalCache lane_change_goal_cache_;
   // @}
 
   lanelet::LaneletMapPtr lanelet_map_ptr_;
@@ -333,6 +395,38 @@ private:
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_pedestrian_ptr_;
   lanelet::ConstLanelets shoulder_lanelets_;
 
+  struct RegulatoryElements
+  {
+    lanelet::ConstLineStrings3d stop_lines;
+
+    lanelet::Ids traffic_light_ids;
+
+    lanelet::Ids conflicting_crosswalk_ids;
+
+    lanelet::Ids conflicting_lane_ids;
+
+    std::vector<RegulatoryFeature> features;  //!< sorted by s
+  };
+
+  struct LaneletConnection
+  {
+    double length;
+
+    lanelet::Ids next_ids;  //!< including the road shoulders
+
+    lanelet::Ids previous_ids;  //!< including the road shoulders
+  };
+
+  /** @defgroup index
+   *  Built once when the map is loaded, read only afterwards
+   */
+  // @{
+  std::unordered_map<lanelet::Id, LaneletConnection> lanelet_connections_;
+  std::unordered_map<lanelet::Id, RegulatoryElements> regulatory_elements_;
+  std::unordered_map<lanelet::Id, std::vector<lanelet::AutowareTrafficLightConstPtr>>
+    traffic_lights_;
+  // @}
+
   template <typename Lanelet>
   auto getLaneletIds(const std::vector<Lanelet> & lanelets) const -> lanelet::Ids
   {
@@ -347,6 +441,10 @@ private:
     const lanelet::BasicPolygon2d & relative_hull, const lanelet::matching::Pose2d &) const
     -> lanelet::BasicPolygon2d;
 
+  auto buildLaneletConnections() -> void;
+
+  auto buildRegulatoryElementIndex() -> void;
+
   auto calcEuclidDist(
     const std::vector<double> & x, const std::vector<double> & y,
     const std::vector<double> & z) const -> std::vector<double>;
@@ -373,23 +471,31 @@ private:
     const traffic_simulator::lane_change::TrajectoryShape,
     const double tangent_vector_size = 100) const -> math::geometry::HermiteCurve;
 
+  auto getLaneChangeTrajectory(
+    const geometry_msgs::msg::Pose & from, const LaneChangeGoal & to,
+    const traffic_simulator::lane_change::TrajectoryShape,
+    const double tangent_vector_size = 100) const -> math::geometry::HermiteCurve;
+
+  /**
+   * @brief goal candidates sampled every 1 m along the lanelet, cached per lanelet
+   */
+  auto getLaneChangeGoals(const lanelet::Id) const -> const std::vector<LaneChangeGoal> &;
+
+  auto getLaneletConnection(const lanelet::Id) const -> const LaneletConnection &;
+
   auto getNextRoadShoulderLanelet(const lanelet::Id) const -> lanelet::Ids;
 
   auto getPreviousRoadShoulderLanelet(const lanelet::Id) const -> lanelet::Ids;
 
+  auto getRegulatoryElements(const lanelet::Id) const -> const RegulatoryElements &;
+
   auto getStopLines() const -> lanelet::ConstLineStrings3d;
 
   auto getStopLinesOnPath(const lanelet::Ids &) const -> lanelet::ConstLineStrings3d;
 
-  auto getTrafficLightRegulatoryElementsOnPath(const lanelet::Ids &) const
-    -> std::vector<std::shared_ptr<const lanelet::autoware::AutowareTrafficLight>>;
-
   auto getTrafficLights(const lanelet::Id traffic_light_id) const
     -> std::vector<lanelet::AutowareTrafficLightConstPtr>;
 
-  auto getTrafficSignRegulatoryElementsOnPath(const lanelet::Ids &) const
-    -> std::vector<std::shared_ptr<const lanelet::TrafficSign>>;
-
   auto getTrafficSignRegulatoryElements() const
     -> std::vector<std::shared_ptr<const lanelet::TrafficSign>>;
 
@@ -0,0 +1,172 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__HELPER__FRAME_PROFILER_HPP_
+#define TRAFFIC_SIMULATOR__HELPER__FRAME_PROFILER_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <traffic_simulator_msgs/msg/frame_profile.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace helper
+{
+/**
+ * @brief records the time spent in each section of the simulation frame
+ * @note Each thread records into its own histograms with relaxed atomic operations, so recording
+ *       takes no lock and a reader can take statistics at any time. A lock is taken only when a
+ *       section is registered and when a thread records for the first time.
+ */
+class FrameProfiler
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  using Section = std::size_t;
+
+  static constexpr std::size_t max_number_of_sections = 64;
+
+  struct Statistics
+  {
+    std::string name;
+
+    std::uint64_t count;
+
+    Clock::duration mean, p50, p99, max;  //!< p50 and p99 are the upper bounds of the buckets
+  };
+
+  /**
+   * @param trace_capacity the number of the latest events kept per thread for the Chrome trace,
+   *        0 disables the trace
+   */
+  explicit FrameProfiler(std::size_t trace_capacity = 0);
+
+  /**
+   * @brief register a section, or find the section already registered with the name
+   * @note Takes a lock, so call it once and keep the result rather than calling it every frame.
+   */
+  auto section(const std::string & name) -> Section;
+
+  auto record(Section, Clock::time_point begin, Clock::time_point end) noexcept -> void;
+
+  class Scope
+  {
+  public:
+    explicit Scope(FrameProfiler & profiler, Section section)
+    : profiler(profiler), section(section), begin(Clock::now())
+    {
+    }
+
+    Scope(const Scope &) = delete;
+
+    Scope & operator=(const Scope &) = delete;
+
+    ~Scope() { profiler.record(section, begin, Clock::now()); }
+
+  private:
+    FrameProfiler & profiler;
+
+    const Section section;
+
+    const Clock::time_point begin;
+  };
+
+  /**
+   * @brief measure the time until the end of the enclosing scope
+   */
+  auto measure(Section section) -> Scope { return Scope(*this, section); }
+
+  /**
+   * @brief measure the time spent in calling the given function
+   */
+  template <typename F>
+  auto measure(Section section, F && f) -> decltype(auto)
+  {
+    const auto scope = measure(section);
+    return f();
+  }
+
+  auto statistics() const -> std::vector<Statistics>;
+
+  auto toMsg() const -> traffic_simulator_msgs::msg::FrameProfile;
+
+  /**
+   * @brief write the kept events in the Chrome trace event format, readable by Perfetto
+   * @note Call it while no thread is recording, e.g. at the end of the simulation.
+   */
+  auto writeChromeTrace(std::ostream &) const -> void;
+
+private:
+  struct Histogram
+  {
+    static constexpr std::size_t number_of_buckets = 48;  //!< bucket i is [2^i, 2^(i+1)) ns
+
+    std::array<std::atomic<std::uint64_t>, number_of_buckets> buckets = {};
+
+    std::atomic<std::uint64_t> count = 0;
+
+    std::atomic<std::int64_t> total = 0;  // [ns]
+
+    std::atomic<std::int64_t> maximum = 0;  // [ns]
+  };
+
+  struct Event
+  {
+    Section section;
+
+    std::int64_t begin, duration;  // [ns] since the construction of the profiler
+  };
+
+  struct ThreadBuffer
+  {
+    const std::thread::id thread_id = std::this_thread::get_id();
+
+    std::array<Histogram, max_number_of_sections> histograms;
+
+    std::vector<Event> events;
+
+    std::atomic<std::size_t> number_of_events = 0;  //!< including the events overwritten
+  };
+
+  auto buffer() -> ThreadBuffer &;
+
+  const std::uint64_t id;
+
+  const std::size_t trace_capacity;
+
+  const Clock::time_point origin = Clock::now();
+
+  mutable std::mutex mutex;
+
+  std::vector<std::string> names;
+
+  std::unordered_map<std::string, Section> sections;
+
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+}  // namespace helper
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__HELPER__FRAME_PROFILER_HPP_
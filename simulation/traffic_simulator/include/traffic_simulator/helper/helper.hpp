@@ -142,6 +142,15 @@ std::vector<T> getUniqueValues(const std::vector<T> & input_vector)
   return output_vector;
 }
 
+/**
+ * @brief check if anyone subscribes the topic, to skip building messages that nobody receives
+ */
+template <typename Publisher>
+auto hasSubscribers(const Publisher & publisher) -> bool
+{
+  return 0 < publisher.get_subscription_count() + publisher.get_intra_process_subscription_count();
+}
+
 enum class LidarType { VLP16, VLP32 };
 
 const simulation_api_schema::LidarConfiguration constructLidarConfiguration(
@@ -16,6 +16,7 @@
 #define TRAFFIC_SIMULATOR__TRAFFIC_LIGHTS__TRAFFIC_LIGHT_HPP_
 
 #include <color_names/color_names.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <geometry_msgs/msg/point.hpp>
 #include <iostream>
@@ -330,7 +331,12 @@ struct TrafficLight
 
   explicit TrafficLight(const lanelet::Id, hdmap_utils::HdMapUtils &);
 
-  auto clear() { bulbs.clear(); }
+  auto clear()
+  {
+    bulbs.clear();
+    stop_signal_ = false;
+    ++version_;
+  }
 
   auto contains(const Bulb & bulb) const { return bulbs.find(bulb) != std::end(bulbs); }
 
@@ -377,12 +383,37 @@ struct TrafficLight
   auto emplace(Ts &&... xs)
   {
     bulbs.emplace(std::forward<decltype(xs)>(xs)...);
+    stop_signal_ = contains(Color::red, Status::solid_on, Shape::circle) or
+                   contains(Color::yellow, Status::solid_on, Shape::circle);
+    ++version_;
   }
 
   auto empty() const { return bulbs.empty(); }
 
+  /**
+   * @brief whether a vehicle must stop at the stop line of this traffic light
+   * @note Every behavior asks this for each traffic light on its route on every frame, while the
+   *       bulbs change a few times per cycle, so it is updated by clear, emplace and set instead of
+   *       being looked up in the bulbs.
+   */
+  auto isStopSignal() const noexcept { return stop_signal_; }
+
   auto set(const std::string & states) -> void;
 
+  auto setConfidence(const double given) -> void
+  {
+    if (confidence != given) {
+      confidence = given;
+      ++version_;
+    }
+  }
+
+  /**
+   * @brief count of the changes made to this traffic light
+   * @note Consumers remember the version they have seen to skip unchanged traffic lights.
+   */
+  auto version() const noexcept { return version_; }
+
   friend auto operator<<(std::ostream & os, const TrafficLight & traffic_light) -> std::ostream &;
 
   explicit operator simulation_api_schema::TrafficSignal() const
@@ -397,6 +428,11 @@ struct TrafficLight
     }
     return traffic_signal_proto;
   }
+
+private:
+  std::size_t version_ = 0;
+
+  bool stop_signal_ = false;
 };
 }  // namespace traffic_simulator
 
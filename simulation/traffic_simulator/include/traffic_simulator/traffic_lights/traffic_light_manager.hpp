@@ -15,6 +15,7 @@
 #ifndef TRAFFIC_SIMULATOR__TRAFFIC_LIGHTS__TRAFFIC_LIGHT_MANAGER_BASE_HPP_
 #define TRAFFIC_SIMULATOR__TRAFFIC_LIGHTS__TRAFFIC_LIGHT_MANAGER_BASE_HPP_
 
+#include <cstddef>
 #include <iomanip>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
@@ -39,6 +40,12 @@ protected:
 
   const std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_;
 
+  std::size_t update_traffic_lights_request_version_ = 0;
+
+  simulation_api_schema::UpdateTrafficLightsRequest update_traffic_lights_request_;
+
+  std::unordered_map<lanelet::Id, std::size_t> sent_traffic_light_versions_;
+
 public:
   explicit TrafficLightManager(const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap);
 
@@ -53,9 +60,24 @@ public:
   auto getTrafficLights(const lanelet::Id lanelet_id)
     -> std::vector<std::reference_wrapper<TrafficLight>>;
 
-  auto hasAnyLightChanged() -> bool;
+  /**
+   * @brief count of the changes made to the traffic lights of this manager
+   * @note Equal versions mean that no traffic light has been added or changed in between.
+   */
+  auto getVersion() const -> std::size_t;
 
+  /**
+   * @note The request is serialized again only if any traffic light has changed since.
+   */
   auto generateUpdateTrafficLightsRequest() -> simulation_api_schema::UpdateTrafficLightsRequest;
+
+  /**
+   * @brief generate a request containing only the traffic lights changed since the previous call
+   * @note This is for the consumer keeping the state of every traffic light, i.e. the sensor
+   *       simulator. The ROS topics must be published with the full request.
+   */
+  auto generateDeltaUpdateTrafficLightsRequest()
+    -> simulation_api_schema::UpdateTrafficLightsRequest;
 };
 }  // namespace traffic_simulator
 #endif  // TRAFFIC_SIMULATOR__TRAFFIC_LIGHTS__TRAFFIC_LIGHT_MANAGER_BASE_HPP_
@@ -15,6 +15,8 @@
 #ifndef TRAFFIC_SIMULATOR__TRAFFIC_LIGHTS__TRAFFIC_LIGHT_MARKER_PUBLISHER_HPP
 #define TRAFFIC_SIMULATOR__TRAFFIC_LIGHTS__TRAFFIC_LIGHT_MARKER_PUBLISHER_HPP
 
+#include <cstddef>
+#include <optional>
 #include <traffic_simulator/traffic_lights/traffic_light_manager.hpp>
 
 namespace traffic_simulator
@@ -25,6 +27,7 @@ class TrafficLightMarkerPublisher
   const std::string map_frame_;
   const rclcpp::Clock::SharedPtr clock_ptr_;
   const std::shared_ptr<TrafficLightManager> traffic_light_manager_;
+  std::optional<std::size_t> drawn_version_;
 
   auto deleteAllMarkers() const -> void;
   auto drawMarkers() const -> void;
@@ -60,6 +60,7 @@ extern "C" {
 }  // extern "C"
 #endif
 
+#include <chrono>
 #include <rclcpp/rclcpp.hpp>
 #include <string>
 #include <traffic_simulator/color_utils/color_utils.hpp>
@@ -109,6 +110,27 @@ private:
     const std::vector<geometry_msgs::msg::Pose> & goal_pose,
     const traffic_simulator_msgs::msg::WaypointsArray & waypoints,
     const traffic_simulator_msgs::msg::Obstacle & obstacle, bool obstacle_find);
+  /**
+   * @brief check if the markers generated from the previous message can be reused.
+   * @param previous entity status received in the previous message.
+   * @param current entity status received in the current message.
+   * @return true if all fields the markers are generated from are equal, except the time.
+   */
+  static auto isSameAppearance(
+    const traffic_simulator_msgs::msg::EntityStatusWithTrajectory & previous,
+    const traffic_simulator_msgs::msg::EntityStatusWithTrajectory & current) -> bool;
+  /**
+   * @brief maximum rate of publishing markers in wall clock time, 0 means every message.
+   */
+  const double publish_rate_;
+  /**
+   * @brief lifetime of the markers, long enough to survive until the next publication.
+   */
+  const rclcpp::Duration marker_lifetime_;
+  /**
+   * @brief time of the last publication of markers.
+   */
+  std::chrono::steady_clock::time_point published_time_;
   /**
    * @brief publisher of marker topic.
    */
@@ -122,6 +144,11 @@ private:
    * @brief buffers for generated markers.
    */
   std::unordered_map<std::string, visualization_msgs::msg::MarkerArray> markers_;
+  /**
+   * @brief entity status the buffered markers are generated from.
+   */
+  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatusWithTrajectory>
+    sources_;
 };
 }  // namespace traffic_simulator
 
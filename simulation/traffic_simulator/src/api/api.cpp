@@ -14,7 +14,11 @@
 
 #include <tf2/LinearMath/Quaternion.h>
 
+#include <chrono>
+#include <fstream>
 #include <geometry/quaternion/euler_to_quaternion.hpp>
+#include <iomanip>
+#include <iostream>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -28,6 +32,36 @@
 
 namespace traffic_simulator
 {
+namespace
+{
+/**
+ * @brief check if a period of the rate has passed since the last time, and update the last time
+ */
+auto isTimeToPublish(helper::FrameProfiler::Clock::time_point & last_time, const double rate)
+  -> bool
+{
+  if (const auto now = helper::FrameProfiler::Clock::now();
+      0 < rate and 1 <= std::chrono::duration<double>(now - last_time).count() * rate) {
+    last_time = now;
+    return true;
+  } else {
+    return false;
+  }
+}
+}  // namespace
+
+API::~API()
+{
+  if (not configuration.frame_trace_path.empty()) {
+    if (std::ofstream ofs(configuration.frame_trace_path.string()); ofs) {
+      frame_profiler_->writeChromeTrace(ofs);
+    } else {
+      std::cerr << "Failed to write the frame trace to "
+                << std::quoted(configuration.frame_trace_path.string()) << std::endl;
+    }
+  }
+}
+
 void API::setVerbose(const bool verbose) { entity_manager_ptr_->setVerbose(verbose); }
 
 bool API::despawn(const std::string & name)
@@ -289,12 +323,13 @@ bool API::updateTimeInSim()
 
 bool API::updateTrafficLightsInSim()
 {
-  if (entity_manager_ptr_->trafficLightsChanged()) {
-    auto req = entity_manager_ptr_->generateUpdateRequestForConventionalTrafficLights();
-    return zeromq_client_.call(req).result().success();
+  /// @note The sensor simulator keeps the state of the traffic lights not contained in the request.
+  if (auto request = entity_manager_ptr_->generateDeltaUpdateRequestForConventionalTrafficLights();
+      request.states_size() > 0) {
+    return zeromq_client_.call(request).result().success();
+  } else {
+    return true;
   }
-  /// @todo handle response
-  return simulation_api_schema::UpdateTrafficLightsResponse().result().success();
 }
 
 bool API::updateEntitiesStatusInSim()
@@ -338,27 +373,71 @@ bool API::updateFrame()
     THROW_SEMANTIC_ERROR("Ego simulation is no longer supported in standalone mode");
   }
 
-  if (!updateEntitiesStatusInSim()) {
+  const auto measure = [this](auto section, auto && f) -> decltype(auto) {
+    return frame_profiler_->measure(section, std::forward<decltype(f)>(f));
+  };
+
+  const auto scope = frame_profiler_->measure(frame_sections_.frame);
+
+  if (!measure(frame_sections_.update_entities_status_in_sim, [this]() {
+        return updateEntitiesStatusInSim();
+      })) {
     return false;
   }
 
-  entity_manager_ptr_->update(getCurrentTime(), clock_.getStepTime());
-  traffic_controller_ptr_->execute(getCurrentTime(), clock_.getStepTime());
+  measure(frame_sections_.update_entities, [this]() {
+    entity_manager_ptr_->update(getCurrentTime(), clock_.getStepTime());
+  });
+  measure(frame_sections_.execute_traffic_controller, [this]() {
+    traffic_controller_ptr_->execute(getCurrentTime(), clock_.getStepTime());
+  });
+  measure(frame_sections_.update_colliding_pairs, [this]() {
+    entity_manager_ptr_->updateCollidingPairs();
+  });
 
   if (not configuration.standalone_mode) {
-    if (!updateTrafficLightsInSim() || !updateTimeInSim()) {
+    if (
+      !measure(frame_sections_.update_traffic_lights_in_sim, [this]() {
+        return updateTrafficLightsInSim();
+      }) ||
+      !measure(frame_sections_.update_time_in_sim, [this]() { return updateTimeInSim(); })) {
       return false;
     }
   }
 
-  entity_manager_ptr_->broadcastEntityTransform();
+  measure(frame_sections_.broadcast_entity_transform, [this]() {
+    entity_manager_ptr_->broadcastEntityTransform();
+  });
   clock_.update();
   clock_pub_->publish(clock_.getCurrentRosTimeAsMsg());
-  debug_marker_pub_->publish(entity_manager_ptr_->makeDebugMarker());
-  debug_marker_pub_->publish(traffic_controller_ptr_->makeDebugMarker());
+  measure(frame_sections_.make_debug_marker, [this]() { publishDebugMarker(); });
+  publishFrameProfile();
   return true;
 }
 
+auto API::publishDebugMarker() -> void
+{
+  /*
+     The debug markers are only for visualization, so they are built at the rate of the
+     configuration rather than every frame, and not built at all while nobody subscribes them.
+  */
+  if (
+    helper::hasSubscribers(*debug_marker_pub_) and
+    isTimeToPublish(debug_marker_published_time_, configuration.debug_marker_publish_rate)) {
+    debug_marker_pub_->publish(entity_manager_ptr_->makeDebugMarker());
+    debug_marker_pub_->publish(traffic_controller_ptr_->makeDebugMarker());
+  }
+}
+
+auto API::publishFrameProfile() -> void
+{
+  if (isTimeToPublish(frame_profile_published_time_, configuration.frame_profile_publish_rate)) {
+    auto frame_profile = frame_profiler_->toMsg();
+    frame_profile.header.stamp = clock_.getCurrentRosTimeAsMsg().clock;
+    frame_profile_pub_->publish(frame_profile);
+  }
+}
+
 void API::startNpcLogic()
 {
   if (entity_manager_ptr_->isNpcLogicStarted()) {
@@ -43,9 +43,44 @@ auto any(F f, T && x, Ts &&... xs)
   }
 }
 
+auto distanceAlongLanelet(
+  const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils,
+  const traffic_simulator_msgs::msg::BoundingBox & bounding_box, const double matching_distance,
+  const geometry_msgs::msg::Point & from, const geometry_msgs::msg::Point & to) -> double
+{
+  if (const auto from_lanelet_pose =
+        hdmap_utils->toLaneletPose(from, bounding_box, false, matching_distance);
+      from_lanelet_pose) {
+    if (const auto to_lanelet_pose =
+          hdmap_utils->toLaneletPose(to, bounding_box, false, matching_distance);
+        to_lanelet_pose) {
+      if (const auto distance = hdmap_utils->getLongitudinalDistance(
+            from_lanelet_pose.value(), to_lanelet_pose.value());
+          distance) {
+        return distance.value();
+      }
+    }
+  }
+  return math::geometry::hypot(from, to);
+}
+
+auto makePolylineTrajectoryCursor(
+  const std::shared_ptr<const traffic_simulator_msgs::msg::PolylineTrajectory> &
+    polyline_trajectory,
+  const traffic_simulator_msgs::msg::BoundingBox & bounding_box,
+  const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils, const double matching_distance)
+  -> PolylineTrajectoryCursor
+{
+  return PolylineTrajectoryCursor(
+    polyline_trajectory,
+    [&](const geometry_msgs::msg::Point & from, const geometry_msgs::msg::Point & to) {
+      return distanceAlongLanelet(hdmap_utils, bounding_box, matching_distance, from, to);
+    });
+}
+
 auto makeUpdatedStatus(
   const traffic_simulator_msgs::msg::EntityStatus & entity_status,
-  traffic_simulator_msgs::msg::PolylineTrajectory & polyline_trajectory,
+  PolylineTrajectoryCursor & polyline_trajectory,
   const traffic_simulator_msgs::msg::BehaviorParameter & behavior_parameter,
   const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils, const double step_time,
   double matching_distance, std::optional<double> target_speed) -> std::optional<EntityStatus>
@@ -60,7 +95,6 @@ auto makeUpdatedStatus(
   using math::geometry::operator+=;
 
   using math::geometry::CatmullRomSpline;
-  using math::geometry::hypot;
   using math::geometry::innerProduct;
   using math::geometry::norm;
   using math::geometry::normalize;
@@ -68,54 +102,12 @@ auto makeUpdatedStatus(
 
   auto distance_along_lanelet =
     [&](const geometry_msgs::msg::Point & from, const geometry_msgs::msg::Point & to) -> double {
-    if (const auto from_lanelet_pose =
-          hdmap_utils->toLaneletPose(from, entity_status.bounding_box, false, matching_distance);
-        from_lanelet_pose) {
-      if (const auto to_lanelet_pose =
-            hdmap_utils->toLaneletPose(to, entity_status.bounding_box, false, matching_distance);
-          to_lanelet_pose) {
-        if (const auto distance = hdmap_utils->getLongitudinalDistance(
-              from_lanelet_pose.value(), to_lanelet_pose.value());
-            distance) {
-          return distance.value();
-        }
-      }
-    }
-    return hypot(from, to);
+    return distanceAlongLanelet(
+      hdmap_utils, entity_status.bounding_box, matching_distance, from, to);
   };
 
   auto discard_the_front_waypoint_and_recurse = [&]() {
-    /*
-       The OpenSCENARIO standard does not define the behavior when the value of
-       Timing.domainAbsoluteRelative is "relative". The standard only states
-       "Definition of time value context as either absolute or relative", and
-       it is completely unclear when the relative time starts.
-
-       This implementation has interpreted the specification as follows:
-       Relative time starts from the start of FollowTrajectoryAction or from
-       the time of reaching the previous "waypoint with arrival time".
-
-       Note: not std::isnan(polyline_trajectory.base_time) means
-       "Timing.domainAbsoluteRelative is relative".
-
-       Note: not std::isnan(polyline_trajectory.shape.vertices.front().time)
-       means "The waypoint about to be popped is the waypoint with the
-       specified arrival time".
-    */
-    if (
-      not std::isnan(polyline_trajectory.base_time) and
-      not std::isnan(polyline_trajectory.shape.vertices.front().time)) {
-      polyline_trajectory.base_time = entity_status.time;
-    }
-
-    if (std::rotate(
-          std::begin(polyline_trajectory.shape.vertices),
-          std::begin(polyline_trajectory.shape.vertices) + 1,
-          std::end(polyline_trajectory.shape.vertices));
-        not polyline_trajectory.closed) {
-      polyline_trajectory.shape.vertices.pop_back();
-    }
-
+    polyline_trajectory.pop(entity_status.time);
     return makeUpdatedStatus(
       entity_status, polyline_trajectory, behavior_parameter, hdmap_utils, step_time,
       matching_distance, target_speed);
@@ -123,17 +115,6 @@ auto makeUpdatedStatus(
 
   auto is_infinity_or_nan = [](auto x) constexpr { return std::isinf(x) or std::isnan(x); };
 
-  auto first_waypoint_with_arrival_time_specified = [&]() {
-    return std::find_if(
-      polyline_trajectory.shape.vertices.begin(), polyline_trajectory.shape.vertices.end(),
-      [](auto && vertex) { return not std::isnan(vertex.time); });
-  };
-
-  auto is_breaking_waypoint = [&]() {
-    return first_waypoint_with_arrival_time_specified() >=
-           std::prev(polyline_trajectory.shape.vertices.end());
-  };
-
   /*
      The following code implements the steering behavior known as "seek". See
      "Steering Behaviors For Autonomous Characters" by Craig Reynolds for more
@@ -141,7 +122,7 @@ auto makeUpdatedStatus(
 
      See https://www.researchgate.net/publication/2495826_Steering_Behaviors_For_Autonomous_Characters
   */
-  if (polyline_trajectory.shape.vertices.empty()) {
+  if (polyline_trajectory.empty()) {
     return std::nullopt;
   } else if (const auto position = entity_status.pose.position; any(is_infinity_or_nan, position)) {
     throw common::Error(
@@ -151,11 +132,10 @@ auto makeUpdatedStatus(
       position.x, ", ", position.y, ", ", position.z, "].");
   } else if (
     /*
-       We've made sure that polyline_trajectory.shape.vertices is not empty, so
-       a reference to vertices.front() always succeeds. vertices.front() is
-       referenced only this once in this member function.
+       We've made sure that polyline_trajectory is not empty, so a reference to
+       polyline_trajectory.front() always succeeds.
     */
-    const auto target_position = polyline_trajectory.shape.vertices.front().position.position;
+    const auto target_position = polyline_trajectory.front().position.position;
     any(is_infinity_or_nan, target_position)) {
     throw common::Error(
       "An error occurred in the internal state of FollowTrajectoryAction. Please report the "
@@ -170,8 +150,9 @@ auto makeUpdatedStatus(
     */
     const auto [distance_to_front_waypoint, remaining_time_to_front_waypoint] = std::make_tuple(
       distance_along_lanelet(position, target_position),
-      (not std::isnan(polyline_trajectory.base_time) ? polyline_trajectory.base_time : 0.0) +
-        polyline_trajectory.shape.vertices.front().time - entity_status.time);
+      (not std::isnan(polyline_trajectory.getBaseTime()) ? polyline_trajectory.getBaseTime()
+                                                         : 0.0) +
+        polyline_trajectory.front().time - entity_status.time);
     /*
        This clause is to avoid division-by-zero errors in later clauses with
        distance_to_front_waypoint as the denominator if the distance
@@ -187,24 +168,17 @@ auto makeUpdatedStatus(
            to this function (FollowPolylineTrajectoryAction::tick) in the
            future: if followingMode is follow, this distance calculation may be
            inappropriate.
-        */
-        auto total_distance_to = [&](auto last) {
-          auto total_distance = 0.0;
-          for (auto iter = std::begin(polyline_trajectory.shape.vertices);
-               0 < std::distance(iter, last); ++iter) {
-            total_distance +=
-              distance_along_lanelet(iter->position.position, std::next(iter)->position.position);
-          }
-          return total_distance;
-        };
 
-        if (
-          first_waypoint_with_arrival_time_specified() !=
-          std::end(polyline_trajectory.shape.vertices)) {
+           The distances between the remaining vertices are precomputed by
+           PolylineTrajectoryCursor, only the distance to the front vertex
+           depends on the current position.
+        */
+        if (polyline_trajectory.hasTargetArrivalTime()) {
           if (const auto remaining_time =
-                (not std::isnan(polyline_trajectory.base_time) ? polyline_trajectory.base_time
-                                                               : 0.0) +
-                first_waypoint_with_arrival_time_specified()->time - entity_status.time;
+                (not std::isnan(polyline_trajectory.getBaseTime())
+                   ? polyline_trajectory.getBaseTime()
+                   : 0.0) +
+                polyline_trajectory.getTargetVertex().time - entity_status.time;
               /*
                  The condition below should ideally be remaining_time < 0.
 
@@ -232,20 +206,18 @@ auto makeUpdatedStatus(
               "Vehicle ", std::quoted(entity_status.name),
               " failed to reach the trajectory waypoint at the specified time. The specified time "
               "is ",
-              first_waypoint_with_arrival_time_specified()->time, " (in ",
-              (not std::isnan(polyline_trajectory.base_time) ? "absolute" : "relative"),
+              polyline_trajectory.getTargetVertex().time, " (in ",
+              (not std::isnan(polyline_trajectory.getBaseTime()) ? "absolute" : "relative"),
               " simulation time). This may be due to unrealistic conditions of arrival time "
               "specification compared to vehicle parameters and dynamic constraints.");
           } else {
             return std::make_tuple(
-              distance_to_front_waypoint +
-                total_distance_to(first_waypoint_with_arrival_time_specified()),
+              distance_to_front_waypoint + polyline_trajectory.getDistanceToTargetVertex(),
               remaining_time != 0 ? remaining_time : std::numeric_limits<double>::epsilon());
           }
         } else {
           return std::make_tuple(
-            distance_to_front_waypoint +
-              total_distance_to(std::end(polyline_trajectory.shape.vertices) - 1),
+            distance_to_front_waypoint + polyline_trajectory.getDistanceToTargetVertex(),
             std::numeric_limits<double>::infinity());
         }
       }();
@@ -290,7 +262,7 @@ auto makeUpdatedStatus(
   } else if (
     /*
        The controller provides the ability to calculate acceleration using constraints from the
-       behavior_parameter. The value is_breaking_waypoint() determines whether the calculated
+       behavior_parameter. The value isTargetTheLastVertex() determines whether the calculated
        acceleration takes braking into account - it is true if the nearest waypoint with the
        specified time is the last waypoint or the nearest waypoint without the specified time is the
        last waypoint.
@@ -306,7 +278,7 @@ auto makeUpdatedStatus(
        behaviour_parameter.
     */
     const auto follow_waypoint_controller = FollowWaypointController(
-      behavior_parameter, step_time, is_breaking_waypoint(),
+      behavior_parameter, step_time, polyline_trajectory.isTargetTheLastVertex(),
       std::isinf(remaining_time) ? target_speed : std::nullopt);
     false) {
   } else if (
@@ -330,7 +302,8 @@ auto makeUpdatedStatus(
         throw common::Error(
           "Vehicle ", std::quoted(entity_status.name),
           " - controller operation problem encountered. ",
-          follow_waypoint_controller.getFollowedWaypointDetails(polyline_trajectory), e.what());
+          follow_waypoint_controller.getFollowedWaypointDetails(
+            polyline_trajectory.getRemainingVertices()), e.what());
       }
     }();
     std::isinf(desired_acceleration) or std::isnan(desired_acceleration)) {
@@ -354,7 +327,7 @@ auto makeUpdatedStatus(
                     variable dynamic_constraints_ignorable. the value of the
                     variable is `followingMode == position`.
                  */
-                 if (polyline_trajectory.dynamic_constraints_ignorable) {
+                 if (polyline_trajectory.isDynamicConstraintsIgnorable()) {
                    const auto dx = target_position.x - position.x;
                    const auto dy = target_position.y - position.y;
                    // if entity is on lane use pitch from lanelet, otherwise use pitch on target
@@ -503,7 +476,7 @@ auto makeUpdatedStatus(
         If the nearest waypoint is arrived at in this step without a specific arrival time, it will
         be considered as achieved
       */
-      if (std::isinf(remaining_time) && polyline_trajectory.shape.vertices.size() == 1) {
+      if (std::isinf(remaining_time) && polyline_trajectory.size() == 1) {
         /*
           If the trajectory has only waypoints with unspecified time, the last one is followed using
           maximum speed including braking - in this case accuracy of arrival is checked
@@ -539,7 +512,7 @@ auto makeUpdatedStatus(
           "Vehicle ", std::quoted(entity_status.name), " at time ", entity_status.time,
           "s (remaining time is ", remaining_time_to_front_waypoint,
           "s), has completed a trajectory to the nearest waypoint with",
-          " specified time equal to ", polyline_trajectory.shape.vertices.front().time,
+          " specified time equal to ", polyline_trajectory.front().time,
           "s at a distance equal to ", distance,
           " from that waypoint which is greater than the accepted accuracy.");
       }
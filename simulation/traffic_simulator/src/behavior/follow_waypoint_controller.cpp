@@ -186,35 +186,152 @@ auto FollowWaypointController::moveStraight(
     clampAcceleration(candidate_acceleration, state.acceleration, state.speed), step_time);
 }
 
+auto FollowWaypointController::brakeAnalytically(PredictedState & state) const -> bool
+{
+  // Decrease of the acceleration in one step, and increase of it in one step.
+  const double deceleration_step = max_deceleration_rate * step_time;
+  const double acceleration_step = max_acceleration_rate * step_time;
+
+  const double initial_deceleration = -state.acceleration;
+  const double initial_speed = state.speed;
+
+  if (
+    deceleration_step <= 0.0 || acceleration_step <= 0.0 ||
+    initial_deceleration < local_epsilon || initial_speed < local_epsilon ||
+    initial_speed > target_speed - local_epsilon) {
+    return false;
+  }
+
+  /*
+     The travel time is accumulated step by step, exactly as moveStraight
+     does - it is compared with the remaining time rounded to the full number
+     of steps, so even rounding errors matter there.
+  */
+  const auto add_travel_time = [&](const std::size_t number_of_steps) {
+    for (std::size_t step = 0; step < number_of_steps; ++step) {
+      state.travel_time += step_time;
+    }
+  };
+
+  /*
+     Number of the steps for which the condition holds, counted from the
+     first one - the condition has to be monotone (if it does not hold for
+     some step, it does not hold for any later one).
+  */
+  const auto count_steps = [](auto && holds) -> std::size_t {
+    constexpr auto max_number_of_steps = static_cast<std::size_t>(1) << 40;
+    if (!holds(0)) {
+      return 0;
+    } else {
+      std::size_t valid = 0;
+      std::size_t invalid = 1;
+      while (invalid < max_number_of_steps && holds(invalid)) {
+        valid = invalid;
+        invalid *= 2;
+      }
+      while (invalid - valid > 1) {
+        const auto middle = valid + (invalid - valid) / 2;
+        (holds(middle) ? valid : invalid) = middle;
+      }
+      return valid + 1;
+    }
+  };
+
+  // The acceleration decreases by deceleration_step in each step.
+  const auto linear_deceleration = [&](const double step) {
+    return initial_deceleration + step * deceleration_step;
+  };
+  const auto linear_speed = [&](const double step) {
+    return initial_speed -
+           step_time * (step * initial_deceleration + deceleration_step * step * (step + 1) / 2);
+  };
+  if (const auto number_of_steps = count_steps([&](const std::size_t step) {
+        const double deceleration = linear_deceleration(step);
+        const double speed = linear_speed(step);
+        const double time_for_non_acceleration =
+          std::max(getTimeRequiredForNonAcceleration(-deceleration), step_time);
+        return speed >= local_epsilon &&
+               (deceleration + deceleration_step) * time_for_non_acceleration <= speed;
+      });
+      number_of_steps > 0) {
+    const double n = number_of_steps;
+    state.acceleration = -linear_deceleration(n);
+    state.speed = linear_speed(n);
+    state.traveled_distance +=
+      step_time * (n * initial_speed - step_time * (initial_deceleration * n * (n + 1) / 2 +
+                                                    deceleration_step * n * (n + 1) * (n + 2) / 6));
+    add_travel_time(number_of_steps);
+    return true;
+  }
+
+  // The acceleration is limited by -speed / time_for_non_acceleration.
+  if (initial_deceleration <= acceleration_step) {
+    return false;
+  }
+  const double next_deceleration = initial_speed * max_acceleration_rate / initial_deceleration;
+  if (const double difference = next_deceleration - initial_deceleration;
+      difference > 0.0 || difference < -acceleration_step) {
+    /*
+       Otherwise in every second step the acceleration would be limited by
+       max_acceleration_rate instead.
+    */
+    return false;
+  }
+  const auto limited_deceleration = [&](const std::size_t step) {
+    return (step % 2 == 0 ? initial_deceleration : next_deceleration) -
+           static_cast<double>(step / 2) * acceleration_step;
+  };
+  const auto limited_speed = [&](const std::size_t step) {
+    return limited_deceleration(step) * limited_deceleration(step + 1) / max_acceleration_rate;
+  };
+  if (const auto number_of_steps = count_steps([&](const std::size_t step) {
+        return limited_deceleration(step) > acceleration_step &&
+               limited_speed(step) >= local_epsilon;
+      });
+      number_of_steps > 0) {
+    // Sum of (a - k * acceleration_step) * (b - k * acceleration_step) for k in [0, count).
+    const auto sum_of_products = [&](const double a, const double b, const double count) {
+      return count * a * b - acceleration_step * (a + b) * count * (count - 1) / 2 +
+             std::pow(acceleration_step, 2) * (count - 1) * count * (2 * count - 1) / 6;
+    };
+    const double even_steps = number_of_steps / 2;
+    const double odd_steps = (number_of_steps + 1) / 2;
+    state.acceleration = -limited_deceleration(number_of_steps);
+    state.speed = limited_speed(number_of_steps);
+    state.traveled_distance +=
+      step_time / max_acceleration_rate *
+      (sum_of_products(
+         initial_deceleration - acceleration_step, next_deceleration - acceleration_step,
+         even_steps) +
+       sum_of_products(next_deceleration, initial_deceleration - acceleration_step, odd_steps));
+    add_travel_time(number_of_steps);
+    return true;
+  } else {
+    return false;
+  }
+}
+
 auto FollowWaypointController::getPredictedStopStateWithoutConsideringTime(
   const double step_acceleration, const double remaining_distance, const double acceleration,
   const double speed) const -> std::optional<PredictedState>
 {
   PredictedState breaking_check{acceleration, speed, 0.0, 0.0};
   moveStraight(breaking_check, step_acceleration);
-  while (!breaking_check.isImmobile(local_epsilon)) {
-    if (breaking_check.traveled_distance > remaining_distance + predicted_distance_tolerance) {
-      return std::nullopt;
-    } else {
-      moveStraight(breaking_check, breaking_check.acceleration - max_deceleration_rate * step_time);
-    }
+  if (brakeUntilImmobility(breaking_check, [&](const auto & state) {
+        return state.traveled_distance > remaining_distance + predicted_distance_tolerance;
+      })) {
+    return breaking_check;
+  } else {
+    return std::nullopt;
   }
-  return breaking_check;
 }
 
 auto FollowWaypointController::getPredictedWaypointArrivalState(
   const double step_acceleration, const double remaining_time, const double remaining_distance,
   const double acceleration, const double speed) const -> std::optional<PredictedState>
 {
-  const auto brakeUntilImmobility = [&](PredictedState & state) -> bool {
-    while (!state.isImmobile(local_epsilon)) {
-      if (state.travel_time >= remaining_time) {
-        return false;
-      } else {
-        moveStraight(state, state.acceleration - max_deceleration_rate * step_time);
-      }
-    }
-    return true;
+  const auto is_out_of_time = [&](const PredictedState & state) {
+    return state.travel_time >= remaining_time;
   };
 
   PredictedState state{acceleration, speed, 0.0, 0.0};
@@ -228,7 +345,7 @@ auto FollowWaypointController::getPredictedWaypointArrivalState(
     if (with_breaking) {
       // Predict the current (before acceleration zeroing) braking time required for stopping.
       PredictedState breaking_check = state;
-      if (!brakeUntilImmobility(breaking_check)) {
+      if (!brakeUntilImmobility(breaking_check, is_out_of_time)) {
         // If complete immobility is not possible - ignore this candidate.
         return std::nullopt;
       } else if (std::abs(breaking_check.travel_time - remaining_time) <= step_time) {
@@ -260,7 +377,7 @@ auto FollowWaypointController::getPredictedWaypointArrivalState(
 
       if (with_breaking) {
         // Predict the current (after acceleration zeroing) braking time required for stopping.
-        if (!brakeUntilImmobility(state)) {
+        if (!brakeUntilImmobility(state, is_out_of_time)) {
           // If complete immobility is not possible - ignore this candidate.
           return std::nullopt;
         } else if (std::abs(state.travel_time - remaining_time) <= step_time) {
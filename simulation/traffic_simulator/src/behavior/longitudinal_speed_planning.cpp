@@ -95,6 +95,23 @@ auto LongitudinalSpeedPlanner::getDynamicStates(
   return std::make_tuple(twist, accel, linear_jerk);
 }
 
+auto LongitudinalSpeedPlanner::getDynamicStates(
+  double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints & constraints,
+  const double current_speed, const double current_acceleration) const -> LongitudinalState
+{
+  if (target_speed > constraints.max_speed) {
+    target_speed = constraints.max_speed;
+  }
+  const double acceleration = std::clamp(
+    current_acceleration +
+      step_time * planLinearJerk(target_speed, constraints, current_speed, current_acceleration),
+    constraints.max_deceleration * -1, constraints.max_acceleration);
+  const double speed = std::clamp(
+    current_speed + acceleration * step_time, -1 * constraints.max_speed, constraints.max_speed);
+  const double acceleration_new = (speed - current_speed) / step_time;
+  return {speed, acceleration_new, (acceleration_new - current_acceleration) / step_time};
+}
+
 auto LongitudinalSpeedPlanner::getRunningDistance(
   double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints & constraints,
   const geometry_msgs::msg::Twist & current_twist, const geometry_msgs::msg::Accel & current_accel,
@@ -109,16 +126,20 @@ auto LongitudinalSpeedPlanner::getRunningDistance(
   if (isTargetSpeedReached(target_speed, current_twist, twist_tolerance)) {
     return 0;
   }
+  /**
+   * @note Only the linear x of the dynamic states affects the distance, so the states are
+   * integrated as LongitudinalState instead of building geometry_msgs in every step.
+   */
   double ret = 0;
-  std::tuple<geometry_msgs::msg::Twist, geometry_msgs::msg::Accel, double> next_state =
-    std::make_tuple(current_twist, current_accel, current_linear_jerk);
+  auto next_state =
+    LongitudinalState{current_twist.linear.x, current_accel.linear.x, current_linear_jerk};
   do {
     next_state =
-      getDynamicStates(target_speed, constraints, std::get<0>(next_state), std::get<1>(next_state));
-    ret = ret + std::get<0>(next_state).linear.x * step_time +
-          std::get<1>(next_state).linear.x * step_time * step_time / 2.0 +
-          std::get<2>(next_state) * step_time * step_time * step_time / 6.0;
-  } while (!isTargetSpeedReached(target_speed, std::get<0>(next_state), twist_tolerance));
+      getDynamicStates(target_speed, constraints, next_state.speed, next_state.acceleration);
+    ret = ret + next_state.speed * step_time +
+          next_state.acceleration * step_time * step_time / 2.0 +
+          next_state.linear_jerk * step_time * step_time * step_time / 6.0;
+  } while (std::abs(target_speed - next_state.speed) > twist_tolerance);
   return ret;
 }
 
@@ -258,20 +279,26 @@ auto LongitudinalSpeedPlanner::planLinearJerk(
   double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints & constraints,
   const geometry_msgs::msg::Twist & current_twist,
   const geometry_msgs::msg::Accel & current_accel) const -> double
+{
+  return planLinearJerk(target_speed, constraints, current_twist.linear.x, current_accel.linear.x);
+}
+
+auto LongitudinalSpeedPlanner::planLinearJerk(
+  double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints & constraints,
+  const double current_speed, const double current_acceleration) const -> double
 {
   double accel_x_new = 0;
-  if (isAccelerating(target_speed, current_twist)) {
+  if (current_speed <= target_speed) {
     accel_x_new = std::clamp(
-      current_accel.linear.x + step_time * constraints.max_acceleration_rate, 0.0,
-      std::min(constraints.max_acceleration, (target_speed - current_twist.linear.x) / step_time));
+      current_acceleration + step_time * constraints.max_acceleration_rate, 0.0,
+      std::min(constraints.max_acceleration, (target_speed - current_speed) / step_time));
   } else {
     accel_x_new = std::clamp(
-      current_accel.linear.x - step_time * constraints.max_deceleration_rate,
-      std::max(
-        constraints.max_deceleration * -1, (target_speed - current_twist.linear.x) / step_time),
+      current_acceleration - step_time * constraints.max_deceleration_rate,
+      std::max(constraints.max_deceleration * -1, (target_speed - current_speed) / step_time),
       0.0);
   }
-  return (accel_x_new - current_accel.linear.x) / step_time;
+  return (accel_x_new - current_acceleration) / step_time;
 }
 
 auto LongitudinalSpeedPlanner::forward(
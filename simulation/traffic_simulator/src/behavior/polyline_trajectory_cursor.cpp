@@ -0,0 +1,176 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <scenario_simulator_exception/exception.hpp>
+#include <traffic_simulator/behavior/polyline_trajectory_cursor.hpp>
+
+namespace traffic_simulator
+{
+namespace follow_trajectory
+{
+PolylineTrajectoryCursor::PolylineTrajectoryCursor(
+  const std::shared_ptr<const traffic_simulator_msgs::msg::PolylineTrajectory> & trajectory,
+  const Distance & distance)
+: trajectory_(trajectory)
+{
+  if (not trajectory_) {
+    THROW_SIMULATION_ERROR("PolylineTrajectoryCursor requires a trajectory, but nullptr is given.");
+  }
+
+  base_time_ = trajectory_->base_time;
+
+  const auto & vertices = trajectory_->shape.vertices;
+  const auto indices_size = trajectory_->closed ? 2 * vertices.size() : vertices.size();
+
+  /*
+     For a closed trajectory the length of each segment is computed only once,
+     the second lap reuses it.
+  */
+  std::vector<double> segment_lengths;
+  segment_lengths.reserve(vertices.size());
+  for (std::size_t i = 0; i + 1 < vertices.size(); ++i) {
+    segment_lengths.push_back(
+      distance(vertices[i].position.position, vertices[i + 1].position.position));
+  }
+  if (trajectory_->closed and not vertices.empty()) {
+    segment_lengths.push_back(
+      distance(vertices.back().position.position, vertices.front().position.position));
+  }
+
+  cumulative_lengths_.reserve(indices_size);
+  for (std::size_t i = 0; i < indices_size; ++i) {
+    cumulative_lengths_.push_back(
+      i == 0 ? 0.0 : cumulative_lengths_[i - 1] + segment_lengths[(i - 1) % vertices.size()]);
+  }
+
+  timed_vertex_indices_.resize(indices_size);
+  for (auto i = indices_size, timed_vertex_index = indices_size; 0 < i; --i) {
+    if (not std::isnan(getVertex(i - 1).time)) {
+      timed_vertex_index = i - 1;
+    }
+    timed_vertex_indices_[i - 1] = timed_vertex_index;
+  }
+}
+
+auto PolylineTrajectoryCursor::getTrajectory() const noexcept
+  -> const std::shared_ptr<const traffic_simulator_msgs::msg::PolylineTrajectory> &
+{
+  return trajectory_;
+}
+
+auto PolylineTrajectoryCursor::isClosed() const noexcept -> bool { return trajectory_->closed; }
+
+auto PolylineTrajectoryCursor::isDynamicConstraintsIgnorable() const noexcept -> bool
+{
+  return trajectory_->dynamic_constraints_ignorable;
+}
+
+auto PolylineTrajectoryCursor::getBaseTime() const noexcept -> double { return base_time_; }
+
+auto PolylineTrajectoryCursor::empty() const noexcept -> bool { return size() == 0; }
+
+auto PolylineTrajectoryCursor::size() const noexcept -> std::size_t
+{
+  return getEndIndex() - front_index_;
+}
+
+auto PolylineTrajectoryCursor::front() const -> const Vertex &
+{
+  if (empty()) {
+    THROW_SIMULATION_ERROR("There is no remaining vertex in the trajectory.");
+  }
+  return getVertex(front_index_);
+}
+
+auto PolylineTrajectoryCursor::hasTargetArrivalTime() const -> bool
+{
+  return not empty() and timed_vertex_indices_[front_index_] < getEndIndex();
+}
+
+auto PolylineTrajectoryCursor::getTargetVertex() const -> const Vertex &
+{
+  return getVertex(getTargetIndex());
+}
+
+auto PolylineTrajectoryCursor::isTargetTheLastVertex() const -> bool
+{
+  return getTargetIndex() + 1 == getEndIndex();
+}
+
+auto PolylineTrajectoryCursor::getDistanceToTargetVertex() const -> double
+{
+  return cumulative_lengths_[getTargetIndex()] - cumulative_lengths_[front_index_];
+}
+
+auto PolylineTrajectoryCursor::pop(const double current_time) -> void
+{
+  /*
+     The OpenSCENARIO standard does not define the behavior when the value of
+     Timing.domainAbsoluteRelative is "relative". The standard only states
+     "Definition of time value context as either absolute or relative", and
+     it is completely unclear when the relative time starts.
+
+     This implementation has interpreted the specification as follows:
+     Relative time starts from the start of FollowTrajectoryAction or from
+     the time of reaching the previous "waypoint with arrival time".
+
+     Note: not std::isnan(base_time_) means "Timing.domainAbsoluteRelative is
+     relative".
+
+     Note: not std::isnan(front().time) means "The waypoint about to be popped
+     is the waypoint with the specified arrival time".
+  */
+  if (not std::isnan(base_time_) and not std::isnan(front().time)) {
+    base_time_ = current_time;
+  }
+
+  /*
+     A closed trajectory is never exhausted - the front vertex is moved to the
+     back by stepping into the second lap of unwrapped indices, which is then
+     brought back to the first lap.
+  */
+  ++front_index_;
+  if (trajectory_->closed and front_index_ == trajectory_->shape.vertices.size()) {
+    front_index_ = 0;
+  }
+}
+
+auto PolylineTrajectoryCursor::getEndIndex() const noexcept -> std::size_t
+{
+  if (const auto vertices_size = trajectory_->shape.vertices.size(); trajectory_->closed) {
+    return vertices_size == 0 ? 0 : front_index_ + vertices_size;
+  } else {
+    return vertices_size;
+  }
+}
+
+auto PolylineTrajectoryCursor::getTargetIndex() const -> std::size_t
+{
+  if (empty()) {
+    THROW_SIMULATION_ERROR("There is no remaining vertex in the trajectory.");
+  } else if (const auto timed_vertex_index = timed_vertex_indices_[front_index_];
+             timed_vertex_index < getEndIndex()) {
+    return timed_vertex_index;
+  } else {
+    return getEndIndex() - 1;
+  }
+}
+
+auto PolylineTrajectoryCursor::getVertex(const std::size_t index) const -> const Vertex &
+{
+  return trajectory_->shape.vertices[index % trajectory_->shape.vertices.size()];
+}
+}  // namespace follow_trajectory
+}  // namespace traffic_simulator
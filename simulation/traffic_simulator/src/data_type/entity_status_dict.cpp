@@ -0,0 +1,78 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iomanip>
+#include <scenario_simulator_exception/exception.hpp>
+#include <traffic_simulator/data_type/entity_status_dict.hpp>
+
+namespace traffic_simulator
+{
+EntityStatusDict::EntityStatusDict()
+: EntityStatusDict([]() {
+    static const auto empty_statuses = std::make_shared<const Statuses>();
+    return empty_statuses;
+  }())
+{
+}
+
+EntityStatusDict::EntityStatusDict(
+  const std::shared_ptr<const Statuses> & statuses, const std::string & excluded_name)
+: statuses_(statuses)
+{
+  if (not statuses_) {
+    THROW_SIMULATION_ERROR("EntityStatusDict requires statuses, but nullptr is given.");
+  }
+  excluded_ = statuses_->find(excluded_name);
+}
+
+auto EntityStatusDict::begin() const -> const_iterator
+{
+  return const_iterator(statuses_->begin(), statuses_->end(), excluded_);
+}
+
+auto EntityStatusDict::end() const -> const_iterator
+{
+  return const_iterator(statuses_->end(), statuses_->end(), excluded_);
+}
+
+auto EntityStatusDict::find(const std::string & name) const -> const_iterator
+{
+  if (const auto iter = statuses_->find(name); iter == excluded_) {
+    return end();
+  } else {
+    return const_iterator(iter, statuses_->end(), excluded_);
+  }
+}
+
+auto EntityStatusDict::at(const std::string & name) const -> const CanonicalizedEntityStatus &
+{
+  if (const auto iter = find(name); iter == end()) {
+    THROW_SIMULATION_ERROR("Status of entity ", std::quoted(name), " does not exist.");
+  } else {
+    return iter->second;
+  }
+}
+
+auto EntityStatusDict::count(const std::string & name) const -> size_type
+{
+  return find(name) == end() ? 0 : 1;
+}
+
+auto EntityStatusDict::size() const -> size_type
+{
+  return statuses_->size() - (excluded_ == statuses_->end() ? 0 : 1);
+}
+
+auto EntityStatusDict::empty() const -> bool { return size() == 0; }
+}  // namespace traffic_simulator
@@ -32,7 +32,7 @@ static_assert(std::is_move_assignable_v<RelativeTargetSpeed>);
 
 double RelativeTargetSpeed::getAbsoluteValue(
   const CanonicalizedEntityStatus & status,
-  const std::unordered_map<std::string, CanonicalizedEntityStatus> & other_status) const
+  const EntityStatusDict & other_status) const
 {
   if (const auto iter = other_status.find(reference_entity_name); iter == other_status.end()) {
     if (static_cast<EntityStatus>(status).name == reference_entity_name) {
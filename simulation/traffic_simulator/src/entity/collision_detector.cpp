@@ -0,0 +1,91 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <traffic_simulator/entity/collision_detector.hpp>
+
+namespace traffic_simulator
+{
+namespace entity
+{
+auto CollisionDetector::clear() -> void
+{
+  /*
+     The names are kept, so that add overwrites them in place and reuses their buffers instead of
+     allocating a copy of every name every frame.
+  */
+  size_ = 0;
+  boxes_.clear();
+}
+
+auto CollisionDetector::add(
+  const std::string & name, const geometry_msgs::msg::Pose & pose,
+  const traffic_simulator_msgs::msg::BoundingBox & bounding_box) -> void
+{
+  if (size_ < names_.size()) {
+    names_[size_] = name;
+  } else {
+    names_.push_back(name);
+  }
+  ++size_;
+  boxes_.emplace_back(pose, bounding_box);
+}
+
+auto CollisionDetector::update() -> void
+{
+  proxies_.clear();
+  for (std::size_t index = 0; index < boxes_.size(); ++index) {
+    const auto & box = boxes_[index];
+    const auto half_extent_x = box.halfExtentX();
+    proxies_.push_back({box.center_x - half_extent_x, box.center_x + half_extent_x, index});
+  }
+  std::sort(proxies_.begin(), proxies_.end(), [](const auto & a, const auto & b) {
+    return a.min_x < b.min_x;
+  });
+
+  colliding_pairs_.clear();
+  for (auto first = proxies_.begin(); first != proxies_.end(); ++first) {
+    const auto & first_box = boxes_[first->index];
+    for (auto second = std::next(first); second != proxies_.end() and second->min_x <= first->max_x;
+         ++second) {
+      const auto & second_box = boxes_[second->index];
+      if (
+        std::abs(first_box.center_y - second_box.center_y) <=
+          first_box.halfExtentY() + second_box.halfExtentY() and
+        math::geometry::checkCollision2D(first_box, second_box)) {
+        const auto & first_name = names_[first->index];
+        const auto & second_name = names_[second->index];
+        if (first_name < second_name) {
+          colliding_pairs_.emplace_back(first_name, second_name);
+        } else if (second_name < first_name) {
+          colliding_pairs_.emplace_back(second_name, first_name);
+        }
+      }
+    }
+  }
+  std::sort(colliding_pairs_.begin(), colliding_pairs_.end());
+}
+
+auto CollisionDetector::isColliding(
+  const std::string & first_entity_name, const std::string & second_entity_name) const -> bool
+{
+  const auto pair = first_entity_name < second_entity_name
+                      ? Pair(first_entity_name, second_entity_name)
+                      : Pair(second_entity_name, first_entity_name);
+  return std::binary_search(colliding_pairs_.begin(), colliding_pairs_.end(), pair);
+}
+}  // namespace entity
+}  // namespace traffic_simulator
@@ -151,7 +151,7 @@ void EgoEntity::onUpdate(double current_time, double step_time)
     if (
       const auto non_canonicalized_updated_status =
         traffic_simulator::follow_trajectory::makeUpdatedStatus(
-          static_cast<traffic_simulator::EntityStatus>(*status_), *polyline_trajectory_,
+          static_cast<traffic_simulator::EntityStatus>(*status_), *polyline_trajectory_cursor_,
           behavior_parameter_, hdmap_utils_ptr_, step_time,
           getDefaultMatchingDistanceForLaneletPoseCalculation(),
           target_speed_ ? target_speed_.value() : status_->getTwist().linear.x)) {
@@ -222,7 +222,9 @@ auto EgoEntity::isControlledBySimulator() const -> bool { return is_controlled_b
 auto EgoEntity::requestFollowTrajectory(
   const std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> & parameter) -> void
 {
-  polyline_trajectory_ = parameter;
+  polyline_trajectory_cursor_.emplace(follow_trajectory::makePolylineTrajectoryCursor(
+    parameter, status_->getBoundingBox(), hdmap_utils_ptr_,
+    getDefaultMatchingDistanceForLaneletPoseCalculation()));
   VehicleEntity::requestFollowTrajectory(parameter);
   is_controlled_by_simulator_ = true;
 }
@@ -524,8 +524,12 @@ void EntityBase::setDynamicConstraints(
 void EntityBase::setOtherStatus(
   const std::unordered_map<std::string, CanonicalizedEntityStatus> & status)
 {
-  other_status_ = status;
-  other_status_.erase(name);
+  setOtherStatus(std::make_shared<const EntityStatusDict::Statuses>(status));
+}
+
+void EntityBase::setOtherStatus(const std::shared_ptr<const EntityStatusDict::Statuses> & status)
+{
+  other_status_ = EntityStatusDict(status, name);
 }
 
 auto EntityBase::setStatus(const EntityStatus & status, const lanelet::Ids & lanelet_ids) -> void
@@ -128,6 +128,15 @@ bool EntityManager::checkCollision(
   return false;
 }
 
+auto EntityManager::updateCollidingPairs() -> void
+{
+  collision_detector_.clear();
+  for (const auto & [name, entity] : entities_) {
+    collision_detector_.add(name, entity->getMapPose(), entity->getBoundingBox());
+  }
+  collision_detector_.update();
+}
+
 visualization_msgs::msg::MarkerArray EntityManager::makeDebugMarker() const
 {
   visualization_msgs::msg::MarkerArray marker;
@@ -334,12 +343,6 @@ auto EntityManager::getCurrentAction(const std::string & name) const -> std::str
   }
 }
 
-bool EntityManager::trafficLightsChanged()
-{
-  return conventional_traffic_light_manager_ptr_->hasAnyLightChanged() or
-         v2i_traffic_light_manager_ptr_->hasAnyLightChanged();
-}
-
 void EntityManager::setVerbose(const bool verbose)
 {
   configuration.verbose = verbose;
@@ -348,6 +351,13 @@ void EntityManager::setVerbose(const bool verbose)
   }
 }
 
+auto EntityManager::setFrameProfiler(const std::shared_ptr<helper::FrameProfiler> & profiler)
+  -> void
+{
+  frame_profiler_ = profiler;
+  npc_logic_sections_.clear();
+}
+
 auto EntityManager::updateNpcLogic(
   const std::string & name, const double current_time, const double step_time)
   -> const CanonicalizedEntityStatus &
@@ -357,7 +367,17 @@ auto EntityManager::updateNpcLogic(
   }
   if (const auto entity = getEntity(name)) {
     // Update npc completely if logic has started, otherwise update Autoware only - if it is Ego
-    if (npc_logic_started_) {
+    if (npc_logic_started_ and frame_profiler_) {
+      const auto & type_name = entity->getEntityTypename();
+      auto iter = npc_logic_sections_.find(type_name);
+      if (iter == npc_logic_sections_.end()) {
+        iter = npc_logic_sections_
+                 .emplace(type_name, frame_profiler_->section("npc_logic/" + type_name))
+                 .first;
+      }
+      const auto scope = frame_profiler_->measure(iter->second);
+      entity->onUpdate(current_time, step_time);
+    } else if (npc_logic_started_) {
       entity->onUpdate(current_time, step_time);
     } else if (const auto ego_entity = std::dynamic_pointer_cast<const EgoEntity>(entity)) {
       ego_entity->updateFieldOperatorApplication();
@@ -378,20 +398,39 @@ void EntityManager::update(const double current_time, const double step_time)
       configuration.conventional_traffic_light_publish_rate);
     v2i_traffic_light_updater_.createTimer(configuration.v2i_traffic_light_publish_rate);
   }
-  std::unordered_map<std::string, CanonicalizedEntityStatus> all_status;
+  /*
+     The statuses are gathered into one immutable snapshot that all entities
+     share, instead of copying all of them into each entity. The snapshot taken
+     after updating NPC logic is a new one, because the entities may still
+     refer to the previous one.
+  */
+  auto all_status = std::make_shared<EntityStatusDict::Statuses>();
   for (auto && [name, entity] : entities_) {
-    all_status.emplace(name, entity->getCanonicalizedStatus());
+    all_status->emplace(name, entity->getCanonicalizedStatus());
   }
   for (auto && [name, entity] : entities_) {
     entity->setOtherStatus(all_status);
   }
-  all_status.clear();
+  all_status = std::make_shared<EntityStatusDict::Statuses>();
   for (auto && [name, entity] : entities_) {
-    all_status.emplace(name, updateNpcLogic(name, current_time, step_time));
+    all_status->emplace(name, updateNpcLogic(name, current_time, step_time));
   }
   for (auto && [name, entity] : entities_) {
     entity->setOtherStatus(all_status);
   }
+  if (helper::hasSubscribers(*entity_status_array_pub_ptr_)) {
+    publishEntityStatusArray(*all_status, current_time, step_time);
+  }
+  stop_watch_update.stop();
+  if (configuration.verbose) {
+    stop_watch_update.print();
+  }
+}
+
+auto EntityManager::publishEntityStatusArray(
+  const std::unordered_map<std::string, CanonicalizedEntityStatus> & all_status,
+  const double current_time, const double step_time) -> void
+{
   traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray status_array_msg;
   for (auto && [name, status] : all_status) {
     traffic_simulator_msgs::msg::EntityStatusWithTrajectory status_with_trajectory;
@@ -412,20 +451,18 @@ void EntityManager::update(const double current_time, const double step_time)
     status_array_msg.data.emplace_back(status_with_trajectory);
   }
   entity_status_array_pub_ptr_->publish(status_array_msg);
-  stop_watch_update.stop();
-  if (configuration.verbose) {
-    stop_watch_update.print();
-  }
 }
 
 void EntityManager::updateHdmapMarker()
 {
-  MarkerArray markers;
+  /*
+     The map does not change during the simulation, so the markers are published only once. The
+     publisher is transient local, so subscribers joining later receive them too.
+  */
+  auto markers = hdmap_utils_ptr_->generateMarker();
   const auto stamp = clock_ptr_->now();
-  for (const auto & marker_raw : markers_raw_.markers) {
-    visualization_msgs::msg::Marker marker = marker_raw;
+  for (auto & marker : markers.markers) {
     marker.header.stamp = stamp;
-    markers.markers.emplace_back(marker);
   }
   lanelet_marker_pub_ptr_->publish(markers);
 }
@@ -31,6 +31,7 @@
 #include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
+#include <cmath>
 #include <deque>
 #include <geometry/quaternion/euler_to_quaternion.hpp>
 #include <geometry/quaternion/get_rotation.hpp>
@@ -43,6 +44,7 @@
 #include <geometry/vector3/normalize.hpp>
 #include <geometry/vector3/operator.hpp>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <scenario_simulator_exception/exception.hpp>
 #include <set>
@@ -88,70 +90,237 @@ HdMapUtils::HdMapUtils(
   all_graphs.push_back(pedestrian_routing_graph_ptr_);
   shoulder_lanelets_ =
     lanelet::utils::query::shoulderLanelets(lanelet::utils::query::laneletLayer(lanelet_map_ptr_));
+  buildLaneletConnections();
+  buildRegulatoryElementIndex();
 }
 
-auto HdMapUtils::getAllCanonicalizedLaneletPoses(
-  const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose) const
-  -> std::vector<traffic_simulator_msgs::msg::LaneletPose>
+auto HdMapUtils::shared(
+  const boost::filesystem::path & lanelet2_map_path, const geographic_msgs::msg::GeoPoint & origin)
+  -> std::shared_ptr<HdMapUtils>
 {
-  /// @note Define lambda functions for canonicalizing previous/next lanelet.
-  const auto canonicalize_to_previous_lanelet =
-    [this](const auto & lanelet_pose) -> std::vector<traffic_simulator_msgs::msg::LaneletPose> {
-    if (const auto ids = getPreviousLaneletIds(lanelet_pose.lanelet_id); !ids.empty()) {
-      std::vector<traffic_simulator_msgs::msg::LaneletPose> canonicalized_all;
-      for (const auto id : ids) {
-        const auto lanelet_pose_tmp = traffic_simulator::helper::constructLaneletPose(
-          id, lanelet_pose.s + getLaneletLength(id), lanelet_pose.offset);
-        if (const auto canonicalized_lanelet_poses =
-              getAllCanonicalizedLaneletPoses(lanelet_pose_tmp);
-            canonicalized_lanelet_poses.empty()) {
-          canonicalized_all.emplace_back(lanelet_pose_tmp);
-        } else {
-          std::copy(
-            canonicalized_lanelet_poses.begin(), canonicalized_lanelet_poses.end(),
-            std::back_inserter(canonicalized_all));
+  static std::mutex mutex;
+
+  static std::unordered_map<std::string, std::weak_ptr<HdMapUtils>> instances;
+
+  // the origin does not affect loading the map, so the instances are keyed by the path only
+  const auto key = boost::filesystem::weakly_canonical(lanelet2_map_path).string();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (auto instance = instances[key].lock()) {
+    return instance;
+  } else {
+    instance = std::make_shared<HdMapUtils>(lanelet2_map_path, origin);
+    instances[key] = instance;
+    return instance;
+  }
+}
+
+auto HdMapUtils::buildLaneletConnections() -> void
+{
+  for (const auto & lanelet : lanelet_map_ptr_->laneletLayer) {
+    auto & connection = lanelet_connections_[lanelet.id()];
+    connection.length = lanelet::utils::getLaneletLength2d(lanelet);
+    for (const auto & following_lanelet : vehicle_routing_graph_ptr_->following(lanelet)) {
+      connection.next_ids.push_back(following_lanelet.id());
+    }
+    for (const auto & previous_lanelet : vehicle_routing_graph_ptr_->previous(lanelet)) {
+      connection.previous_ids.push_back(previous_lanelet.id());
+    }
+    connection.next_ids += getNextRoadShoulderLanelet(lanelet.id());
+    connection.previous_ids += getPreviousRoadShoulderLanelet(lanelet.id());
+  }
+}
+
+auto HdMapUtils::getLaneletConnection(const lanelet::Id lanelet_id) const
+  -> const LaneletConnection &
+{
+  if (const auto iter = lanelet_connections_.find(lanelet_id);
+      iter != lanelet_connections_.end()) {
+    return iter->second;
+  } else {
+    THROW_SEMANTIC_ERROR("lanelet : ", lanelet_id, " does not exist.");
+  }
+}
+
+auto HdMapUtils::buildRegulatoryElementIndex() -> void
+{
+  using Type = RegulatoryFeature::Type;
+
+  std::vector<lanelet::routing::RoutingGraphConstPtr> graphs;
+  graphs.emplace_back(vehicle_routing_graph_ptr_);
+  graphs.emplace_back(pedestrian_routing_graph_ptr_);
+  lanelet::routing::RoutingGraphContainer container(graphs);
+
+  for (const auto & lanelet : lanelet_map_ptr_->laneletLayer) {
+    auto & elements = regulatory_elements_[lanelet.id()];
+
+    const auto add_feature = [&](const Type type, const lanelet::Id id, const auto & polygon) {
+      if (polygon.size() > 1) {
+        if (const auto s = getCenterPointsSpline(lanelet.id())->getCollisionPointsIn2D(polygon);
+            not s.empty()) {
+          elements.features.push_back({type, id, *s.begin(), *s.rbegin()});
+        }
+      }
+    };
+
+    for (const auto & traffic_sign : lanelet.regulatoryElementsAs<const lanelet::TrafficSign>()) {
+      if (traffic_sign->type() == "stop_sign") {
+        for (const auto & stop_line : traffic_sign->refLines()) {
+          elements.stop_lines.emplace_back(stop_line);
+          add_feature(Type::STOP_LINE, stop_line.id(), toPolygon(stop_line));
         }
       }
-      return canonicalized_all;
-    } else {
-      return {};
     }
-  };
-  const auto canonicalize_to_next_lanelet =
-    [this](const auto & lanelet_pose) -> std::vector<traffic_simulator_msgs::msg::LaneletPose> {
-    if (const auto ids = getNextLaneletIds(lanelet_pose.lanelet_id); !ids.empty()) {
-      std::vector<traffic_simulator_msgs::msg::LaneletPose> canonicalized_all;
-      for (const auto id : ids) {
-        const auto lanelet_pose_tmp = traffic_simulator::helper::constructLaneletPose(
-          id, lanelet_pose.s - getLaneletLength(lanelet_pose.lanelet_id), lanelet_pose.offset);
-        if (const auto canonicalized_lanelet_poses =
-              getAllCanonicalizedLaneletPoses(lanelet_pose_tmp);
-            canonicalized_lanelet_poses.empty()) {
-          canonicalized_all.emplace_back(lanelet_pose_tmp);
-        } else {
-          std::copy(
-            canonicalized_lanelet_poses.begin(), canonicalized_lanelet_poses.end(),
-            std::back_inserter(canonicalized_all));
+
+    for (const auto & traffic_light :
+         lanelet.regulatoryElementsAs<const lanelet::autoware::AutowareTrafficLight>()) {
+      for (const auto & light_bulbs : traffic_light->lightBulbs()) {
+        if (light_bulbs.hasAttribute("traffic_light_id")) {
+          if (const auto id = light_bulbs.attribute("traffic_light_id").asId(); id) {
+            elements.traffic_light_ids.push_back(id.value());
+            if (const auto stop_line = traffic_light->stopLine()) {
+              add_feature(Type::TRAFFIC_LIGHT_STOP_LINE, id.value(), toPolygon(stop_line.value()));
+            }
+          }
         }
       }
-      return canonicalized_all;
-    } else {
-      return {};
     }
-  };
 
-  /// @note If s value under 0, it means this pose is on the previous lanelet.
-  if (lanelet_pose.s < 0) {
-    return canonicalize_to_previous_lanelet(lanelet_pose);
+    constexpr std::size_t pedestrian_routing_graph_id = 1;
+    constexpr double height_clearance = 4;
+    for (const auto & crosswalk :
+         container.conflictingInGraph(lanelet, pedestrian_routing_graph_id, height_clearance)) {
+      elements.conflicting_crosswalk_ids.push_back(crosswalk.id());
+      add_feature(Type::CROSSWALK, crosswalk.id(), getLaneletPolygon(crosswalk.id()));
+    }
+
+    for (const auto & conflicting_lanelet :
+         lanelet::utils::getConflictingLanelets(vehicle_routing_graph_ptr_, lanelet)) {
+      elements.conflicting_lane_ids.push_back(conflicting_lanelet.id());
+      add_feature(
+        Type::CONFLICTING_LANE, conflicting_lanelet.id(),
+        getLaneletPolygon(conflicting_lanelet.id()));
+    }
+
+    std::stable_sort(
+      elements.features.begin(), elements.features.end(),
+      [](const auto & a, const auto & b) { return a.s < b.s; });
+  }
+
+  for (const auto & traffic_light : lanelet::utils::query::autowareTrafficLights(
+         lanelet::utils::query::laneletLayer(lanelet_map_ptr_))) {
+    for (const auto & light_bulbs : traffic_light->lightBulbs()) {
+      if (light_bulbs.hasAttribute("traffic_light_id")) {
+        if (const auto id = light_bulbs.attribute("traffic_light_id").asId(); id) {
+          traffic_lights_[id.value()].push_back(traffic_light);
+        }
+      }
+    }
   }
-  /// @note If s value overs it's lanelet length, it means this pose is on the next lanelet.
-  else if (lanelet_pose.s > (getLaneletLength(lanelet_pose.lanelet_id))) {
-    return canonicalize_to_next_lanelet(lanelet_pose);
+}
+
+auto HdMapUtils::getRegulatoryElements(const lanelet::Id lanelet_id) const
+  -> const RegulatoryElements &
+{
+  if (const auto iter = regulatory_elements_.find(lanelet_id);
+      iter != regulatory_elements_.end()) {
+    return iter->second;
+  } else {
+    THROW_SEMANTIC_ERROR("lanelet : ", lanelet_id, " does not exist.");
+  }
+}
+
+auto HdMapUtils::getRegulatoryFeatures(const lanelet::Id lanelet_id) const
+  -> const std::vector<RegulatoryFeature> &
+{
+  return getRegulatoryElements(lanelet_id).features;
+}
+
+auto HdMapUtils::getDistanceToRegulatoryFeature(
+  const lanelet::Ids & route_lanelets, const traffic_simulator_msgs::msg::LaneletPose & from,
+  const std::function<bool(const RegulatoryFeature &)> & predicate,
+  const double max_distance) const -> std::optional<double>
+{
+  /// @note distance from `from` to the beginning of the current lanelet of the route
+  double distance_to_lanelet = -from.s;
+  for (auto lanelet_id = std::find(route_lanelets.begin(), route_lanelets.end(), from.lanelet_id);
+       lanelet_id != route_lanelets.end() and distance_to_lanelet <= max_distance; ++lanelet_id) {
+    /**
+     * @note The features are sorted by the position where the centerline enters them, but the
+     *       edge where it leaves a feature that contains `from` may be farther than the entrance
+     *       of the next one, so the nearest feature of this lanelet is searched.
+     */
+    std::optional<double> nearest_distance;
+    for (const auto & feature : getRegulatoryFeatures(*lanelet_id)) {
+      const auto distance_to_entrance = distance_to_lanelet + feature.s;
+      if (const auto distance = distance_to_entrance >= 0 ? distance_to_entrance
+                                                          : distance_to_lanelet + feature.end_s;
+          distance >= 0 and (not nearest_distance or distance < nearest_distance.value()) and
+          predicate(feature)) {
+        nearest_distance = distance;
+      }
+    }
+    if (nearest_distance) {
+      if (nearest_distance.value() <= max_distance) {
+        return nearest_distance;
+      } else {
+        return std::nullopt;
+      }
+    }
+    distance_to_lanelet += getLaneletLength(*lanelet_id);
   }
+  return std::nullopt;
+}
+
+auto HdMapUtils::getAllCanonicalizedLaneletPoses(
+  const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose) const
+  -> std::vector<traffic_simulator_msgs::msg::LaneletPose>
+{
+  /**
+   * @note Moves the pose to each of the previous (if s < 0) or next (if s > length) lanelets.
+   *       Returns nothing if the pose is on its lanelet or there is no such lanelet.
+   */
+  const auto move_to_adjacent_lanelets = [this](const auto & lanelet_pose) {
+    std::vector<traffic_simulator_msgs::msg::LaneletPose> adjacent_lanelet_poses;
+    if (const auto & connection = getLaneletConnection(lanelet_pose.lanelet_id);
+        lanelet_pose.s < 0) {
+      for (const auto id : connection.previous_ids) {
+        adjacent_lanelet_poses.push_back(traffic_simulator::helper::constructLaneletPose(
+          id, lanelet_pose.s + getLaneletLength(id), lanelet_pose.offset));
+      }
+    } else if (lanelet_pose.s > connection.length) {
+      for (const auto id : connection.next_ids) {
+        adjacent_lanelet_poses.push_back(traffic_simulator::helper::constructLaneletPose(
+          id, lanelet_pose.s - connection.length, lanelet_pose.offset));
+      }
+    }
+    return adjacent_lanelet_poses;
+  };
+
   /// @note If s value is in range [0,length_of_the_lanelet], return lanelet_pose.
-  else {
+  if (const auto & connection = getLaneletConnection(lanelet_pose.lanelet_id);
+      0 <= lanelet_pose.s and lanelet_pose.s <= connection.length) {
     return {lanelet_pose};
   }
+
+  /**
+   * @note Depth first search over all the branches of the road, in the order of the adjacent
+   *       lanelets. A pose that cannot move further is a result, even if its s is out of range.
+   */
+  std::vector<traffic_simulator_msgs::msg::LaneletPose> canonicalized_all;
+  auto stack = move_to_adjacent_lanelets(lanelet_pose);
+  std::reverse(stack.begin(), stack.end());
+  while (not stack.empty()) {
+    const auto current = stack.back();
+    stack.pop_back();
+    if (auto adjacent_lanelet_poses = move_to_adjacent_lanelets(current);
+        adjacent_lanelet_poses.empty()) {
+      canonicalized_all.push_back(current);
+    } else {
+      stack.insert(stack.end(), adjacent_lanelet_poses.rbegin(), adjacent_lanelet_poses.rend());
+    }
+  }
+  return canonicalized_all;
 }
 
 // If route is not specified, the lanelet_id with the lowest array index is used as a candidate for
@@ -162,7 +331,8 @@ auto HdMapUtils::canonicalizeLaneletPose(
 {
   auto canonicalized = lanelet_pose;
   while (canonicalized.s < 0) {
-    if (const auto ids = getPreviousLaneletIds(canonicalized.lanelet_id); ids.empty()) {
+    if (const auto & ids = getLaneletConnection(canonicalized.lanelet_id).previous_ids;
+        ids.empty()) {
       return {std::nullopt, canonicalized.lanelet_id};
     } else {
       canonicalized.s += getLaneletLength(ids[0]);
@@ -170,7 +340,7 @@ auto HdMapUtils::canonicalizeLaneletPose(
     }
   }
   while (canonicalized.s > getLaneletLength(canonicalized.lanelet_id)) {
-    if (const auto ids = getNextLaneletIds(canonicalized.lanelet_id); ids.empty()) {
+    if (const auto & ids = getLaneletConnection(canonicalized.lanelet_id).next_ids; ids.empty()) {
       return {std::nullopt, canonicalized.lanelet_id};
     } else {
       canonicalized.s -= getLaneletLength(canonicalized.lanelet_id);
@@ -188,7 +358,8 @@ auto HdMapUtils::canonicalizeLaneletPose(
   auto canonicalized = lanelet_pose;
   while (canonicalized.s < 0) {
     // When canonicalizing to backward lanelet_id, do not consider route
-    if (const auto ids = getPreviousLaneletIds(canonicalized.lanelet_id); ids.empty()) {
+    if (const auto & ids = getLaneletConnection(canonicalized.lanelet_id).previous_ids;
+        ids.empty()) {
       return {std::nullopt, canonicalized.lanelet_id};
     } else {
       canonicalized.s += getLaneletLength(ids[0]);
@@ -198,7 +369,7 @@ auto HdMapUtils::canonicalizeLaneletPose(
   while (canonicalized.s > getLaneletLength(canonicalized.lanelet_id)) {
     bool next_lanelet_found = false;
     // When canonicalizing to forward lanelet_id, consider route
-    for (const auto id : getNextLaneletIds(canonicalized.lanelet_id)) {
+    for (const auto id : getLaneletConnection(canonicalized.lanelet_id).next_ids) {
       if (std::any_of(route_lanelets.begin(), route_lanelets.end(), [id](auto id_on_route) {
             return id == id_on_route;
           })) {
@@ -402,12 +573,8 @@ auto HdMapUtils::getConflictingLaneIds(const lanelet::Ids & lanelet_ids) const -
 {
   lanelet::Ids ids;
   for (const auto & lanelet_id : lanelet_ids) {
-    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-    const auto conflicting_lanelets =
-      lanelet::utils::getConflictingLanelets(vehicle_routing_graph_ptr_, lanelet);
-    for (const auto & conflicting_lanelet : conflicting_lanelets) {
-      ids.emplace_back(conflicting_lanelet.id());
-    }
+    const auto & conflicting_lane_ids = getRegulatoryElements(lanelet_id).conflicting_lane_ids;
+    ids.insert(ids.end(), conflicting_lane_ids.begin(), conflicting_lane_ids.end());
   }
   return ids;
 }
@@ -415,19 +582,9 @@ auto HdMapUtils::getConflictingLaneIds(const lanelet::Ids & lanelet_ids) const -
 auto HdMapUtils::getConflictingCrosswalkIds(const lanelet::Ids & lanelet_ids) const -> lanelet::Ids
 {
   lanelet::Ids ids;
-  std::vector<lanelet::routing::RoutingGraphConstPtr> graphs;
-  graphs.emplace_back(vehicle_routing_graph_ptr_);
-  graphs.emplace_back(pedestrian_routing_graph_ptr_);
-  lanelet::routing::RoutingGraphContainer container(graphs);
   for (const auto & lanelet_id : lanelet_ids) {
-    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-    double height_clearance = 4;
-    size_t routing_graph_id = 1;
-    const auto conflicting_crosswalks =
-      container.conflictingInGraph(lanelet, routing_graph_id, height_clearance);
-    for (const auto & crosswalk : conflicting_crosswalks) {
-      ids.emplace_back(crosswalk.id());
-    }
+    const auto & crosswalk_ids = getRegulatoryElements(lanelet_id).conflicting_crosswalk_ids;
+    ids.insert(ids.end(), crosswalk_ids.begin(), crosswalk_ids.end());
   }
   return ids;
 }
@@ -981,12 +1138,7 @@ auto HdMapUtils::getCenterPoints(const lanelet::Id lanelet_id) const
 
 auto HdMapUtils::getLaneletLength(const lanelet::Id lanelet_id) const -> double
 {
-  if (lanelet_length_cache_.exists(lanelet_id)) {
-    return lanelet_length_cache_.getLength(lanelet_id);
-  }
-  double ret = lanelet::utils::getLaneletLength2d(lanelet_map_ptr_->laneletLayer.get(lanelet_id));
-  lanelet_length_cache_.appendData(lanelet_id, ret);
-  return ret;
+  return getLaneletConnection(lanelet_id).length;
 }
 
 auto HdMapUtils::getPreviousRoadShoulderLanelet(const lanelet::Id lanelet_id) const -> lanelet::Ids
@@ -1003,15 +1155,7 @@ auto HdMapUtils::getPreviousRoadShoulderLanelet(const lanelet::Id lanelet_id) co
 
 auto HdMapUtils::getPreviousLaneletIds(const lanelet::Id lanelet_id) const -> lanelet::Ids
 {
-  lanelet::Ids ids;
-  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-  for (const auto & llt : vehicle_routing_graph_ptr_->previous(lanelet)) {
-    ids.push_back(llt.id());
-  }
-  for (const auto & id : getPreviousRoadShoulderLanelet(lanelet_id)) {
-    ids.push_back(id);
-  }
-  return ids;
+  return getLaneletConnection(lanelet_id).previous_ids;
 }
 
 auto HdMapUtils::getPreviousLaneletIds(const lanelet::Ids & lanelet_ids) const -> lanelet::Ids
@@ -1060,15 +1204,7 @@ auto HdMapUtils::getNextRoadShoulderLanelet(const lanelet::Id lanelet_id) const
 
 auto HdMapUtils::getNextLaneletIds(const lanelet::Id lanelet_id) const -> lanelet::Ids
 {
-  lanelet::Ids ids;
-  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-  for (const auto & llt : vehicle_routing_graph_ptr_->following(lanelet)) {
-    ids.push_back(llt.id());
-  }
-  for (const auto & id : getNextRoadShoulderLanelet(lanelet_id)) {
-    ids.push_back(id);
-  }
-  return ids;
+  return getLaneletConnection(lanelet_id).next_ids;
 }
 
 auto HdMapUtils::getNextLaneletIds(const lanelet::Ids & lanelet_ids) const -> lanelet::Ids
@@ -1336,43 +1472,52 @@ auto HdMapUtils::getLaneChangeTrajectory(
   const geometry_msgs::msg::Pose & from_pose,
   const traffic_simulator::lane_change::Parameter & lane_change_parameter,
   const double maximum_curvature_threshold, const double target_trajectory_length,
-  const double forward_distance_threshold) const
+  const double forward_distance_threshold, const std::size_t maximum_number_of_candidates) const
   -> std::optional<std::pair<math::geometry::HermiteCurve, double>>
 {
-  double to_length = getLaneletLength(lane_change_parameter.target.lanelet_id);
-  std::vector<double> evaluation, target_s;
-  std::vector<math::geometry::HermiteCurve> curves;
-
-  for (double to_s = 0; to_s < to_length; to_s = to_s + 1.0) {
-    auto goal_pose = toMapPose(traffic_simulator::helper::constructLaneletPose(
-      lane_change_parameter.target.lanelet_id, to_s));
+  std::optional<std::pair<math::geometry::HermiteCurve, double>> best;
+  double best_evaluation = std::numeric_limits<double>::infinity();
+  std::size_t number_of_candidates = 0;
+  for (const auto & goal : getLaneChangeGoals(lane_change_parameter.target.lanelet_id)) {
     if (
-      math::geometry::getRelativePose(from_pose, goal_pose.pose).position.x <=
+      math::geometry::getRelativePose(from_pose, goal.pose).position.x <=
       forward_distance_threshold) {
       continue;
     }
+    if (number_of_candidates++ == maximum_number_of_candidates) {
+      break;
+    }
     double start_to_goal_distance = std::sqrt(
-      std::pow(from_pose.position.x - goal_pose.pose.position.x, 2) +
-      std::pow(from_pose.position.y - goal_pose.pose.position.y, 2) +
-      std::pow(from_pose.position.z - goal_pose.pose.position.z, 2));
-    traffic_simulator_msgs::msg::LaneletPose to_pose;
-    to_pose.lanelet_id = lane_change_parameter.target.lanelet_id;
-    to_pose.s = to_s;
+      std::pow(from_pose.position.x - goal.pose.position.x, 2) +
+      std::pow(from_pose.position.y - goal.pose.position.y, 2) +
+      std::pow(from_pose.position.z - goal.pose.position.z, 2));
     auto traj = getLaneChangeTrajectory(
-      from_pose, to_pose, lane_change_parameter.trajectory_shape, start_to_goal_distance * 0.5);
-    if (traj.getMaximum2DCurvature() < maximum_curvature_threshold) {
-      double eval = std::fabs(target_trajectory_length - traj.getLength());
-      evaluation.push_back(eval);
-      curves.push_back(traj);
-      target_s.push_back(to_s);
+      from_pose, goal, lane_change_parameter.trajectory_shape, start_to_goal_distance * 0.5);
+    /// @note Ties keep the first candidate, the same as std::min_element.
+    if (const double evaluation = std::fabs(target_trajectory_length - traj.getLength());
+        evaluation < best_evaluation and
+        traj.getMaximum2DCurvature() < maximum_curvature_threshold) {
+      best_evaluation = evaluation;
+      best = std::make_pair(traj, goal.lanelet_pose.s);
     }
   }
-  if (evaluation.empty()) {
-    return std::nullopt;
+  return best;
+}
+
+auto HdMapUtils::getLaneChangeGoals(const lanelet::Id lanelet_id) const
+  -> const std::vector<LaneChangeGoal> &
+{
+  if (!lane_change_goal_cache_.exists(lanelet_id)) {
+    std::vector<LaneChangeGoal> goals;
+    const double length = getLaneletLength(lanelet_id);
+    for (double s = 0; s < length; s = s + 1.0) {
+      const auto lanelet_pose = traffic_simulator::helper::constructLaneletPose(lanelet_id, s);
+      goals.push_back(
+        {lanelet_pose, toMapPose(lanelet_pose).pose, getTangentVector(lanelet_id, s)});
+    }
+    lane_change_goal_cache_.appendData(lanelet_id, goals);
   }
-  std::vector<double>::iterator min_itr = std::min_element(evaluation.begin(), evaluation.end());
-  size_t min_index = std::distance(evaluation.begin(), min_itr);
-  return std::make_pair(curves[min_index], target_s[min_index]);
+  return lane_change_goal_cache_.getGoals(lanelet_id);
 }
 
 auto HdMapUtils::getLaneChangeTrajectory(
@@ -1380,20 +1525,30 @@ auto HdMapUtils::getLaneChangeTrajectory(
   const traffic_simulator_msgs::msg::LaneletPose & to_pose,
   const traffic_simulator::lane_change::TrajectoryShape trajectory_shape,
   const double tangent_vector_size) const -> math::geometry::HermiteCurve
+{
+  const auto to = LaneChangeGoal{
+    to_pose, toMapPose(to_pose).pose, getTangentVector(to_pose.lanelet_id, to_pose.s)};
+  return getLaneChangeTrajectory(from_pose, to, trajectory_shape, tangent_vector_size);
+}
+
+auto HdMapUtils::getLaneChangeTrajectory(
+  const geometry_msgs::msg::Pose & from_pose, const LaneChangeGoal & to,
+  const traffic_simulator::lane_change::TrajectoryShape trajectory_shape,
+  const double tangent_vector_size) const -> math::geometry::HermiteCurve
 {
   geometry_msgs::msg::Vector3 start_vec;
   geometry_msgs::msg::Vector3 to_vec;
-  geometry_msgs::msg::Pose goal_pose = toMapPose(to_pose).pose;
+  const auto & goal_pose = to.pose;
   double tangent_vector_size_in_curve = 0.0;
   switch (trajectory_shape) {
     case traffic_simulator::lane_change::TrajectoryShape::CUBIC:
       start_vec = getVectorFromPose(from_pose, tangent_vector_size);
-      if (getTangentVector(to_pose.lanelet_id, to_pose.s)) {
-        to_vec = getTangentVector(to_pose.lanelet_id, to_pose.s).value();
+      if (to.tangent_vector) {
+        to_vec = to.tangent_vector.value();
       } else {
         THROW_SIMULATION_ERROR(
-          "Failed to calculate tangent vector at lanelet_id : ", to_pose.lanelet_id,
-          " s : ", to_pose.s);
+          "Failed to calculate tangent vector at lanelet_id : ", to.lanelet_pose.lanelet_id,
+          " s : ", to.lanelet_pose.s);
       }
       tangent_vector_size_in_curve = tangent_vector_size;
       break;
@@ -1543,11 +1698,23 @@ auto HdMapUtils::getLongitudinalDistance(
       return to.s - from.s;
     }
   }
-  const auto route = getRoute(from.lanelet_id, to.lanelet_id, allow_lane_change);
-  if (route.empty()) {
+  /// @note The distance along the route depends only on the lanelets, so it is cached.
+  if (
+    const auto distance = getLongitudinalDistanceBetweenLaneletOrigins(
+      from.lanelet_id, to.lanelet_id, allow_lane_change)) {
+    return distance.value() - from.s + to.s;
+  } else {
     return std::nullopt;
   }
-  double distance = 0;
+}
+
+auto HdMapUtils::getLongitudinalDistanceBetweenLaneletOrigins(
+  const lanelet::Id from, const lanelet::Id to, const bool allow_lane_change) const
+  -> std::optional<double>
+{
+  if (route_distance_cache_.exists(from, to, allow_lane_change)) {
+    return route_distance_cache_.getDistance(from, to, allow_lane_change);
+  }
 
   auto with_lane_change = [this](
                             const bool allow_lane_change, const lanelet::Id current_lanelet,
@@ -1563,53 +1730,57 @@ auto HdMapUtils::getLongitudinalDistance(
     }
   };
 
-  /// @note in this for loop, some cases are marked by @note command. each case is explained in the document.
-  /// @sa https://tier4.github.io/scenario_simulator_v2-docs/developer_guide/DistanceCalculation/
-  for (unsigned int i = 0; i < route.size(); i++) {
-    if (i < route.size() - 1 && with_lane_change(allow_lane_change, route[i], route[i + 1])) {
-      /// @note "the lanelet before the lane change" case
-      traffic_simulator_msgs::msg::LaneletPose next_lanelet_pose;
-      next_lanelet_pose.lanelet_id = route[i + 1];
-      next_lanelet_pose.s = 0.0;
-      next_lanelet_pose.offset = 0.0;
-
-      if (
-        auto next_lanelet_origin_from_current_lanelet =
-          toLaneletPose(toMapPose(next_lanelet_pose).pose, route[i], 10.0)) {
-        distance += next_lanelet_origin_from_current_lanelet->s;
-      } else {
-        traffic_simulator_msgs::msg::LaneletPose current_lanelet_pose = next_lanelet_pose;
-        current_lanelet_pose.lanelet_id = route[i];
+  const auto distance = [&]() -> std::optional<double> {
+    const auto route = getRoute(from, to, allow_lane_change);
+    if (route.empty()) {
+      return std::nullopt;
+    }
+    double distance = 0;
+    /// @note in this for loop, some cases are marked by @note command. each case is explained in the document.
+    /// @sa https://tier4.github.io/scenario_simulator_v2-docs/developer_guide/DistanceCalculation/
+    for (unsigned int i = 0; i < route.size(); i++) {
+      if (i < route.size() - 1 && with_lane_change(allow_lane_change, route[i], route[i + 1])) {
+        /// @note "the lanelet before the lane change" case
+        traffic_simulator_msgs::msg::LaneletPose next_lanelet_pose;
+        next_lanelet_pose.lanelet_id = route[i + 1];
+        next_lanelet_pose.s = 0.0;
+        next_lanelet_pose.offset = 0.0;
+
         if (
-          auto current_lanelet_origin_from_next_lanelet =
-            toLaneletPose(toMapPose(current_lanelet_pose).pose, route[i + 1], 10.0)) {
-          distance -= current_lanelet_origin_from_next_lanelet->s;
+          auto next_lanelet_origin_from_current_lanelet =
+            toLaneletPose(toMapPose(next_lanelet_pose).pose, route[i], 10.0)) {
+          distance += next_lanelet_origin_from_current_lanelet->s;
         } else {
-          return std::nullopt;
+          traffic_simulator_msgs::msg::LaneletPose current_lanelet_pose = next_lanelet_pose;
+          current_lanelet_pose.lanelet_id = route[i];
+          if (
+            auto current_lanelet_origin_from_next_lanelet =
+              toLaneletPose(toMapPose(current_lanelet_pose).pose, route[i + 1], 10.0)) {
+            distance -= current_lanelet_origin_from_next_lanelet->s;
+          } else {
+            return std::nullopt;
+          }
         }
-      }
 
-      /// @note "first lanelet before the lane change" case
-      if (route[i] == from.lanelet_id) {
-        distance -= from.s;
-        if (route[i + 1] == to.lanelet_id) {
-          distance += to.s;
+        /// @note "first lanelet before the lane change" case
+        if (route[i] == from && route[i + 1] == to) {
           return distance;
         }
-      }
-    } else {
-      if (route[i] == from.lanelet_id) {
-        /// @note "first lanelet" case
-        distance = getLaneletLength(from.lanelet_id) - from.s;
-      } else if (route[i] == to.lanelet_id) {
-        /// @note "last lanelet" case
-        distance += to.s;
       } else {
-        ///@note "normal intermediate lanelet" case
-        distance += getLaneletLength(route[i]);
+        if (route[i] == from) {
+          /// @note "first lanelet" case
+          distance = getLaneletLength(from);
+        } else if (route[i] != to) {
+          ///@note "normal intermediate lanelet" case
+          distance += getLaneletLength(route[i]);
+        }
+        /// @note "last lanelet" case adds nothing, since the distance is measured to its origin.
       }
     }
-  }
+    return distance;
+  }();
+
+  route_distance_cache_.appendData(from, to, allow_lane_change, distance);
   return distance;
 }
 
@@ -1758,20 +1929,6 @@ auto HdMapUtils::getRightOfWayLaneletIds(const lanelet::Id lanelet_id) const ->
   return ids;
 }
 
-auto HdMapUtils::getTrafficSignRegulatoryElementsOnPath(const lanelet::Ids & lanelet_ids) const
-  -> std::vector<std::shared_ptr<const lanelet::TrafficSign>>
-{
-  std::vector<std::shared_ptr<const lanelet::TrafficSign>> ret;
-  for (const auto & lanelet_id : lanelet_ids) {
-    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-    const auto traffic_signs = lanelet.regulatoryElementsAs<const lanelet::TrafficSign>();
-    for (const auto & traffic_sign : traffic_signs) {
-      ret.emplace_back(traffic_sign);
-    }
-  }
-  return ret;
-}
-
 auto HdMapUtils::getTrafficSignRegulatoryElements() const
   -> std::vector<std::shared_ptr<const lanelet::TrafficSign>>
 {
@@ -1786,21 +1943,6 @@ auto HdMapUtils::getTrafficSignRegulatoryElements() const
   return ret;
 }
 
-auto HdMapUtils::getTrafficLightRegulatoryElementsOnPath(const lanelet::Ids & lanelet_ids) const
-  -> std::vector<std::shared_ptr<const lanelet::autoware::AutowareTrafficLight>>
-{
-  std::vector<std::shared_ptr<const lanelet::autoware::AutowareTrafficLight>> ret;
-  for (const auto & lanelet_id : lanelet_ids) {
-    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-    const auto traffic_lights =
-      lanelet.regulatoryElementsAs<const lanelet::autoware::AutowareTrafficLight>();
-    for (const auto & traffic_light : traffic_lights) {
-      ret.emplace_back(traffic_light);
-    }
-  }
-  return ret;
-}
-
 auto HdMapUtils::getStopLines() const -> lanelet::ConstLineStrings3d
 {
   lanelet::ConstLineStrings3d ret;
@@ -1818,12 +1960,9 @@ auto HdMapUtils::getStopLinesOnPath(const lanelet::Ids & lanelet_ids) const
   -> lanelet::ConstLineStrings3d
 {
   lanelet::ConstLineStrings3d ret;
-  for (const auto & traffic_sign : getTrafficSignRegulatoryElementsOnPath(lanelet_ids)) {
-    if (traffic_sign->type() == "stop_sign") {
-      for (const auto & stop_line : traffic_sign->refLines()) {
-        ret.emplace_back(stop_line);
-      }
-    }
+  for (const auto & lanelet_id : lanelet_ids) {
+    const auto & stop_lines = getRegulatoryElements(lanelet_id).stop_lines;
+    ret.insert(ret.end(), stop_lines.begin(), stop_lines.end());
   }
   return ret;
 }
@@ -1849,23 +1988,11 @@ auto HdMapUtils::getStopLineIdsOnPath(const lanelet::Ids & route_lanelets) const
 auto HdMapUtils::getTrafficLights(const lanelet::Id traffic_light_id) const
   -> std::vector<lanelet::AutowareTrafficLightConstPtr>
 {
-  std::vector<lanelet::AutowareTrafficLightConstPtr> ret;
-  lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
-  auto autoware_traffic_lights = lanelet::utils::query::autowareTrafficLights(all_lanelets);
-  for (const auto & light : autoware_traffic_lights) {
-    for (auto light_string : light->lightBulbs()) {
-      if (light_string.hasAttribute("traffic_light_id")) {
-        auto id = light_string.attribute("traffic_light_id").asId();
-        if (id == traffic_light_id) {
-          ret.emplace_back(light);
-        }
-      }
-    }
-  }
-  if (ret.empty()) {
+  if (const auto iter = traffic_lights_.find(traffic_light_id); iter != traffic_lights_.end()) {
+    return iter->second;
+  } else {
     THROW_SEMANTIC_ERROR("traffic_light_id does not match. ID : ", traffic_light_id);
   }
-  return ret;
 }
 
 auto HdMapUtils::getTrafficLightStopLineIds(const lanelet::Id traffic_light_id) const
@@ -1920,14 +2047,9 @@ auto HdMapUtils::getStopLinePolygon(const lanelet::Id lanelet_id) const
 auto HdMapUtils::getTrafficLightIdsOnPath(const lanelet::Ids & route_lanelets) const -> lanelet::Ids
 {
   lanelet::Ids ids;
-  for (const auto & traffic_light : getTrafficLightRegulatoryElementsOnPath(route_lanelets)) {
-    for (auto light_string : traffic_light->lightBulbs()) {
-      if (light_string.hasAttribute("traffic_light_id")) {
-        if (auto id = light_string.attribute("traffic_light_id").asId(); id) {
-          ids.push_back(id.value());
-        }
-      }
-    }
+  for (const auto & lanelet_id : route_lanelets) {
+    const auto & traffic_light_ids = getRegulatoryElements(lanelet_id).traffic_light_ids;
+    ids.insert(ids.end(), traffic_light_ids.begin(), traffic_light_ids.end());
   }
   return ids;
 }
@@ -1936,21 +2058,11 @@ auto HdMapUtils::getDistanceToTrafficLightStopLine(
   const lanelet::Ids & route_lanelets,
   const std::vector<geometry_msgs::msg::Point> & waypoints) const -> std::optional<double>
 {
-  auto traffic_light_ids = getTrafficLightIdsOnPath(route_lanelets);
-  if (traffic_light_ids.empty()) {
-    return std::nullopt;
-  }
-  std::set<double> collision_points;
-  for (const auto id : traffic_light_ids) {
-    const auto collision_point = getDistanceToTrafficLightStopLine(waypoints, id);
-    if (collision_point) {
-      collision_points.insert(collision_point.value());
-    }
-  }
-  if (collision_points.empty()) {
+  if (waypoints.empty()) {
     return std::nullopt;
   }
-  return *collision_points.begin();
+  return getDistanceToTrafficLightStopLine(
+    route_lanelets, math::geometry::CatmullRomSpline(waypoints));
 }
 
 auto HdMapUtils::getDistanceToTrafficLightStopLine(
@@ -1981,15 +2093,8 @@ auto HdMapUtils::getDistanceToTrafficLightStopLine(
   if (waypoints.empty()) {
     return std::nullopt;
   }
-  math::geometry::CatmullRomSpline spline(waypoints);
-  const auto stop_lines = getTrafficLightStopLinesPoints(traffic_light_id);
-  for (const auto & stop_line : stop_lines) {
-    const auto collision_point = spline.getCollisionPointIn2D(stop_line);
-    if (collision_point) {
-      return collision_point;
-    }
-  }
-  return std::nullopt;
+  return getDistanceToTrafficLightStopLine(
+    math::geometry::CatmullRomSpline(waypoints), traffic_light_id);
 }
 
 auto HdMapUtils::getDistanceToTrafficLightStopLine(
@@ -2016,30 +2121,7 @@ auto HdMapUtils::getDistanceToStopLine(
   if (waypoints.empty()) {
     return std::nullopt;
   }
-  std::set<double> collision_points;
-  if (waypoints.empty()) {
-    return std::nullopt;
-  }
-  math::geometry::CatmullRomSpline spline(waypoints);
-  const auto stop_lines = getStopLinesOnPath({route_lanelets});
-  for (const auto & stop_line : stop_lines) {
-    std::vector<geometry_msgs::msg::Point> stop_line_points;
-    for (const auto & point : stop_line) {
-      geometry_msgs::msg::Point p;
-      p.x = point.x();
-      p.y = point.y();
-      p.z = point.z();
-      stop_line_points.emplace_back(p);
-    }
-    const auto collision_point = spline.getCollisionPointIn2D(stop_line_points);
-    if (collision_point) {
-      collision_points.insert(collision_point.value());
-    }
-  }
-  if (collision_points.empty()) {
-    return std::nullopt;
-  }
-  return *collision_points.begin();
+  return getDistanceToStopLine(route_lanelets, math::geometry::CatmullRomSpline(waypoints));
 }
 
 auto HdMapUtils::getDistanceToStopLine(
@@ -0,0 +1,214 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <scenario_simulator_exception/exception.hpp>
+#include <traffic_simulator/helper/frame_profiler.hpp>
+#include <utility>
+
+namespace traffic_simulator
+{
+namespace helper
+{
+namespace
+{
+auto nextProfilerId() -> std::uint64_t
+{
+  static std::atomic<std::uint64_t> id = 0;
+  return id.fetch_add(1, std::memory_order_relaxed);
+}
+
+auto toNanoseconds(FrameProfiler::Clock::duration duration) -> std::int64_t
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+}  // namespace
+
+FrameProfiler::FrameProfiler(std::size_t trace_capacity)
+: id(nextProfilerId()), trace_capacity(trace_capacity)
+{
+}
+
+auto FrameProfiler::section(const std::string & name) -> Section
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (const auto iter = sections.find(name); iter != sections.end()) {
+    return iter->second;
+  } else if (names.size() < max_number_of_sections) {
+    names.push_back(name);
+    return sections.emplace(name, names.size() - 1).first->second;
+  } else {
+    THROW_SIMULATION_ERROR(
+      "Too many sections are registered to the frame profiler, the limit is ",
+      max_number_of_sections, ". Failed to register section ", std::quoted(name), ".");
+  }
+}
+
+auto FrameProfiler::buffer() -> ThreadBuffer &
+{
+  /*
+     The last buffer used by this thread is cached, so the lock is taken only when the thread
+     switches between profilers.
+  */
+  thread_local struct
+  {
+    std::uint64_t profiler_id = std::numeric_limits<std::uint64_t>::max();
+    ThreadBuffer * buffer = nullptr;
+  } cache;
+
+  if (cache.profiler_id != id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto iter = std::find_if(buffers.begin(), buffers.end(), [](const auto & buffer) {
+      return buffer->thread_id == std::this_thread::get_id();
+    });
+    if (iter != buffers.end()) {
+      cache.buffer = iter->get();
+    } else {
+      buffers.push_back(std::make_unique<ThreadBuffer>());
+      buffers.back()->events.resize(trace_capacity);
+      cache.buffer = buffers.back().get();
+    }
+    cache.profiler_id = id;
+  }
+  return *cache.buffer;
+}
+
+auto FrameProfiler::record(Section section, Clock::time_point begin, Clock::time_point end) noexcept
+  -> void
+{
+  if (section < max_number_of_sections) {
+    auto & thread_buffer = buffer();
+
+    const auto nanoseconds = std::max<std::int64_t>(toNanoseconds(end - begin), 0);
+
+    auto & histogram = thread_buffer.histograms[section];
+    const auto bucket = std::min<std::size_t>(
+      nanoseconds < 2 ? 0 : 63 - __builtin_clzll(nanoseconds), Histogram::number_of_buckets - 1);
+    histogram.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    histogram.count.fetch_add(1, std::memory_order_relaxed);
+    histogram.total.fetch_add(nanoseconds, std::memory_order_relaxed);
+    for (auto current = histogram.maximum.load(std::memory_order_relaxed);
+         current < nanoseconds and not histogram.maximum.compare_exchange_weak(
+                                     current, nanoseconds, std::memory_order_relaxed);) {
+    }
+
+    if (trace_capacity) {
+      const auto index = thread_buffer.number_of_events.load(std::memory_order_relaxed);
+      thread_buffer.events[index % trace_capacity] = {
+        section, toNanoseconds(begin - origin), nanoseconds};
+      thread_buffer.number_of_events.store(index + 1, std::memory_order_release);
+    }
+  }
+}
+
+auto FrameProfiler::statistics() const -> std::vector<Statistics>
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  std::vector<Statistics> result;
+
+  for (std::size_t section = 0; section < names.size(); ++section) {
+    std::array<std::uint64_t, Histogram::number_of_buckets> buckets = {};
+    std::uint64_t count = 0;
+    std::int64_t total = 0, maximum = 0;
+
+    for (const auto & thread_buffer : buffers) {
+      const auto & histogram = thread_buffer->histograms[section];
+      for (std::size_t i = 0; i < buckets.size(); ++i) {
+        buckets[i] += histogram.buckets[i].load(std::memory_order_relaxed);
+      }
+      count += histogram.count.load(std::memory_order_relaxed);
+      total += histogram.total.load(std::memory_order_relaxed);
+      maximum = std::max(maximum, histogram.maximum.load(std::memory_order_relaxed));
+    }
+
+    const auto percentile = [&](std::uint64_t percent) {
+      /*
+         The buckets and the count are loaded separately, so they may disagree by the records made
+         in the meantime. The sum of the buckets is used as the population to stay consistent.
+      */
+      std::uint64_t population = 0;
+      for (const auto bucket : buckets) {
+        population += bucket;
+      }
+      const auto rank = (percent * population + 99) / 100;
+      std::uint64_t cumulative = 0;
+      for (std::size_t i = 0; i < buckets.size(); ++i) {
+        if (rank <= (cumulative += buckets[i]) and buckets[i]) {
+          return std::min<std::int64_t>(std::int64_t(2) << i, maximum);
+        }
+      }
+      return maximum;
+    };
+
+    result.push_back(
+      {names[section], count, std::chrono::nanoseconds(count == 0 ? 0 : total / count),
+       std::chrono::nanoseconds(percentile(50)), std::chrono::nanoseconds(percentile(99)),
+       std::chrono::nanoseconds(maximum)});
+  }
+
+  return result;
+}
+
+auto FrameProfiler::toMsg() const -> traffic_simulator_msgs::msg::FrameProfile
+{
+  const auto seconds = [](auto duration) {
+    return std::chrono::duration<double>(duration).count();
+  };
+
+  traffic_simulator_msgs::msg::FrameProfile msg;
+  for (const auto & each : statistics()) {
+    traffic_simulator_msgs::msg::FrameSectionProfile section;
+    section.name = each.name;
+    section.count = each.count;
+    section.mean = seconds(each.mean);
+    section.p50 = seconds(each.p50);
+    section.p99 = seconds(each.p99);
+    section.max = seconds(each.max);
+    msg.sections.push_back(section);
+  }
+  return msg;
+}
+
+auto FrameProfiler::writeChromeTrace(std::ostream & os) const -> void
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  const auto microseconds = [](std::int64_t nanoseconds) {
+    return static_cast<double>(nanoseconds) / 1000;
+  };
+
+  os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+  auto first = true;
+
+  for (std::size_t thread = 0; thread < buffers.size(); ++thread) {
+    const auto & thread_buffer = *buffers[thread];
+    const auto size = thread_buffer.number_of_events.load(std::memory_order_acquire);
+    for (auto index = size - std::min(size, trace_capacity); index < size; ++index) {
+      const auto & event = thread_buffer.events[index % trace_capacity];
+      os << (std::exchange(first, false) ? "\n" : ",\n")
+         << "{\"name\":" << std::quoted(names[event.section])
+         << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread << std::fixed << std::setprecision(3)
+         << ",\"ts\":" << microseconds(event.begin) << ",\"dur\":" << microseconds(event.duration)
+         << "}";
+    }
+  }
+
+  os << "\n]}\n";
+}
+}  // namespace helper
+}  // namespace traffic_simulator
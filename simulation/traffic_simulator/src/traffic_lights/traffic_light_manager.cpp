@@ -27,14 +27,17 @@ TrafficLightManager::TrafficLightManager(const std::shared_ptr<hdmap_utils::HdMa
 {
 }
 
-auto TrafficLightManager::hasAnyLightChanged() -> bool
+auto TrafficLightManager::getVersion() const -> std::size_t
 {
-  return true;
-  // return std::any_of(
-  //   std::begin(getTrafficLights()), std::end(getTrafficLights()), [](auto && id_and_traffic_light) {
-  //     return id_and_traffic_light.second.colorChanged() or
-  //            id_and_traffic_light.second.arrowChanged();
-  //   });
+  /*
+     Every change increments the version of one traffic light and traffic lights are never removed,
+     so the sum is strictly increasing with each addition or change.
+  */
+  std::size_t version = traffic_lights_.size();
+  for (const auto & [lanelet_id, traffic_light] : traffic_lights_) {
+    version += traffic_light.version();
+  }
+  return version;
 }
 
 auto TrafficLightManager::getTrafficLight(const lanelet::Id traffic_light_id) -> TrafficLight &
@@ -87,11 +90,30 @@ auto TrafficLightManager::getTrafficLights(const lanelet::Id lanelet_id)
 
 auto TrafficLightManager::generateUpdateTrafficLightsRequest()
   -> simulation_api_schema::UpdateTrafficLightsRequest
+{
+  if (const auto version = getVersion(); version != update_traffic_lights_request_version_) {
+    update_traffic_lights_request_.Clear();
+    for (auto && [lanelet_id, traffic_light] : traffic_lights_) {
+      *update_traffic_lights_request_.add_states() =
+        static_cast<simulation_api_schema::TrafficSignal>(traffic_light);
+    }
+    update_traffic_lights_request_version_ = version;
+  }
+  return update_traffic_lights_request_;
+}
+
+auto TrafficLightManager::generateDeltaUpdateTrafficLightsRequest()
+  -> simulation_api_schema::UpdateTrafficLightsRequest
 {
   simulation_api_schema::UpdateTrafficLightsRequest update_traffic_lights_request;
   for (auto && [lanelet_id, traffic_light] : traffic_lights_) {
-    *update_traffic_lights_request.add_states() =
-      static_cast<simulation_api_schema::TrafficSignal>(traffic_light);
+    if (auto [iter, inserted] =
+          sent_traffic_light_versions_.try_emplace(lanelet_id, traffic_light.version());
+        inserted or iter->second != traffic_light.version()) {
+      iter->second = traffic_light.version();
+      *update_traffic_lights_request.add_states() =
+        static_cast<simulation_api_schema::TrafficSignal>(traffic_light);
+    }
   }
   return update_traffic_lights_request;
 }
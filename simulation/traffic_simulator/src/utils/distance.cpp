@@ -95,24 +95,28 @@ auto longitudinalDistance(
      */
     constexpr double matching_distance = 5.0;
 
-    auto from_poses = hdmap_utils_ptr->toLaneletPoses(
-      static_cast<geometry_msgs::msg::Pose>(from), static_cast<LaneletPose>(from).lanelet_id,
-      matching_distance, include_opposite_direction);
-    from_poses.emplace_back(from);
+    /// @note Each candidate is canonicalized once, not once per pair of candidates.
+    const auto canonicalize = [&](const CanonicalizedLaneletPose & pose) {
+      std::vector<CanonicalizedLaneletPose> canonicalized_poses;
+      for (const auto & lanelet_pose : hdmap_utils_ptr->toLaneletPoses(
+             static_cast<geometry_msgs::msg::Pose>(pose), static_cast<LaneletPose>(pose).lanelet_id,
+             matching_distance, include_opposite_direction)) {
+        canonicalized_poses.emplace_back(lanelet_pose, hdmap_utils_ptr);
+      }
+      canonicalized_poses.push_back(pose);
+      return canonicalized_poses;
+    };
 
-    auto to_poses = hdmap_utils_ptr->toLaneletPoses(
-      static_cast<geometry_msgs::msg::Pose>(to), static_cast<LaneletPose>(to).lanelet_id,
-      matching_distance, include_opposite_direction);
-    to_poses.emplace_back(to);
+    const auto from_poses = canonicalize(from);
+    const auto to_poses = canonicalize(to);
 
     std::vector<double> distances = {};
     for (const auto & from_pose : from_poses) {
       for (const auto & to_pose : to_poses) {
         if (
           const auto distance = longitudinalDistance(
-            CanonicalizedLaneletPose(from_pose, hdmap_utils_ptr),
-            CanonicalizedLaneletPose(to_pose, hdmap_utils_ptr), false, include_opposite_direction,
-            allow_lane_change, hdmap_utils_ptr)) {
+            from_pose, to_pose, false, include_opposite_direction, allow_lane_change,
+            hdmap_utils_ptr)) {
           distances.emplace_back(distance.value());
         }
       }
@@ -50,13 +50,17 @@
 #include <rclcpp/rclcpp.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
 #include <string>
+#include <traffic_simulator/helper/helper.hpp>
 #include <traffic_simulator/visualization/visualization_component.hpp>
 #include <vector>
 
 namespace traffic_simulator
 {
 VisualizationComponent::VisualizationComponent(const rclcpp::NodeOptions & options)
-: Node("visualization", options)
+: Node("visualization", options),
+  publish_rate_(declare_parameter<double>("publish_rate", 0.0)),
+  marker_lifetime_(rclcpp::Duration::from_seconds(
+    0 < publish_rate_ ? std::max(0.1, 2.0 / publish_rate_) : 0.1))
 {
   marker_pub_ = create_publisher<visualization_msgs::msg::MarkerArray>("entity/marker", 1);
   entity_status_sub_ =
@@ -68,6 +72,21 @@ VisualizationComponent::VisualizationComponent(const rclcpp::NodeOptions & optio
 void VisualizationComponent::entityStatusCallback(
   const traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray::ConstSharedPtr msg)
 {
+  /*
+     Markers are not generated while nobody subscribes them. The buffered markers are kept, so
+     the markers of the entities despawned in the meantime are still deleted later.
+  */
+  if (not helper::hasSubscribers(*marker_pub_)) {
+    return;
+  }
+  if (const auto now = std::chrono::steady_clock::now();
+      0 < publish_rate_ and
+      std::chrono::duration<double>(now - published_time_).count() * publish_rate_ < 1) {
+    return;
+  } else {
+    published_time_ = now;
+  }
+
   visualization_msgs::msg::MarkerArray current_marker;
   std::vector<std::string> entity_name_lists;
   for (const auto & data : msg->data) {
@@ -86,18 +105,47 @@ void VisualizationComponent::entityStatusCallback(
   }
   for (const auto & name : erase_names) {
     markers_.erase(markers_.find(name));
+    sources_.erase(name);
   }
+  const auto previous_goal_pose_max_size = goal_pose_max_size;
+  const auto stamp = get_clock()->now();
   for (const auto & data : msg->data) {
-    auto marker_array =
-      generateMarker(data.status, data.goal_pose, data.waypoint, data.obstacle, data.obstacle_find);
+    if (const auto source = sources_.find(data.name);
+        source != sources_.end() and isSameAppearance(source->second, data)) {
+      // the entity looks the same as before, so only the stamps of its markers are updated
+      for (auto & marker : markers_[data.name].markers) {
+        if (marker.action == marker.ADD) {
+          marker.header.stamp = stamp;
+        }
+      }
+    } else {
+      markers_[data.name] = generateMarker(
+        data.status, data.goal_pose, data.waypoint, data.obstacle, data.obstacle_find);
+      sources_[data.name] = data;
+    }
     std::copy(
-      marker_array.markers.begin(), marker_array.markers.end(),
+      markers_[data.name].markers.begin(), markers_[data.name].markers.end(),
       std::back_inserter(current_marker.markers));
-    markers_[data.name] = marker_array;
+  }
+  // the ids of the goal pose markers of all entities depend on goal_pose_max_size
+  if (goal_pose_max_size != previous_goal_pose_max_size) {
+    sources_.clear();
   }
   marker_pub_->publish(current_marker);
 }
 
+auto VisualizationComponent::isSameAppearance(
+  const traffic_simulator_msgs::msg::EntityStatusWithTrajectory & previous,
+  const traffic_simulator_msgs::msg::EntityStatusWithTrajectory & current) -> bool
+{
+  auto status = current.status;
+  status.time = previous.status.time;
+  return previous.status == status and previous.goal_pose == current.goal_pose and
+         previous.waypoint == current.waypoint and
+         previous.obstacle_find == current.obstacle_find and
+         (not current.obstacle_find or previous.obstacle == current.obstacle);
+}
+
 const visualization_msgs::msg::MarkerArray VisualizationComponent::generateDeleteMarker(
   std::string ns)
 {
@@ -156,7 +204,7 @@ const visualization_msgs::msg::MarkerArray VisualizationComponent::generateMarke
         goal_pose_marker.scale.x = 1.6;
         goal_pose_marker.scale.y = 0.2;
         goal_pose_marker.scale.z = 0.2;
-        goal_pose_marker.lifetime = rclcpp::Duration::from_seconds(0.1);
+        goal_pose_marker.lifetime = marker_lifetime_;
         ret.markers.emplace_back(goal_pose_marker);
 
         visualization_msgs::msg::Marker goal_pose_text_marker;
@@ -174,7 +222,7 @@ const visualization_msgs::msg::MarkerArray VisualizationComponent::generateMarke
         goal_pose_text_marker.scale.x = 0.0;
         goal_pose_text_marker.scale.y = 0.0;
         goal_pose_text_marker.scale.z = 0.6;
-        goal_pose_text_marker.lifetime = rclcpp::Duration::from_seconds(0.1);
+        goal_pose_text_marker.lifetime = marker_lifetime_;
         goal_pose_text_marker.text =
           status.name + "_goal_" + std::to_string(int(goal_pose_max_size - goal_pose.size() + i));
         goal_pose_text_marker.color = color_names::makeColorMsg("white", 0.99);
@@ -212,7 +260,7 @@ const visualization_msgs::msg::MarkerArray VisualizationComponent::generateMarke
   bbox.id = 0;
   bbox.action = bbox.ADD;
   bbox.type = bbox.LINE_LIST;
-  bbox.lifetime = rclcpp::Duration::from_seconds(0.1);
+  bbox.lifetime = marker_lifetime_;
   geometry_msgs::msg::Point p0, p1, p2, p3, p4, p5, p6, p7;
 
   p0.x = status.bounding_box.center.x + status.bounding_box.dimensions.x * 0.5;
@@ -325,7 +373,7 @@ const visualization_msgs::msg::MarkerArray VisualizationComponent::generateMarke
   text.scale.x = 0.0;
   text.scale.y = 0.0;
   text.scale.z = 0.6;
-  text.lifetime = rclcpp::Duration::from_seconds(0.1);
+  text.lifetime = marker_lifetime_;
   text.text = status.name;
   text.color = color_names::makeColorMsg("white", 0.99);
   ret.markers.emplace_back(text);
@@ -364,7 +412,7 @@ const visualization_msgs::msg::MarkerArray VisualizationComponent::generateMarke
   arrow.scale.x = 1.0;
   arrow.scale.y = 1.0;
   arrow.scale.z = 1.0;
-  arrow.lifetime = rclcpp::Duration::from_seconds(0.1);
+  arrow.lifetime = marker_lifetime_;
   arrow.color = color_names::makeColorMsg("red", 0.99);
   ret.markers.emplace_back(arrow);
 
@@ -381,7 +429,7 @@ const visualization_msgs::msg::MarkerArray VisualizationComponent::generateMarke
   text_action.scale.x = 0.0;
   text_action.scale.y = 0.0;
   text_action.scale.z = 0.4;
-  text_action.lifetime = rclcpp::Duration::from_seconds(0.1);
+  text_action.lifetime = marker_lifetime_;
   text_action.text = status.action_status.current_action;
   if (status.lanelet_pose_valid) {
     text_action.text = text_action.text + "\nid:" + std::to_string(status.lanelet_pose.lanelet_id) +
@@ -0,0 +1,116 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <traffic_simulator/behavior/follow_waypoint_controller.hpp>
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+namespace traffic_simulator
+{
+namespace follow_trajectory
+{
+class FollowWaypointControllerTest : public testing::Test
+{
+protected:
+  static auto makeController(
+    const double step_time, const double max_acceleration_rate,
+    const double max_deceleration_rate) -> FollowWaypointController
+  {
+    traffic_simulator_msgs::msg::BehaviorParameter behavior_parameter;
+    behavior_parameter.dynamic_constraints.max_speed = 30.0;
+    behavior_parameter.dynamic_constraints.max_acceleration = 10.0;
+    behavior_parameter.dynamic_constraints.max_acceleration_rate = max_acceleration_rate;
+    behavior_parameter.dynamic_constraints.max_deceleration = 10.0;
+    behavior_parameter.dynamic_constraints.max_deceleration_rate = max_deceleration_rate;
+    return FollowWaypointController(behavior_parameter, step_time, true);
+  }
+
+  /**
+   * @note Validation oracle - braking simulated step by step.
+   */
+  static auto brakeIteratively(const FollowWaypointController & controller, PredictedState state)
+    -> PredictedState
+  {
+    while (!state.isImmobile(FollowWaypointController::local_epsilon)) {
+      controller.moveStraight(
+        state, state.acceleration - controller.max_deceleration_rate * controller.step_time);
+    }
+    return state;
+  }
+
+  static auto brake(const FollowWaypointController & controller, PredictedState state)
+    -> PredictedState
+  {
+    controller.brakeUntilImmobility(state, [](const auto &) { return false; });
+    return state;
+  }
+
+  static auto brakeAnalytically(const FollowWaypointController & controller, PredictedState & state)
+    -> bool
+  {
+    return controller.brakeAnalytically(state);
+  }
+};
+
+/**
+ * @note Test braking prediction correctness - the closed form solution is supposed to give the
+ * same state of immobility as the step by step simulation.
+ */
+TEST_F(FollowWaypointControllerTest, brakeUntilImmobility_sameAsIterative)
+{
+  for (const auto step_time : {0.02, 0.05, 0.1}) {
+    for (const auto & [acceleration_rate, deceleration_rate] :
+         {std::make_pair(3.0, 3.0), std::make_pair(1.0, 5.0), std::make_pair(4.5, 0.7)}) {
+      const auto controller = makeController(step_time, acceleration_rate, deceleration_rate);
+      for (const auto speed : {3.0, 10.0, 25.0}) {
+        for (const auto acceleration : {0.0, -0.3, -1.5}) {
+          const auto initial_state = PredictedState{acceleration, speed, 0.0, 0.0};
+          const auto expected = brakeIteratively(controller, initial_state);
+          const auto actual = brake(controller, initial_state);
+          EXPECT_NEAR(actual.acceleration, expected.acceleration, 1e-12);
+          EXPECT_NEAR(actual.speed, expected.speed, 1e-12);
+          EXPECT_NEAR(actual.traveled_distance, expected.traveled_distance, 1e-9);
+          EXPECT_DOUBLE_EQ(actual.travel_time, expected.travel_time);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @note Test braking prediction - the closed form solution is supposed to skip many steps at once
+ * when braking from a high speed, and to give way to the step by step simulation near immobility.
+ */
+TEST_F(FollowWaypointControllerTest, brakeAnalytically)
+{
+  const auto controller = makeController(0.05, 3.0, 3.0);
+
+  auto state = PredictedState{-0.15, 5.0, 0.0, 0.0};
+  ASSERT_TRUE(brakeAnalytically(controller, state));
+  EXPECT_GT(state.travel_time, 0.05 * 10);
+
+  auto immobile_state = PredictedState{0.0, 0.0, 0.0, 0.0};
+  EXPECT_FALSE(brakeAnalytically(controller, immobile_state));
+
+  auto accelerating_state = PredictedState{1.0, 5.0, 0.0, 0.0};
+  EXPECT_FALSE(brakeAnalytically(controller, accelerating_state));
+}
+}  // namespace follow_trajectory
+}  // namespace traffic_simulator
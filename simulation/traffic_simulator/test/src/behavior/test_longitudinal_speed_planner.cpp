@@ -213,6 +213,39 @@ TEST_F(LongitudinalSpeedPlannerTest, getDynamicStates_shortAccel)
   }
 }
 
+/**
+ * @note Test functionality used in other classes.
+ * Test calculations correctness of the overload free of message types - goal is to test that it
+ * integrates exactly the linear x of the dynamic states, when accelerating and decelerating.
+ */
+TEST_F(LongitudinalSpeedPlannerTest, getDynamicStates_longitudinalState)
+{
+  const auto constraints =
+    traffic_simulator_msgs::build<traffic_simulator_msgs::msg::DynamicConstraints>()
+      .max_acceleration(5.0)
+      .max_acceleration_rate(3.0)
+      .max_deceleration(5.0)
+      .max_deceleration_rate(3.0)
+      .max_speed(20.0);
+
+  for (const auto target_speed : {0.0, 12.0, 25.0}) {
+    auto twist = makeTwistWithLinearX(10.0);
+    auto accel = makeAccelWithLinearX(0.5);
+    auto state = traffic_simulator::longitudinal_speed_planning::LongitudinalState{
+      twist.linear.x, accel.linear.x, 0.0};
+    for (int i = 0; i < 1000; ++i) {
+      const auto [twist_new, accel_new, linear_jerk_new] =
+        planner.getDynamicStates(target_speed, constraints, twist, accel);
+      state = planner.getDynamicStates(target_speed, constraints, state.speed, state.acceleration);
+      EXPECT_EQ(state.speed, twist_new.linear.x);
+      EXPECT_EQ(state.acceleration, accel_new.linear.x);
+      EXPECT_EQ(state.linear_jerk, linear_jerk_new);
+      twist = twist_new;
+      accel = accel_new;
+    }
+  }
+}
+
 /**
  * @note Test functionality used in other classes.
  * Test calculations correctness with target_speed differing from current speed by several units.
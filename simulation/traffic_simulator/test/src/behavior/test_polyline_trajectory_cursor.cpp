@@ -0,0 +1,136 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <traffic_simulator/behavior/polyline_trajectory_cursor.hpp>
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+using traffic_simulator::follow_trajectory::PolylineTrajectoryCursor;
+
+auto makeTrajectory(
+  const std::vector<std::pair<double, double>> & x_and_times, const bool closed,
+  const double base_time = std::numeric_limits<double>::quiet_NaN())
+  -> std::shared_ptr<const traffic_simulator_msgs::msg::PolylineTrajectory>
+{
+  auto trajectory = std::make_shared<traffic_simulator_msgs::msg::PolylineTrajectory>();
+  trajectory->closed = closed;
+  trajectory->base_time = base_time;
+  for (const auto & [x, time] : x_and_times) {
+    traffic_simulator_msgs::msg::Vertex vertex;
+    vertex.position.position.x = x;
+    vertex.time = time;
+    trajectory->shape.vertices.push_back(vertex);
+  }
+  return trajectory;
+}
+
+auto makeCursor(const std::shared_ptr<const traffic_simulator_msgs::msg::PolylineTrajectory> & x)
+  -> PolylineTrajectoryCursor
+{
+  return PolylineTrajectoryCursor(
+    x, [](const geometry_msgs::msg::Point & from, const geometry_msgs::msg::Point & to) {
+      return std::abs(to.x - from.x);
+    });
+}
+
+constexpr auto no_time = std::numeric_limits<double>::quiet_NaN();
+
+/**
+ * @note Test distance and target vertex of an open trajectory - the target vertex is the nearest
+ * vertex with a specified arrival time, then the last vertex.
+ */
+TEST(PolylineTrajectoryCursor, open)
+{
+  const auto trajectory = makeTrajectory(
+    {{0.0, no_time}, {1.0, no_time}, {3.0, 5.0}, {6.0, no_time}, {10.0, no_time}}, false);
+  auto cursor = makeCursor(trajectory);
+
+  ASSERT_EQ(cursor.size(), 5u);
+  EXPECT_TRUE(cursor.hasTargetArrivalTime());
+  EXPECT_FALSE(cursor.isTargetTheLastVertex());
+  EXPECT_DOUBLE_EQ(cursor.getTargetVertex().time, 5.0);
+  EXPECT_DOUBLE_EQ(cursor.getDistanceToTargetVertex(), 3.0);
+
+  cursor.pop(1.0);
+  EXPECT_DOUBLE_EQ(cursor.front().position.position.x, 1.0);
+  EXPECT_DOUBLE_EQ(cursor.getDistanceToTargetVertex(), 2.0);
+
+  cursor.pop(2.0);
+  EXPECT_DOUBLE_EQ(cursor.getDistanceToTargetVertex(), 0.0);
+
+  cursor.pop(3.0);
+  EXPECT_FALSE(cursor.hasTargetArrivalTime());
+  EXPECT_TRUE(cursor.isTargetTheLastVertex());
+  EXPECT_DOUBLE_EQ(cursor.getTargetVertex().position.position.x, 10.0);
+  EXPECT_DOUBLE_EQ(cursor.getDistanceToTargetVertex(), 4.0);
+  EXPECT_EQ(cursor.getRemainingVertices().size(), 2u);
+
+  cursor.pop(4.0);
+  cursor.pop(5.0);
+  EXPECT_TRUE(cursor.empty());
+
+  EXPECT_EQ(trajectory->shape.vertices.size(), 5u);
+}
+
+/**
+ * @note Test a closed trajectory - it is never exhausted, and the distance to the target vertex
+ * and the remaining vertices wrap around the last vertex. The remaining vertices are those of the
+ * trajectory, not copies.
+ */
+TEST(PolylineTrajectoryCursor, closed)
+{
+  const auto trajectory = makeTrajectory({{0.0, no_time}, {2.0, 1.0}, {5.0, no_time}}, true);
+  auto cursor = makeCursor(trajectory);
+
+  cursor.pop(0.0);
+  cursor.pop(0.0);
+  ASSERT_EQ(cursor.size(), 3u);
+  EXPECT_DOUBLE_EQ(cursor.front().position.position.x, 5.0);
+  EXPECT_DOUBLE_EQ(cursor.getTargetVertex().position.position.x, 2.0);
+  EXPECT_TRUE(cursor.isTargetTheLastVertex());
+  EXPECT_DOUBLE_EQ(cursor.getDistanceToTargetVertex(), 5.0 + 2.0);
+
+  const auto remaining_vertices = cursor.getRemainingVertices();
+  ASSERT_EQ(remaining_vertices.size(), 3u);
+  EXPECT_EQ(&remaining_vertices[0], &trajectory->shape.vertices[2]);
+  EXPECT_EQ(&remaining_vertices[1], &trajectory->shape.vertices[0]);
+  EXPECT_EQ(&remaining_vertices[2], &trajectory->shape.vertices[1]);
+
+  cursor.pop(0.0);
+  EXPECT_FALSE(cursor.empty());
+  EXPECT_DOUBLE_EQ(cursor.front().position.position.x, 0.0);
+  EXPECT_DOUBLE_EQ(cursor.getDistanceToTargetVertex(), 2.0);
+}
+
+/**
+ * @note Test relative timing - reaching a vertex with a specified arrival time restarts the
+ * relative time, reaching any other vertex does not.
+ */
+TEST(PolylineTrajectoryCursor, baseTime)
+{
+  auto cursor = makeCursor(makeTrajectory({{0.0, no_time}, {1.0, 2.0}, {2.0, 2.0}}, false, 0.0));
+
+  cursor.pop(1.0);
+  EXPECT_DOUBLE_EQ(cursor.getBaseTime(), 0.0);
+  cursor.pop(2.0);
+  EXPECT_DOUBLE_EQ(cursor.getBaseTime(), 2.0);
+}
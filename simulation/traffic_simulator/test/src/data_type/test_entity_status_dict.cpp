@@ -0,0 +1,96 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <traffic_simulator/data_type/entity_status_dict.hpp>
+
+#include "../helper_functions.hpp"
+
+using EntityStatusDict = traffic_simulator::EntityStatusDict;
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+class EntityStatusDictTest : public testing::Test
+{
+protected:
+  EntityStatusDictTest()
+  : hdmap_utils(makeHdMapUtilsSharedPointer()),
+    statuses(std::make_shared<EntityStatusDict::Statuses>())
+  {
+    for (const auto & name : {"ego", "npc1", "npc2"}) {
+      statuses->emplace(
+        name, makeCanonicalizedEntityStatus(
+                hdmap_utils, makeCanonicalizedLaneletPose(hdmap_utils), makeBoundingBox(), 0.0,
+                name));
+    }
+  }
+
+  std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils;
+
+  std::shared_ptr<EntityStatusDict::Statuses> statuses;
+};
+
+/**
+ * @note Test that the view hides the excluded entity from lookup, iteration and size.
+ */
+TEST_F(EntityStatusDictTest, excluded)
+{
+  const auto dict = EntityStatusDict(statuses, "npc1");
+
+  EXPECT_EQ(dict.size(), 2u);
+  EXPECT_EQ(dict.count("npc1"), 0u);
+  EXPECT_EQ(dict.count("ego"), 1u);
+  EXPECT_TRUE(dict.find("npc1") == dict.end());
+  EXPECT_THROW(dict.at("npc1"), common::SimulationError);
+  EXPECT_EQ(static_cast<traffic_simulator::EntityStatus>(dict.at("npc2")).name, "npc2");
+
+  std::size_t visited = 0;
+  for (const auto & [name, status] : dict) {
+    EXPECT_NE(name, "npc1");
+    ++visited;
+  }
+  EXPECT_EQ(visited, 2u);
+}
+
+/**
+ * @note Test that copying the view shares the statuses instead of copying them.
+ */
+TEST_F(EntityStatusDictTest, shared)
+{
+  const auto dict = EntityStatusDict(statuses, "ego");
+  const auto copy = dict;
+
+  EXPECT_EQ(&copy.at("npc1"), &statuses->at("npc1"));
+  EXPECT_EQ(&dict.at("npc1"), &copy.at("npc1"));
+}
+
+/**
+ * @note Test that the default constructed view and the view excluding an unknown entity behave as
+ * an empty and a complete dictionary respectively.
+ */
+TEST_F(EntityStatusDictTest, defaultAndUnknownExcluded)
+{
+  const auto empty_dict = EntityStatusDict();
+  EXPECT_TRUE(empty_dict.empty());
+  EXPECT_TRUE(empty_dict.begin() == empty_dict.end());
+
+  const auto dict = EntityStatusDict(statuses, "unknown");
+  EXPECT_EQ(dict.size(), 3u);
+  EXPECT_EQ(std::distance(dict.begin(), dict.end()), 3);
+}
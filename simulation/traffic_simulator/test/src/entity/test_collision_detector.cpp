@@ -0,0 +1,113 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <geometry/intersection/collision.hpp>
+#include <geometry/quaternion/euler_to_quaternion.hpp>
+#include <random>
+#include <string>
+#include <traffic_simulator/entity/collision_detector.hpp>
+#include <utility>
+#include <vector>
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+auto makePose(const double x, const double y, const double yaw) -> geometry_msgs::msg::Pose
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.orientation = math::geometry::convertEulerAngleToQuaternion(
+    geometry_msgs::build<geometry_msgs::msg::Vector3>().x(0.0).y(0.0).z(yaw));
+  return pose;
+}
+
+auto makeBoundingBox(const double length, const double width)
+  -> traffic_simulator_msgs::msg::BoundingBox
+{
+  traffic_simulator_msgs::msg::BoundingBox bounding_box;
+  bounding_box.center.x = 1.0;
+  bounding_box.dimensions.x = length;
+  bounding_box.dimensions.y = width;
+  bounding_box.dimensions.z = 1.5;
+  return bounding_box;
+}
+
+/**
+ * @note Test basic functionality. Test that pairs are ordered by name and sorted.
+ */
+TEST(CollisionDetector, getCollidingPairs)
+{
+  traffic_simulator::entity::CollisionDetector detector;
+  detector.add("ego", makePose(0.0, 0.0, 0.0), makeBoundingBox(4.0, 2.0));
+  detector.add("c", makePose(3.0, 0.5, 0.0), makeBoundingBox(4.0, 2.0));
+  detector.add("b", makePose(-0.5, 0.0, M_PI_2), makeBoundingBox(4.0, 2.0));
+  detector.add("a", makePose(20.0, 0.0, 0.0), makeBoundingBox(4.0, 2.0));
+  detector.update();
+
+  using Pairs = std::vector<traffic_simulator::entity::CollisionDetector::Pair>;
+  EXPECT_EQ(detector.getCollidingPairs(), (Pairs{{"b", "ego"}, {"c", "ego"}}));
+  EXPECT_TRUE(detector.isColliding("ego", "b"));
+  EXPECT_TRUE(detector.isColliding("c", "ego"));
+  EXPECT_FALSE(detector.isColliding("a", "ego"));
+  EXPECT_FALSE(detector.isColliding("b", "c"));
+
+  detector.clear();
+  detector.update();
+  EXPECT_TRUE(detector.getCollidingPairs().empty());
+
+  // names of the previous frame are overwritten in place, and only the current ones are used
+  detector.clear();
+  detector.add("d", makePose(0.0, 0.0, 0.0), makeBoundingBox(4.0, 2.0));
+  detector.add("a", makePose(1.0, 0.0, 0.0), makeBoundingBox(4.0, 2.0));
+  detector.update();
+  EXPECT_EQ(detector.getCollidingPairs(), (Pairs{{"a", "d"}}));
+}
+
+/**
+ * @note Test function behavior when compared with checking all pairs with checkCollision2D.
+ */
+TEST(CollisionDetector, SameAsAllPairs)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> position(0.0, 100.0), yaw(-M_PI, M_PI), size(0.5, 10.0);
+
+  std::vector<std::pair<geometry_msgs::msg::Pose, traffic_simulator_msgs::msg::BoundingBox>>
+    entities;
+  traffic_simulator::entity::CollisionDetector detector;
+  for (std::size_t i = 0; i < 300; ++i) {
+    entities.emplace_back(
+      makePose(position(engine), position(engine), yaw(engine)),
+      makeBoundingBox(size(engine), size(engine)));
+    detector.add(std::to_string(i), entities.back().first, entities.back().second);
+  }
+  detector.update();
+
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    for (std::size_t j = i + 1; j < entities.size(); ++j) {
+      const auto expected = math::geometry::checkCollision2D(
+        entities[i].first, entities[i].second, entities[j].first, entities[j].second);
+      EXPECT_EQ(detector.isColliding(std::to_string(i), std::to_string(j)), expected);
+      count += expected;
+    }
+  }
+  EXPECT_EQ(detector.getCollidingPairs().size(), count);
+  EXPECT_GT(count, 0u);
+}
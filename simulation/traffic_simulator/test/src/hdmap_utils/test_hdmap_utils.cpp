@@ -15,6 +15,7 @@
 #include <geometry_msgs/msg/point.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <ament_index_cpp/get_package_share_directory.hpp>
 #include <geometry/quaternion/euler_to_quaternion.hpp>
 #include <string>
@@ -155,6 +156,37 @@ TEST(HdMapUtils, Construct_invalid)
     std::runtime_error);
 }
 
+/**
+ * @note Test basic functionality.
+ * Test that the instance of a map is shared by all callers while any of them holds it, and is
+ * released when none of them holds it, so that it is loaded again by the next caller.
+ */
+TEST(HdMapUtils, shared)
+{
+  const auto origin = geographic_msgs::build<geographic_msgs::msg::GeoPoint>()
+                        .latitude(35.61836750154)
+                        .longitude(139.78066608243)
+                        .altitude(0.0);
+  const auto map_directory = ament_index_cpp::get_package_share_directory("traffic_simulator");
+
+  auto first = hdmap_utils::HdMapUtils::shared(map_directory + "/map/lanelet2_map.osm", origin);
+  auto second =
+    hdmap_utils::HdMapUtils::shared(map_directory + "/map/../map/lanelet2_map.osm", origin);
+  EXPECT_EQ(first, second);
+
+  const auto other = hdmap_utils::HdMapUtils::shared(
+    map_directory + "/map/with_road_shoulder/lanelet2_map.osm", origin);
+  EXPECT_NE(first, other);
+
+  const std::weak_ptr<hdmap_utils::HdMapUtils> released = first;
+  first.reset();
+  EXPECT_FALSE(released.expired());
+  second.reset();
+  EXPECT_TRUE(released.expired());
+  EXPECT_NE(
+    hdmap_utils::HdMapUtils::shared(map_directory + "/map/lanelet2_map.osm", origin), nullptr);
+}
+
 /**
  * @note Test basic functionality.
  * Test map conversion to binary message correctness with a sample map.
@@ -462,6 +494,33 @@ TEST_F(HdMapUtilsTest_StandardMap, CanonicalizeAll)
   EXPECT_EQ(canonicalized_lanelet_poses[0].s, non_canonicalized_lanelet_s);
 }
 
+/**
+ * @note Testcase for getLaneChangeTrajectory() function
+ * Repeated searches are supposed to return the same trajectory, a search bounded by enough
+ * candidates is supposed to find the same trajectory as an unbounded one, and a search without
+ * any candidate is supposed to find nothing.
+ */
+TEST_F(HdMapUtilsTest_FourTrackHighwayMap, LaneChangeTrajectory_maximumNumberOfCandidates)
+{
+  const auto from =
+    hdmap_utils.toMapPose(traffic_simulator::helper::constructLaneletPose(3002176, 5.0)).pose;
+  const auto parameter = traffic_simulator::lane_change::Parameter(
+    traffic_simulator::lane_change::AbsoluteTarget(3002175));
+
+  const auto first = hdmap_utils.getLaneChangeTrajectory(from, parameter, 10.0, 20.0, 1.0);
+  const auto second = hdmap_utils.getLaneChangeTrajectory(from, parameter, 10.0, 20.0, 1.0);
+  const auto bounded = hdmap_utils.getLaneChangeTrajectory(from, parameter, 10.0, 20.0, 1.0, 50);
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  ASSERT_TRUE(bounded.has_value());
+  EXPECT_EQ(first->second, second->second);
+  EXPECT_EQ(first->first.getLength(), second->first.getLength());
+  EXPECT_EQ(first->second, bounded->second);
+  EXPECT_EQ(first->first.getLength(), bounded->first.getLength());
+
+  EXPECT_FALSE(hdmap_utils.getLaneChangeTrajectory(from, parameter, 10.0, 20.0, 1.0, 0));
+}
+
 /**
  * @note Testcase for countLaneChanges() function
  */
@@ -2052,6 +2111,32 @@ TEST_F(HdMapUtilsTest_KashiwanohaMap, getLongitudinalDistance_PullRequest1348)
     54.18867466433655977198213804513216018676757812500000));
 }
 
+/**
+ * @note Test function behavior when called repeatedly for the same pair of lanelets.
+ * The distance between the lanelets is cached, so it must only change by the change of the s values.
+ */
+TEST_F(HdMapUtilsTest_KashiwanohaMap, getLongitudinalDistance_cachedRoute)
+{
+  const auto distance = hdmap_utils.getLongitudinalDistance(
+    traffic_simulator::helper::constructLaneletPose(34468, 10.0),
+    traffic_simulator::helper::constructLaneletPose(34795, 5.0), true);
+  ASSERT_TRUE(distance.has_value());
+
+  const auto cached_distance = hdmap_utils.getLongitudinalDistance(
+    traffic_simulator::helper::constructLaneletPose(34468, 2.0),
+    traffic_simulator::helper::constructLaneletPose(34795, 7.0), true);
+  ASSERT_TRUE(cached_distance.has_value());
+  EXPECT_NEAR(cached_distance.value(), distance.value() + 8.0 + 2.0, 1e-9);
+
+  EXPECT_DOUBLE_EQ(
+    hdmap_utils
+      .getLongitudinalDistance(
+        traffic_simulator::helper::constructLaneletPose(34468, 10.0),
+        traffic_simulator::helper::constructLaneletPose(34795, 5.0), true)
+      .value(),
+    distance.value());
+}
+
 /**
  * @note Test basic functionality.
  * Test obtaining stop line ids correctness with a route that has no stop lines.
@@ -2613,3 +2698,108 @@ TEST_F(HdMapUtilsTest_CrossroadsWithStoplinesMap, getDistanceToStopLine_emptyVec
           makePoint(3807.63, 73715.99), makePoint(3785.76, 73707.70), makePoint(3773.19, 73723.27)})
       .has_value());
 }
+
+/**
+ * @note Test basic functionality.
+ * Test that the distance to the stop line found in the regulatory feature index
+ * is the same as the one found by intersecting the centerline of the route with the stop line.
+ */
+TEST_F(HdMapUtilsTest_CrossroadsWithStoplinesMap, getDistanceToRegulatoryFeature_stopLine)
+{
+  const auto route = lanelet::Ids{34780, 34675, 34744};
+  const auto is_stop_line = [](const auto & feature) {
+    return feature.type == hdmap_utils::RegulatoryFeature::Type::STOP_LINE;
+  };
+
+  const auto expected_distance = hdmap_utils.getDistanceToStopLine(
+    route, math::geometry::CatmullRomSpline(hdmap_utils.getCenterPoints(route)));
+  ASSERT_TRUE(expected_distance.has_value());
+
+  const auto result_distance = hdmap_utils.getDistanceToRegulatoryFeature(
+    route, traffic_simulator::helper::constructLaneletPose(34780, 0.0), is_stop_line);
+  ASSERT_TRUE(result_distance.has_value());
+  EXPECT_NEAR(expected_distance.value(), result_distance.value(), 0.1);
+
+  EXPECT_FALSE(hdmap_utils
+                 .getDistanceToRegulatoryFeature(
+                   route, traffic_simulator::helper::constructLaneletPose(34780, 0.0),
+                   is_stop_line, result_distance.value() - 1.0)
+                 .has_value());
+}
+
+/**
+ * @note Test basic functionality.
+ * Test that the traffic light stop line found in the regulatory feature index
+ * is at the same position as the one found by intersecting the centerline of the route.
+ */
+TEST_F(HdMapUtilsTest_CrossroadsWithStoplinesMap, getDistanceToRegulatoryFeature_trafficLight)
+{
+  const auto route = lanelet::Ids{34576, 34570, 34564};
+  const auto is_traffic_light_stop_line = [](const auto & feature) {
+    return feature.type == hdmap_utils::RegulatoryFeature::Type::TRAFFIC_LIGHT_STOP_LINE;
+  };
+
+  const auto expected_distance = hdmap_utils.getDistanceToTrafficLightStopLine(
+    route, math::geometry::CatmullRomSpline(hdmap_utils.getCenterPoints(route)));
+  ASSERT_TRUE(expected_distance.has_value());
+
+  const auto result_distance = hdmap_utils.getDistanceToRegulatoryFeature(
+    route, traffic_simulator::helper::constructLaneletPose(34576, 0.0),
+    is_traffic_light_stop_line);
+  ASSERT_TRUE(result_distance.has_value());
+  EXPECT_NEAR(expected_distance.value(), result_distance.value(), 0.1);
+}
+
+/**
+ * @note Test function behavior when the pose is inside the feature.
+ * Test that the distance to the edge where the centerline leaves the crosswalk is returned,
+ * like the first intersection of a trajectory that starts inside the crosswalk,
+ * and that the crosswalk is skipped once the pose has left it.
+ */
+TEST_F(HdMapUtilsTest_StandardMap, getDistanceToRegulatoryFeature_insideCrosswalk)
+{
+  const auto route = lanelet::Ids{34633};
+  const auto & features = hdmap_utils.getRegulatoryFeatures(34633);
+  const auto crosswalk = std::find_if(features.begin(), features.end(), [](const auto & feature) {
+    return feature.type == hdmap_utils::RegulatoryFeature::Type::CROSSWALK;
+  });
+  ASSERT_NE(crosswalk, features.end());
+  ASSERT_LT(crosswalk->s, crosswalk->end_s);
+  const auto is_crosswalk = [id = crosswalk->id](const auto & feature) {
+    return feature.type == hdmap_utils::RegulatoryFeature::Type::CROSSWALK and feature.id == id;
+  };
+
+  const auto s = (crosswalk->s + crosswalk->end_s) / 2.0;
+  const auto centerline = hdmap_utils.getCenterPointsSpline(34633);
+  const auto trajectory = math::geometry::CatmullRomSpline(
+    centerline->getTrajectory(s, centerline->getLength(), 1.0));
+  const auto expected_distance =
+    trajectory.getCollisionPointIn2D(hdmap_utils.getLaneletPolygon(crosswalk->id));
+  ASSERT_TRUE(expected_distance.has_value());
+
+  const auto result_distance = hdmap_utils.getDistanceToRegulatoryFeature(
+    route, traffic_simulator::helper::constructLaneletPose(34633, s), is_crosswalk);
+  ASSERT_TRUE(result_distance.has_value());
+  EXPECT_NEAR(crosswalk->end_s - s, result_distance.value(), 1e-6);
+  EXPECT_NEAR(expected_distance.value(), result_distance.value(), 0.1);
+
+  EXPECT_FALSE(hdmap_utils
+                 .getDistanceToRegulatoryFeature(
+                   route,
+                   traffic_simulator::helper::constructLaneletPose(34633, crosswalk->end_s + 0.1),
+                   is_crosswalk)
+                 .has_value());
+}
+
+/**
+ * @note Test function behavior when the pose is not on the route.
+ */
+TEST_F(HdMapUtilsTest_CrossroadsWithStoplinesMap, getDistanceToRegulatoryFeature_notOnRoute)
+{
+  EXPECT_FALSE(hdmap_utils
+                 .getDistanceToRegulatoryFeature(
+                   lanelet::Ids{34780, 34675, 34744},
+                   traffic_simulator::helper::constructLaneletPose(34576, 0.0),
+                   [](const auto &) { return true; })
+                 .has_value());
+}
@@ -0,0 +1,123 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <scenario_simulator_exception/exception.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <traffic_simulator/helper/frame_profiler.hpp>
+#include <vector>
+
+using traffic_simulator::helper::FrameProfiler;
+
+/**
+ * @note Test basic functionality. Test that a section registered twice is the same section.
+ */
+TEST(FrameProfiler, section)
+{
+  FrameProfiler profiler;
+  const auto update = profiler.section("update");
+  const auto render = profiler.section("render");
+  EXPECT_NE(update, render);
+  EXPECT_EQ(update, profiler.section("update"));
+  EXPECT_EQ(profiler.statistics().size(), 2u);
+}
+
+/**
+ * @note Test function behavior when registering more sections than the limit.
+ */
+TEST(FrameProfiler, section_tooMany)
+{
+  FrameProfiler profiler;
+  for (std::size_t i = 0; i < FrameProfiler::max_number_of_sections; ++i) {
+    profiler.section(std::to_string(i));
+  }
+  EXPECT_THROW(profiler.section("overflow"), common::SimulationError);
+}
+
+/**
+ * @note Test calculation correctness of the statistics with known durations.
+ */
+TEST(FrameProfiler, statistics)
+{
+  FrameProfiler profiler;
+  const auto section = profiler.section("section");
+  const auto begin = FrameProfiler::Clock::time_point();
+  for (int i = 0; i < 99; ++i) {
+    profiler.record(section, begin, begin + std::chrono::microseconds(10));
+  }
+  profiler.record(section, begin, begin + std::chrono::milliseconds(10));
+
+  const auto statistics = profiler.statistics();
+  ASSERT_EQ(statistics.size(), 1u);
+  EXPECT_EQ(statistics[0].name, "section");
+  EXPECT_EQ(statistics[0].count, 100u);
+  EXPECT_EQ(statistics[0].max, std::chrono::milliseconds(10));
+  EXPECT_EQ(statistics[0].mean, std::chrono::nanoseconds(109900));
+  // percentiles are the upper bounds of the power of two buckets
+  EXPECT_GE(statistics[0].p50, std::chrono::microseconds(10));
+  EXPECT_LT(statistics[0].p50, std::chrono::microseconds(20));
+  EXPECT_EQ(statistics[0].p99, statistics[0].p50);
+}
+
+/**
+ * @note Test that the records of all threads are merged.
+ */
+TEST(FrameProfiler, statistics_multipleThreads)
+{
+  FrameProfiler profiler;
+  const auto section = profiler.section("section");
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < 1000; ++j) {
+        const auto scope = profiler.measure(section);
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(profiler.statistics()[0].count, 4000u);
+}
+
+/**
+ * @note Test that only the latest events are kept in the trace.
+ */
+TEST(FrameProfiler, writeChromeTrace)
+{
+  FrameProfiler profiler(2);
+  const auto first = profiler.section("first");
+  const auto second = profiler.section("second");
+  const auto begin = FrameProfiler::Clock::now();
+  profiler.record(first, begin, begin + std::chrono::microseconds(1));
+  profiler.record(first, begin, begin + std::chrono::microseconds(2));
+  profiler.record(second, begin, begin + std::chrono::microseconds(3));
+
+  std::stringstream ss;
+  profiler.writeChromeTrace(ss);
+  const auto trace = ss.str();
+  EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"second\""), std::string::npos);
+  EXPECT_NE(trace.find("\"dur\":2.000"), std::string::npos);
+  EXPECT_EQ(trace.find("\"dur\":1.000"), std::string::npos);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -752,6 +752,28 @@ TEST_F(TrafficLightTest, contains_colorStatusShape)
   }
 }
 
+/**
+ * @note Test function behavior. A solid red or yellow circle must be a stop signal, other bulbs
+ * must not, and the result must follow the changes made by set and clear.
+ */
+TEST_F(TrafficLightTest, isStopSignal)
+{
+  auto traffic_light = TrafficLight(34802, map_manager);
+  EXPECT_FALSE(traffic_light.isStopSignal());
+
+  traffic_light.set("red flashing circle, green solidOn right");
+  EXPECT_FALSE(traffic_light.isStopSignal());
+
+  traffic_light.set("yellow solidOn circle");
+  EXPECT_TRUE(traffic_light.isStopSignal());
+
+  traffic_light.clear();
+  EXPECT_FALSE(traffic_light.isStopSignal());
+
+  traffic_light.emplace(Color::red, Status::solid_on, Shape::circle);
+  EXPECT_TRUE(traffic_light.isStopSignal());
+}
+
 /**
  * @note Test function behavior with a valid string.
  */
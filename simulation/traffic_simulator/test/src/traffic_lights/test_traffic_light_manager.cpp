@@ -96,3 +96,37 @@ TEST_F(TrafficLightManagerTest, getTrafficLights_setArrow)
     EXPECT_TRUE(manager.getTrafficLight(id).contains(Color::green, Status::solid_on, Shape::up));
   }
 }
+
+/**
+ * @note Test basic functionality. Test that the version changes when a traffic light is added or changed.
+ */
+TEST_F(TrafficLightManagerTest, getVersion)
+{
+  using Color = traffic_simulator::TrafficLight::Color;
+  const auto initial_version = manager.getVersion();
+  manager.getTrafficLight(34836);
+  const auto added_version = manager.getVersion();
+  EXPECT_NE(initial_version, added_version);
+  EXPECT_EQ(added_version, manager.getVersion());
+  manager.getTrafficLight(34836).emplace(Color::red);
+  EXPECT_NE(added_version, manager.getVersion());
+}
+
+/**
+ * @note Test basic functionality. Test that the delta request contains only the changed traffic lights.
+ */
+TEST_F(TrafficLightManagerTest, generateDeltaUpdateTrafficLightsRequest)
+{
+  using Color = traffic_simulator::TrafficLight::Color;
+  manager.getTrafficLight(34836).emplace(Color::green);
+  manager.getTrafficLight(34802).emplace(Color::green);
+  EXPECT_EQ(manager.generateDeltaUpdateTrafficLightsRequest().states_size(), 2);
+  EXPECT_EQ(manager.generateDeltaUpdateTrafficLightsRequest().states_size(), 0);
+
+  manager.getTrafficLight(34802).clear();
+  manager.getTrafficLight(34802).emplace(Color::red);
+  const auto request = manager.generateDeltaUpdateTrafficLightsRequest();
+  ASSERT_EQ(request.states_size(), 1);
+  EXPECT_EQ(request.states(0).id(), manager.getTrafficLight(34802).way_id);
+  EXPECT_EQ(manager.generateUpdateTrafficLightsRequest().states_size(), 2);
+}
@@ -61,6 +61,8 @@ struct TestControlParameters
   ArchitectureType architecture_type = ArchitectureType::AWF_UNIVERSE;
   std::string simulator_host = "localhost";
   double test_timeout = 60.0;
+  int64_t worker_count = 1;
+  int64_t worker_index = 0;
 };
 
 struct TestSuiteParameters
@@ -131,8 +133,10 @@ DEFINE_FMT_FORMATTER(
 
 DEFINE_FMT_FORMATTER(
   TestControlParameters,
-  "input dir: {} output dir: {} random test type: {} test count {} test_timeout {}", v.input_dir,
-  v.output_dir, v.random_test_type, v.test_count, v.test_timeout)
+  "input dir: {} output dir: {} random test type: {} test count {} test_timeout {} "
+  "worker {}/{}",
+  v.input_dir, v.output_dir, v.random_test_type, v.test_count, v.test_timeout, v.worker_index,
+  v.worker_count)
 
 DEFINE_FMT_FORMATTER(
   TestSuiteParameters,
@@ -68,6 +68,32 @@ public:
     return JunitXmlReporterTestCase(results_.testsuite(testsuite_name).testcase(testcase_name));
   }
 
+  /*
+   * Adds the test cases of a result file written by another reporter, e.g. by another worker of a
+   * parallel run, to the results of this reporter.
+   */
+  void read(const std::string & path)
+  {
+    pugi::xml_document document;
+    if (not document.load_file(path.c_str())) {
+      throw std::runtime_error(fmt::format("Failed to read results from {}", path));
+    }
+    for (const auto & testsuite : document.child("testsuites").children("testsuite")) {
+      auto & suite = results_.testsuite(testsuite.attribute("name").as_string());
+      for (const auto & testcase : testsuite.children("testcase")) {
+        auto & result = suite.testcase(testcase.attribute("name").as_string());
+        for (const auto & failure : testcase.children("failure")) {
+          result.failure.emplace_back(
+            failure.attribute("type").as_string(), failure.attribute("message").as_string());
+        }
+        for (const auto & error : testcase.children("error")) {
+          result.error.emplace_back(
+            error.attribute("type").as_string(), error.attribute("message").as_string());
+        }
+      }
+    }
+  }
+
   void write()
   {
     std::string message = fmt::format("Saving results to {}", output_directory_);
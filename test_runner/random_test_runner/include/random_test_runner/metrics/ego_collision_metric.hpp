@@ -17,9 +17,29 @@
 #ifndef RANDOM_TEST_RUNNER__COLLISION_METRIC_H
 #define RANDOM_TEST_RUNNER__COLLISION_METRIC_H
 
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 class EgoCollisionMetric
 {
 public:
+  /// Names of the entities colliding with the ego, taken from the colliding pairs of all entities
+  template <typename CollidingPairs>
+  static std::unordered_set<std::string> collidingWithEgo(
+    const CollidingPairs & colliding_pairs, const std::string & ego_name)
+  {
+    std::unordered_set<std::string> names;
+    for (const auto & [first, second] : colliding_pairs) {
+      if (first == ego_name) {
+        names.insert(second);
+      } else if (second == ego_name) {
+        names.insert(first);
+      }
+    }
+    return names;
+  }
+
   bool isThereEgosCollisionWith(const std::string & npc_name, double current_time)
   {
     timeoutCollisions(current_time);
@@ -17,9 +17,14 @@
 #ifndef RANDOM_TEST_RUNNER__RANDOM_TEST_RUNNER_HPP
 #define RANDOM_TEST_RUNNER__RANDOM_TEST_RUNNER_HPP
 
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <random>
 #include <rclcpp/rclcpp.hpp>
+#include <vector>
 
 #include "random_test_runner/data_types.hpp"
 #include "random_test_runner/file_interactions/junit_xml_reporter.hpp"
@@ -47,11 +52,23 @@ private:
   void update();
   void start();
   void stop();
+  void startTestExecutor();
+
+  boost::filesystem::path outputDirectory(int64_t worker_index) const;
+  void aggregateWorkerResults();
 
   std::random_device seed_randomization_device_;
 
-  std::vector<TestExecutor<traffic_simulator::API>> test_executors_;
-  std::vector<TestExecutor<traffic_simulator::API>>::iterator current_test_executor_;
+  TestControlParameters test_control_parameters_;
+
+  /*
+   * Test executors are constructed one at a time, when the previous test has finished, so that only
+   * one API instance is alive regardless of the number of tests.
+   */
+  std::function<TestExecutor<traffic_simulator::API>(std::size_t)> make_test_executor_;
+  std::vector<std::size_t> test_ids_;
+  std::size_t current_test_index_ = 0;
+  std::optional<TestExecutor<traffic_simulator::API>> current_test_executor_;
 
   JunitXmlReporter error_reporter_;
 
@@ -186,9 +186,13 @@ public:
         }
       }
 
-      for (const auto & npc : test_description_.npcs_descriptions) {
-        if (api_->entityExists(npc.name) && api_->checkCollision(ego_name_, npc.name)) {
-          if (ego_collision_metric_.isThereEgosCollisionWith(npc.name, current_time)) {
+      if (!test_description_.npcs_descriptions.empty()) {
+        const auto colliding_with_ego =
+          EgoCollisionMetric::collidingWithEgo(api_->getCollidingPairs(), ego_name_);
+        for (const auto & npc : test_description_.npcs_descriptions) {
+          if (
+            colliding_with_ego.count(npc.name) &&
+            ego_collision_metric_.isThereEgosCollisionWith(npc.name, current_time)) {
             std::string message =
               fmt::format("New collision occurred between ego and {}", npc.name);
             RCLCPP_INFO_STREAM(logger_, message);
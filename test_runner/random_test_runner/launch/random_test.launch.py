@@ -60,6 +60,11 @@ class RandomTestRunnerLaunch(object):
                                 "or the host name that is resolvable in the environment"},
 
             "port": {"default": 8080, "description": "Simulation server port"},
+            "worker_count":
+                {"default": 1,
+                 "description": "Number of tests run in parallel. Each worker uses its own simulator on "
+                                "port + worker index and its own ROS domain, and writes to "
+                                "output_dir/worker_<index>. The results are aggregated in output_dir"},
 
             # control arguments #
             "test_count": {"default": 5, "description": "Test count to be performed in test suite"},
@@ -177,46 +182,79 @@ class RandomTestRunnerLaunch(object):
                 parameters.append(vehicle_info_param_file_path)
                 parameters.append(simulator_model_param_file_path)
 
-        scenario_node = Node(
-            package="random_test_runner",
-            executable="random_test_runner_node",
-            namespace="simulation",
-            name="random_test_runner_node",
-            output="screen",
-            arguments=[("__log_level:=info")],
-            parameters=parameters
-        )
-
-        shutdown_handler = OnProcessExit(
-            target_action=scenario_node, on_exit=[EmitEvent(event=Shutdown())]
-        )
-
-        launch_description = [
-            scenario_node,
-            RegisterEventHandler(event_handler=shutdown_handler),
-            Node(
-                package="traffic_simulator",
-                executable="visualization_node",
+        worker_count = int(self.random_test_runner_launch_configuration["worker_count"].perform(context))
+        port = int(self.random_test_runner_launch_configuration["port"].perform(context))
+
+        # each worker of a parallel run has its own simulator port and ROS domain, so that the
+        # Autoware instances of the workers do not see each other
+        base_domain_id = int(os.environ.get("ROS_DOMAIN_ID", "0"))
+
+        def worker_environment(worker_index):
+            if worker_count > 1:
+                return {"ROS_DOMAIN_ID": str(base_domain_id + worker_index)}
+            else:
+                return {}
+
+        scenario_nodes = []
+        launch_description = []
+        for worker_index in range(worker_count):
+            scenario_node = Node(
+                package="random_test_runner",
+                executable="random_test_runner_node",
                 namespace="simulation",
-                name="visualizer",
+                name="random_test_runner_node",
                 output="screen",
-            ),
-            Node(
-                package="simple_sensor_simulator",
-                executable="simple_sensor_simulator_node",
-                name="simple_sensor_simulator_node",
-                namespace="simulation",
-                output="log",
-                arguments=[("__log_level:=warn")],
-                parameters=[{"port": 8080}],
-                condition=IfCondition(
-                    PythonExpression([
-                        "'", self.random_test_runner_launch_configuration["simulator_type"], "'",
-                        ' == "simple_sensor_simulator"'
-                    ])
+                arguments=[("__log_level:=info")],
+                parameters=parameters + [{"port": port + worker_index,
+                                          "worker_count": worker_count,
+                                          "worker_index": worker_index}],
+                additional_env=worker_environment(worker_index),
+            )
+            scenario_nodes.append(scenario_node)
+            launch_description += [
+                scenario_node,
+                Node(
+                    package="simple_sensor_simulator",
+                    executable="simple_sensor_simulator_node",
+                    name="simple_sensor_simulator_node",
+                    namespace="simulation",
+                    output="log",
+                    arguments=[("__log_level:=warn")],
+                    parameters=[{"port": port + worker_index}],
+                    additional_env=worker_environment(worker_index),
+                    condition=IfCondition(
+                        PythonExpression([
+                            "'", self.random_test_runner_launch_configuration["simulator_type"], "'",
+                            ' == "simple_sensor_simulator"'
+                        ])
+                    ),
                 ),
+            ]
+
+        running_workers = set(range(worker_count))
+
+        def on_worker_exit(worker_index):
+            def handler(event, context):
+                running_workers.discard(worker_index)
+                if not running_workers:
+                    return [EmitEvent(event=Shutdown())]
+            return handler
+
+        for worker_index, scenario_node in enumerate(scenario_nodes):
+            launch_description.append(RegisterEventHandler(event_handler=OnProcessExit(
+                target_action=scenario_node, on_exit=on_worker_exit(worker_index)
+            )))
+
+        if worker_count == 1:
+            launch_description.append(
+                Node(
+                    package="traffic_simulator",
+                    executable="visualization_node",
+                    namespace="simulation",
+                    name="visualizer",
+                    output="screen",
+                )
             )
-        ]
 
         return launch_description
 
@@ -43,8 +43,7 @@ LaneletUtils::LaneletUtils(const boost::filesystem::path & filename)
   vehicle_routing_graph_ptr_ =
     lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *traffic_rules_vehicle_ptr, costPtrs);
 
-  hdmap_utils_ptr_ =
-    std::make_shared<hdmap_utils::HdMapUtils>(filename, geographic_msgs::msg::GeoPoint());
+  hdmap_utils_ptr_ = hdmap_utils::HdMapUtils::shared(filename, geographic_msgs::msg::GeoPoint());
 }
 
 std::vector<int64_t> LaneletUtils::getLaneletIds() { return hdmap_utils_ptr_->getLaneletIds(); }
@@ -14,17 +14,22 @@
 //
 // Co-developed by TIER IV, Inc. and Robotec.AI sp. z o.o.
 
+#include <fcntl.h>
 #include <spdlog/fmt/fmt.h>
+#include <sys/file.h>
+#include <unistd.h>
 
 #include <ament_index_cpp/get_package_share_directory.hpp>
 #include <boost/optional/optional_io.hpp>
 #include <memory>
+#include <optional>
 #include <random_test_runner/file_interactions/yaml_test_params_saver.hpp>
 #include <random_test_runner/lanelet_utils.hpp>
 #include <random_test_runner/random_test_runner.hpp>
 #include <random_test_runner/test_randomizer.hpp>
 #include <rclcpp/logger.hpp>
 #include <string>
+#include <tuple>
 #include <traffic_simulator/api/configuration.hpp>
 #include <traffic_simulator/data_type/lanelet_pose.hpp>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
@@ -84,17 +89,33 @@ RandomTestRunner::RandomTestRunner(const rclcpp::NodeOptions & option)
     RCLCPP_INFO_STREAM(get_logger(), message);
   }
 
-  error_reporter_.init(test_control_parameters.output_dir);
+  test_control_parameters_ = test_control_parameters;
 
-  YamlTestParamsIO yaml_test_params_saver(get_logger(), test_control_parameters.output_dir);
+  // in a parallel run each worker writes its results to its own directory, see stop()
+  const auto output_dir = outputDirectory(test_control_parameters.worker_index);
+  boost::filesystem::create_directories(output_dir);
+  boost::filesystem::remove(output_dir / "result.junit.xml");
+
+  error_reporter_.init(output_dir.string());
+
+  YamlTestParamsIO yaml_test_params_saver(get_logger(), output_dir.string());
 
   yaml_test_params_saver.addTestSuite(validated_params, validated_params.name);
 
-  for (size_t test_id = 0; test_id < test_case_parameters_vector.size(); test_id++) {
+  // the tests are dealt to the workers in turn
+  for (size_t test_id = test_control_parameters.worker_index;
+       test_id < test_case_parameters_vector.size();
+       test_id += test_control_parameters.worker_count) {
+    test_ids_.push_back(test_id);
+    yaml_test_params_saver.addTestCase(test_case_parameters_vector[test_id], validated_params.name);
+  }
+
+  make_test_executor_ = [this, configuration, validated_params, test_case_parameters_vector,
+                         lanelet_utils, test_control_parameters](std::size_t test_id) {
     std::string message =
       fmt::format("Generating test {}/{}", test_id + 1, test_case_parameters_vector.size());
     RCLCPP_INFO_STREAM(get_logger(), message);
-    test_executors_.emplace_back(
+    return TestExecutor<traffic_simulator::API>(
       std::make_shared<traffic_simulator::API>(this, configuration, 1.0, 20),
       TestRandomizer(
         get_logger(), validated_params, test_case_parameters_vector[test_id], lanelet_utils)
@@ -102,10 +123,8 @@ RandomTestRunner::RandomTestRunner(const rclcpp::NodeOptions & option)
       error_reporter_.spawnTestCase(validated_params.name, std::to_string(test_id)),
       test_control_parameters.test_timeout, test_control_parameters.architecture_type,
       get_logger());
-    yaml_test_params_saver.addTestCase(test_case_parameters_vector[test_id], validated_params.name);
-  }
+  };
 
-  current_test_executor_ = test_executors_.begin();
   yaml_test_params_saver.write();
 
   start();
@@ -165,6 +184,13 @@ TestControlParameters RandomTestRunner::collectAndValidateTestControlParameters(
       fmt::format("Test timeout cannot be 0.0 or negative. Currently is {}", tp.test_timeout));
   }
 
+  tp.worker_count = this->declare_parameter<int>("worker_count", 1);
+  tp.worker_index = this->declare_parameter<int>("worker_index", 0);
+  if (tp.worker_count < 1 || tp.worker_index < 0 || tp.worker_index >= tp.worker_count) {
+    throw std::runtime_error(fmt::format(
+      "Worker index {} is out of range for {} workers", tp.worker_index, tp.worker_count));
+  }
+
   return tp;
 }
 
@@ -197,16 +223,12 @@ void RandomTestRunner::update()
 {
   if (current_test_executor_->scenarioCompleted()) {
     current_test_executor_->deinitialize();
-    current_test_executor_++;
-    if (current_test_executor_ == test_executors_.end()) {
+    current_test_executor_.reset();
+    if (++current_test_index_ == test_ids_.size()) {
       stop();
       return;
     }
-    std::string message = fmt::format(
-      "Running test {}/{}", std::distance(test_executors_.begin(), current_test_executor_) + 1,
-      test_executors_.size());
-    RCLCPP_INFO_STREAM(get_logger(), message);
-    current_test_executor_->initialize();
+    startTestExecutor();
   }
 
   current_test_executor_->update();
@@ -214,18 +236,88 @@ void RandomTestRunner::update()
 
 void RandomTestRunner::start()
 {
-  std::string message = fmt::format(
-    "Running test {}/{}", std::distance(test_executors_.begin(), current_test_executor_) + 1,
-    test_executors_.size());
-  RCLCPP_INFO_STREAM(get_logger(), message);
-  current_test_executor_->initialize();
   update_timer_ = this->create_wall_timer(
     std::chrono::milliseconds(50), std::bind(&RandomTestRunner::update, this));
+  if (test_ids_.empty()) {
+    stop();
+  } else {
+    startTestExecutor();
+  }
+}
+
+void RandomTestRunner::startTestExecutor()
+{
+  std::string message =
+    fmt::format("Running test {}/{}", current_test_index_ + 1, test_ids_.size());
+  RCLCPP_INFO_STREAM(get_logger(), message);
+  current_test_executor_.emplace(make_test_executor_(test_ids_[current_test_index_]));
+  current_test_executor_->initialize();
 }
 
 void RandomTestRunner::stop()
 {
   error_reporter_.write();
+  if (test_control_parameters_.worker_count > 1) {
+    aggregateWorkerResults();
+  }
   update_timer_->cancel();
   rclcpp::shutdown();
 }
+
+boost::filesystem::path RandomTestRunner::outputDirectory(int64_t worker_index) const
+{
+  const auto output_dir = boost::filesystem::path(test_control_parameters_.output_dir);
+  return test_control_parameters_.worker_count > 1
+           ? output_dir / fmt::format("worker_{}", worker_index)
+           : output_dir;
+}
+
+void RandomTestRunner::aggregateWorkerResults()
+{
+  // workers finishing at the same time take turns, so the last one writes the complete results
+  const auto lock_path =
+    boost::filesystem::path(test_control_parameters_.output_dir) / "result.lock";
+  const int lock = ::open(lock_path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (lock < 0 || ::flock(lock, LOCK_EX) != 0) {
+    throw std::runtime_error(fmt::format("Failed to lock {}", lock_path.string()));
+  }
+
+  JunitXmlReporter junit_xml_reporter(get_logger());
+  junit_xml_reporter.init(test_control_parameters_.output_dir);
+
+  std::optional<TestSuiteParameters> test_suite_parameters;
+  std::vector<std::vector<TestCaseParameters>> test_case_parameters_vectors(
+    test_control_parameters_.worker_count);
+
+  for (int64_t worker_index = 0; worker_index < test_control_parameters_.worker_count;
+       worker_index++) {
+    const auto worker_output_dir = outputDirectory(worker_index);
+    if (boost::filesystem::exists(worker_output_dir / "result.junit.xml")) {
+      junit_xml_reporter.read((worker_output_dir / "result.junit.xml").string());
+    }
+    if (boost::filesystem::exists(worker_output_dir / "result.yaml")) {
+      std::tie(test_suite_parameters, test_case_parameters_vectors[worker_index]) =
+        YamlTestParamsIO(get_logger(), worker_output_dir.string()).read();
+    }
+  }
+
+  junit_xml_reporter.write();
+
+  if (test_suite_parameters) {
+    YamlTestParamsIO yaml_test_params_saver(get_logger(), test_control_parameters_.output_dir);
+    yaml_test_params_saver.addTestSuite(*test_suite_parameters, test_suite_parameters->name);
+    // test cases are taken from the workers in turn, restoring the order of the test ids
+    for (size_t i = 0; i < test_case_parameters_vectors.front().size(); i++) {
+      for (const auto & test_case_parameters_vector : test_case_parameters_vectors) {
+        if (i < test_case_parameters_vector.size()) {
+          yaml_test_params_saver.addTestCase(
+            test_case_parameters_vector[i], test_suite_parameters->name);
+        }
+      }
+    }
+    yaml_test_params_saver.write();
+  }
+
+  ::flock(lock, LOCK_UN);
+  ::close(lock);
+}
@@ -17,6 +17,9 @@
 #include <gtest/gtest.h>
 
 #include <random_test_runner/metrics/ego_collision_metric.hpp>
+#include <string>
+#include <utility>
+#include <vector>
 
 TEST(Metrics, EgoCollisionMetric_noCollision)
 {
@@ -91,6 +94,15 @@ TEST(Metrics, EgoCollisionMetric_collisionAfterLongTime)
   EXPECT_TRUE(metric.isThereEgosCollisionWith("npc", 6.0));
 }
 
+TEST(Metrics, EgoCollisionMetric_collidingWithEgo)
+{
+  const std::vector<std::pair<std::string, std::string>> colliding_pairs = {
+    {"ego", "npc"}, {"a_npc", "ego"}, {"npc", "other"}};
+  const auto names = EgoCollisionMetric::collidingWithEgo(colliding_pairs, "ego");
+  EXPECT_EQ(names, (std::unordered_set<std::string>{"npc", "a_npc"}));
+  EXPECT_TRUE(EgoCollisionMetric::collidingWithEgo(colliding_pairs, "none").empty());
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -286,6 +286,41 @@ TEST(JunitXmlReporter, reportAll)
   EXPECT_STREQ(report.c_str(), ans.c_str());
 }
 
+TEST(JunitXmlReporter, read)
+{
+  JunitXmlReporter worker_reporter(rclcpp::get_logger("test_junit_xml_reporter"));
+  worker_reporter.init("/tmp");
+  worker_reporter.spawnTestCase("testsuite", "testcase")
+    .reportCollision(makeNPCDescription("npc", 1.0, makeLaneletPose(123, 5.0)), 10.0);
+  worker_reporter.write();
+
+  JunitXmlReporter reporter(rclcpp::get_logger("test_junit_xml_reporter"));
+  reporter.init("/tmp");
+  EXPECT_NO_THROW(reporter.read("/tmp/result.junit.xml"));
+  reporter.spawnTestCase("testsuite", "testcase").reportTimeout();
+
+  EXPECT_NO_THROW(reporter.write());
+
+  const std::string report = readFile();
+  const std::string ans = R"(<?xml version="1.0"?>
+<testsuites failures="0" errors="2" tests="2">
+  <testsuite name="testsuite" failures="0" errors="2" tests="2">
+    <testcase name="testcase">
+      <error type="collision" message="npc and ego collided at 10s" />
+      <error type="timeout" message="Ego failed to reach goal within timeout" />
+    </testcase>
+  </testsuite>
+</testsuites>
+)";
+  EXPECT_STREQ(report.c_str(), ans.c_str());
+}
+
+TEST(JunitXmlReporter, read_invalidPath)
+{
+  JunitXmlReporter reporter(rclcpp::get_logger("test_junit_xml_reporter"));
+  EXPECT_THROW(reporter.read("/tmp/invalid_path/result.junit.xml"), std::runtime_error);
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
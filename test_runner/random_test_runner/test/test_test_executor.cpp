@@ -104,7 +104,7 @@ public:
   MOCK_METHOD(double, getCurrentTime, (), ());
   MOCK_METHOD(void, getEntityStatusMock, (const std::string &), ());
   MOCK_METHOD(bool, entityExists, (const std::string &), ());
-  MOCK_METHOD(bool, checkCollision, (const std::string &, const std::string &), ());
+  MOCK_METHOD((std::vector<std::pair<std::string, std::string>>), getCollidingPairs, (), ());
 
   ::testing::StrictMock<MockFieldOperatorApplication> & asFieldOperatorApplication(
     const std::string & name)